@@ -31,6 +31,226 @@ protected:
 	WindowOpenGLTest * application;
 };
 
+// ====================================================================
+// checks of the event scheduling (each test uses a top level clock of its own, ticked manually)
+// ====================================================================
+
+class ClockEventRecord
+{
+public:
+
+	int id = 0;
+	double time = 0.0;
+};
+
+class TestEvent : public chaos::ClockEvent
+{
+public:
+
+	TestEvent(int in_id, std::vector<ClockEventRecord> * in_records) :
+		id(in_id),
+		records(in_records) {}
+
+	virtual chaos::ClockEventTickResult Tick(chaos::ClockEventTickData const & tick_data) override
+	{
+		records->push_back({ id, tick_data.execution_range.first });
+		if (tick_func)
+			tick_func();
+		return (continue_execution) ? ContinueExecution() : CompleteExecution();
+	}
+
+	virtual void OnEventRemovedFromClock() override
+	{
+		removed = true;
+		if (removed_func)
+			removed_func();
+	}
+
+public:
+
+	int id = 0;
+	std::vector<ClockEventRecord> * records = nullptr;
+	/** whether the event continues after being ticked */
+	bool continue_execution = false;
+	/** whether the event has been removed from its clock */
+	bool removed = false;
+	/** some actions on other events */
+	std::function<void()> tick_func;
+	std::function<void()> removed_func;
+};
+
+chaos::shared_ptr<TestEvent> AddTestEvent(chaos::Clock * clock, int id, chaos::ClockEventInfo const & event_info, std::vector<ClockEventRecord> * records)
+{
+	chaos::shared_ptr<TestEvent> result = new TestEvent(id, records);
+	bool added = clock->AddPendingEvent(result.get(), event_info, false);
+	assert(added);
+	return result;
+}
+
+// the events that are not started yet are ticked in the order of their start time, whatever the order they are added or removed
+void TestSleepingEventOrder()
+{
+	int const COUNT = 200;
+
+	std::vector<int> ids(COUNT);
+	for (int i = 0; i < COUNT; ++i)
+		ids[i] = i;
+	std::shuffle(ids.begin(), ids.end(), std::mt19937(12345));
+
+	chaos::shared_ptr<chaos::Clock> clock = new chaos::Clock("test");
+	std::vector<ClockEventRecord> records;
+
+	std::vector<chaos::shared_ptr<TestEvent>> events(COUNT);
+	for (int id : ids)
+		events[id] = AddTestEvent(clock.get(), id, chaos::ClockEventInfo::SingleTickEvent(double(id) + 0.5), &records);
+
+	// remove some sleeping events
+	for (int id : ids)
+	{
+		if (id % 3 == 0)
+		{
+			bool removed = events[id]->RemoveFromClock();
+			assert(removed && events[id]->removed);
+		}
+	}
+
+	// one event at most for each tick
+	for (int i = 0; i < COUNT; ++i)
+	{
+		size_t record_count = records.size();
+		clock->TickClock(1.0f);
+		if (i % 3 == 0)
+		{
+			assert(records.size() == record_count);
+		}
+		else
+		{
+			assert(records.size() == record_count + 1);
+			assert(records.back().id == i && records.back().time == double(i) + 0.5);
+			assert(events[i]->removed);
+		}
+	}
+
+	// all events in the same tick : they are ticked in the order of their start time
+	records.clear();
+	chaos::shared_ptr<chaos::Clock> other_clock = new chaos::Clock("other test");
+	for (int id : ids)
+		if (id < 10)
+			events[id] = AddTestEvent(other_clock.get(), id, chaos::ClockEventInfo::SingleTickEvent(double(id) + 0.5), &records);
+	other_clock->TickClock(10.0f);
+	assert(records.size() == 10);
+	for (int i = 0; i < 10; ++i)
+		assert(records[i].id == i);
+
+	// a repeated event goes back to sleep between its executions
+	records.clear();
+	chaos::shared_ptr<TestEvent> repeated_event = AddTestEvent(clock.get(), 0, chaos::ClockEventInfo::SingleTickEvent(clock->GetClockTime() + 0.5, chaos::ClockEventRepetitionInfo::Repetition(2.0, 3)), &records);
+	for (int i = 0; i < 10; ++i)
+		clock->TickClock(1.0f);
+	assert(records.size() == 4);
+	for (int i = 0; i < 4; ++i)
+		assert(records[i].time == double(COUNT) + 0.5 + 2.0 * double(i));
+	assert(repeated_event->removed);
+
+	chaos::Log::Message("Sleeping events order : OK");
+}
+
+// the events removed from a Tick(...) or from an OnEventRemovedFromClock(...) are never ticked
+void TestRemoveDuringTick()
+{
+	chaos::shared_ptr<chaos::Clock> clock = new chaos::Clock("test");
+	std::vector<ClockEventRecord> records;
+
+	chaos::shared_ptr<TestEvent> event1 = AddTestEvent(clock.get(), 1, chaos::ClockEventInfo::SingleTickEvent(1.5), &records);
+	chaos::shared_ptr<TestEvent> event2 = AddTestEvent(clock.get(), 2, chaos::ClockEventInfo::SingleTickEvent(2.5), &records);
+	chaos::shared_ptr<TestEvent> event3; // added by event1
+	chaos::shared_ptr<TestEvent> event4 = AddTestEvent(clock.get(), 4, chaos::ClockEventInfo::SingleTickEvent(5.5), &records);
+	chaos::shared_ptr<TestEvent> event5 = AddTestEvent(clock.get(), 5, chaos::ClockEventInfo::SingleTickEvent(6.5), &records);
+	chaos::shared_ptr<TestEvent> event6 = AddTestEvent(clock.get(), 6, chaos::ClockEventInfo::SingleTickEvent(7.5), &records);
+
+	event1->tick_func = [&]()
+	{
+		event4->RemoveFromClock();
+		event3 = AddTestEvent(clock.get(), 3, chaos::ClockEventInfo::SingleTickEvent(3.5), &records);
+	};
+	event2->removed_func = [&]() // the event is removed once ticked
+	{
+		event5->RemoveFromClock();
+	};
+
+	for (int i = 0; i < 10; ++i)
+		clock->TickClock(1.0f);
+
+	int const expected_ids[] = { 1, 2, 3, 6 };
+	assert(records.size() == 4);
+	for (size_t i = 0; i < 4; ++i)
+		assert(records[i].id == expected_ids[i]);
+	assert(event3 != nullptr && event3->removed);
+	assert(event4->removed && event5->removed);
+
+	chaos::Log::Message("Remove during tick : OK");
+}
+
+// an event removed by the clock while it scans its events (too late) may remove or add other events
+void TestRemoveDuringScan()
+{
+	chaos::shared_ptr<chaos::Clock> clock = new chaos::Clock("test");
+	std::vector<ClockEventRecord> records;
+
+	chaos::shared_ptr<TestEvent> range_event = AddTestEvent(clock.get(), 0, chaos::ClockEventInfo::RangeEvent(0.5, 1.0), &records);
+	range_event->continue_execution = true;
+	clock->TickClock(1.0f);
+	assert(records.size() == 1);
+
+	// the clock goes beyond the end of the range event without ticking it
+	clock->EnableTickEvents(false);
+	clock->TickClock(19.0f);
+	clock->EnableTickEvents(true);
+
+	chaos::shared_ptr<TestEvent> event1 = AddTestEvent(clock.get(), 1, chaos::ClockEventInfo::SingleTickEvent(20.2), &records);
+	chaos::shared_ptr<TestEvent> event2 = AddTestEvent(clock.get(), 2, chaos::ClockEventInfo::SingleTickEvent(20.4), &records);
+	chaos::shared_ptr<TestEvent> event3 = AddTestEvent(clock.get(), 3, chaos::ClockEventInfo::SingleTickEvent(20.6), &records);
+	chaos::shared_ptr<TestEvent> event4; // added during the scan (the clock time is already the end of the time slice : only an event that lasts can be added in the past)
+
+	// the range event is the first one to be scanned : the last event takes its place
+	range_event->removed_func = [&]()
+	{
+		event2->RemoveFromClock();
+		event4 = AddTestEvent(clock.get(), 4, chaos::ClockEventInfo::ForeverEvent(20.8), &records);
+	};
+	clock->TickClock(1.0f);
+
+	int const expected_ids[] = { 0, 1, 3, 4 };
+	assert(records.size() == 4);
+	for (size_t i = 0; i < 4; ++i)
+		assert(records[i].id == expected_ids[i]);
+	assert(range_event->removed && event2->removed);
+	assert(event1->removed && event3->removed && event4 != nullptr && event4->removed);
+
+	chaos::Log::Message("Remove during scan : OK");
+}
+
+// the duration of a tick does not depend on the number of events that are not started yet
+void BenchmarkSleepingEvents()
+{
+	int const EVENT_COUNT = 100000;
+	int const FRAME_COUNT = 600;
+
+	chaos::shared_ptr<chaos::Clock> clock = new chaos::Clock("benchmark");
+
+	std::mt19937 generator(12345);
+	std::uniform_real_distribution<double> distribution(0.0, 1000.0);
+	for (int i = 0; i < EVENT_COUNT; ++i)
+		clock->AddPendingEvent(new chaos::ClockEvent, chaos::ClockEventInfo::SingleTickEvent(distribution(generator)), false);
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (int i = 0; i < FRAME_COUNT; ++i)
+		clock->TickClock(1.0f / 60.0f);
+	auto t1 = std::chrono::steady_clock::now();
+
+	chaos::Log::Message("%d events over 1000s : %f ms per frame", EVENT_COUNT, std::chrono::duration<double, std::milli>(t1 - t0).count() / double(FRAME_COUNT));
+}
+
 // ====================================================================
 
 static glm::vec4 const red = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
@@ -196,6 +416,11 @@ protected:
 		if (!chaos::Window::InitializeFromConfiguration(config))
 			return false;
 
+		TestSleepingEventOrder();
+		TestRemoveDuringTick();
+		TestRemoveDuringScan();
+		BenchmarkSleepingEvents();
+
 		chaos::WindowApplication * application = chaos::Application::GetInstance();
 		if (application == nullptr)
 			return false;
@@ -0,0 +1,250 @@
+#include "chaos/Chaos.h"
+
+// the pool stores GPUBuffers : every test requires the GL context of the window
+
+// the size classes : a buffer created for a request exceeds it by less than 25%
+void TestSizeClasses()
+{
+	size_t const MIN_BUFFER_SIZE = chaos::GPUBufferPool::MIN_BUFFER_SIZE;
+
+	assert(chaos::GPUBufferPool::GetSizeClassSize(0) == MIN_BUFFER_SIZE);
+	for (size_t size_class = 0; size_class < 64; ++size_class)
+	{
+		size_t size = chaos::GPUBufferPool::GetSizeClassSize(size_class);
+		assert(chaos::GPUBufferPool::GetBufferSizeClass(size) == size_class);
+		assert(chaos::GPUBufferPool::GetSizeClassSize(size_class + 1) > size);
+	}
+
+	for (size_t required_size = 1; required_size < 1024 * 1024; ++required_size)
+	{
+		size_t size_class = chaos::GPUBufferPool::GetRequestSizeClass(required_size);
+		size_t size = chaos::GPUBufferPool::GetSizeClassSize(size_class);
+		assert(size >= required_size);
+		if (required_size <= MIN_BUFFER_SIZE)
+		{
+			assert(size_class == 0);
+		}
+		else
+		{
+			assert(size * 4 < required_size * 5);
+			assert(chaos::GPUBufferPool::GetSizeClassSize(size_class - 1) < required_size); // the smallest class that fits
+		}
+		// a buffer of that size belongs to the class that contains it
+		if (required_size >= MIN_BUFFER_SIZE)
+		{
+			size_t buffer_class = chaos::GPUBufferPool::GetBufferSizeClass(required_size);
+			assert(chaos::GPUBufferPool::GetSizeClassSize(buffer_class) <= required_size);
+			assert(chaos::GPUBufferPool::GetSizeClassSize(buffer_class + 1) > required_size);
+		}
+	}
+	chaos::Log::Message("Size classes : OK");
+}
+
+// buffers given without fence are immediately reused for requests of the same size class
+void TestNoFence()
+{
+	chaos::shared_ptr<chaos::GPUBufferPool> pool = new chaos::GPUBufferPool;
+
+	chaos::shared_ptr<chaos::GPUBuffer> buffer;
+	bool result = pool->GetBuffer(1000, buffer);
+	assert(result && buffer != nullptr);
+	assert(buffer->GetBufferSize() == 1024); // the size of the class
+	assert(pool->GetStats().miss_count == 1);
+	assert(pool->GetStats().allocated_bytes == 1024);
+	assert(pool->GetStats().wasted_bytes == 24);
+
+	chaos::GPUBuffer* given_buffer = buffer.get();
+	result = pool->GiveBuffer(buffer.get(), nullptr);
+	assert(result);
+	buffer = nullptr;
+	assert(pool->GetStats().cached_bytes == 1024);
+
+	// another size class : a new buffer
+	chaos::shared_ptr<chaos::GPUBuffer> other_buffer;
+	pool->GetBuffer(1100, other_buffer);
+	assert(other_buffer.get() != given_buffer);
+	assert(other_buffer->GetBufferSize() == 1280);
+	assert(pool->GetStats().miss_count == 2);
+
+	// same size class : the cached buffer
+	pool->GetBuffer(900, buffer);
+	assert(buffer.get() == given_buffer);
+	assert(pool->GetStats().hit_count == 1);
+	assert(pool->GetStats().cached_bytes == 0);
+	assert(pool->GetStats().wasted_bytes == 24 + 180 + 124);
+
+	// the counters are reset, not the cached bytes
+	pool->GiveBuffer(buffer.get(), nullptr);
+	pool->ResetStats();
+	assert(pool->GetStats().hit_count == 0 && pool->GetStats().miss_count == 0 && pool->GetStats().allocated_bytes == 0);
+	assert(pool->GetStats().cached_bytes == 1024);
+
+	chaos::Log::Message("No fence : OK");
+}
+
+// a buffer is not reused until its fence is signaled
+void TestFence()
+{
+	chaos::shared_ptr<chaos::GPUBufferPool> pool = new chaos::GPUBufferPool;
+
+	chaos::shared_ptr<chaos::GPUBuffer> free_buffer;
+	pool->GetBuffer(1000, free_buffer);
+	chaos::shared_ptr<chaos::GPUBuffer> pending_buffer;
+	pool->GetBuffer(1000, pending_buffer);
+	assert(pending_buffer.get() != free_buffer.get());
+
+	// a fence that is not pushed in the command queue yet (as the renderer's frame fence) : it is not signaled
+	chaos::shared_ptr<chaos::GPUFence> fence = new chaos::GPUFence(nullptr);
+	assert(!fence->WaitForCompletion(0.0f));
+
+	pool->GiveBuffer(free_buffer.get(), nullptr);
+	pool->GiveBuffer(pending_buffer.get(), fence.get());
+
+	// the buffer without fence first
+	chaos::shared_ptr<chaos::GPUBuffer> buffer;
+	pool->GetBuffer(1000, buffer);
+	assert(buffer.get() == free_buffer.get());
+
+	// the other one is still in use
+	pool->ResetStats();
+	pool->GetBuffer(1000, buffer);
+	assert(buffer.get() != pending_buffer.get());
+	assert(pool->GetStats().hit_count == 0);
+	assert(pool->GetStats().miss_count == 1);
+
+	// a buffer given after the fence waits for the fence too (the entries are ordered by fence)
+	chaos::GPUBuffer* late_buffer = buffer.get();
+	pool->GiveBuffer(buffer.get(), nullptr);
+	pool->GetBuffer(1000, buffer);
+	assert(buffer.get() != late_buffer);
+	assert(pool->GetStats().miss_count == 2);
+
+	// push the fence and wait for the GPU
+	bool created = fence->CreateGPUFence();
+	assert(created);
+	glFinish();
+	bool completed = fence->WaitForCompletion(1.0f);
+	assert(completed);
+
+	pool->GetBuffer(1000, buffer);
+	assert(buffer.get() == pending_buffer.get());
+	pool->GetBuffer(1000, buffer);
+	assert(buffer.get() == late_buffer);
+	assert(pool->GetStats().hit_count == 2);
+	assert(pool->GetStats().cached_bytes == 0);
+
+	chaos::Log::Message("Fence : OK");
+}
+
+// the least recently given buffers are destroyed when the budget is exceeded
+void TestMemoryBudget()
+{
+	chaos::shared_ptr<chaos::GPUBufferPool> pool = new chaos::GPUBufferPool;
+	assert(pool->GetMemoryBudget() == chaos::GPUBufferPool::DEFAULT_MEMORY_BUDGET);
+	pool->SetMemoryBudget(4 * 1024);
+
+	std::vector<chaos::shared_ptr<chaos::GPUBuffer>> buffers(8);
+	for (auto& buffer : buffers)
+		pool->GetBuffer(1024, buffer);
+	for (auto& buffer : buffers)
+		pool->GiveBuffer(buffer.get(), nullptr);
+
+	assert(pool->GetStats().cached_bytes == 4 * 1024);
+	assert(pool->GetStats().evicted_count == 4);
+
+	// the most recently given ones remain
+	for (size_t i = 0; i < 4; ++i)
+	{
+		chaos::shared_ptr<chaos::GPUBuffer> buffer;
+		pool->GetBuffer(1024, buffer);
+		assert(buffer.get() == buffers[buffers.size() - 1 - i].get());
+	}
+	assert(pool->GetStats().cached_bytes == 0);
+
+	// reducing the budget evicts immediately
+	pool->SetMemoryBudget(0); // no limit
+	for (auto& buffer : buffers)
+		pool->GiveBuffer(buffer.get(), nullptr);
+	assert(pool->GetStats().cached_bytes == 8 * 1024);
+	pool->SetMemoryBudget(2 * 1024);
+	assert(pool->GetStats().cached_bytes == 2 * 1024);
+	assert(pool->GetStats().evicted_count == 4 + 6);
+
+	// buffers smaller than any class are not kept
+	chaos::shared_ptr<chaos::GPUBuffer> small_buffer;
+	chaos::GPUBufferPool::CreateBuffer(chaos::GPUBufferPool::MIN_BUFFER_SIZE - 1, small_buffer);
+	bool given = pool->GiveBuffer(small_buffer.get(), nullptr);
+	assert(!given);
+
+	chaos::Log::Message("Memory budget : OK");
+}
+
+class WindowOpenGLTest : public chaos::Window
+{
+	CHAOS_DECLARE_OBJECT_CLASS(WindowOpenGLTest, chaos::Window);
+
+protected:
+
+	virtual bool InitializeFromConfiguration(nlohmann::json const * config) override
+	{
+		if (!chaos::Window::InitializeFromConfiguration(config))
+			return false;
+
+		TestSizeClasses();
+		TestNoFence();
+		TestFence();
+		TestMemoryBudget();
+
+		// display the counters of the pool used for rendering
+		SetKnownImGuiObjectVisibility("Buffer Pool", true);
+		return true;
+	}
+
+	virtual bool EnumerateKnownImGuiObjects(EnumerateKnownImGuiObjectFunc func) const override
+	{
+		if (chaos::Window::EnumerateKnownImGuiObjects(func))
+			return true;
+
+		return func("Buffer Pool", [this]()
+		{
+			chaos::ImGuiGPUBufferPoolObject* result = new chaos::ImGuiGPUBufferPoolObject;
+			if (result != nullptr)
+				result->SetBufferPool(buffer_pool.get());
+			return result;
+		});
+	}
+
+	virtual bool OnDraw(chaos::GPURenderer * renderer, chaos::GPUProgramProviderInterface const * uniform_provider, chaos::WindowDrawParams const& draw_params) override
+	{
+		// some buffers used for this frame only : they can be reused once the frame is rendered
+		for (int i = 0; i < 16; ++i)
+		{
+			chaos::shared_ptr<chaos::GPUBuffer> buffer;
+			if (buffer_pool->GetBuffer(size_t(256 + (rand() % 64) * 1024), buffer))
+				buffer_pool->GiveBuffer(buffer.get(), renderer->GetCurrentFrameFence());
+		}
+
+		glm::vec4 clear_color(0.0f, 0.0f, 0.1f, 0.0f);
+		glClearBufferfv(GL_COLOR, 0, (GLfloat*)&clear_color);
+
+		float far_plane = 1000.0f;
+		glClearBufferfi(GL_DEPTH_STENCIL, 0, far_plane, 0);
+		return true;
+	}
+
+	virtual void Finalize() override
+	{
+		SetKnownImGuiObjectVisibility("Buffer Pool", false);
+		buffer_pool = nullptr;
+		chaos::Window::Finalize();
+	}
+
+protected:
+
+	chaos::shared_ptr<chaos::GPUBufferPool> buffer_pool = new chaos::GPUBufferPool;
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunWindowApplication<WindowOpenGLTest>(argc, argv, env);
+}
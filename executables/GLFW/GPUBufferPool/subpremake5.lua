@@ -0,0 +1,6 @@
+-- =============================================================================
+-- ROOT_PATH/executables/GLFW/GPUBufferPool
+-- =============================================================================
+
+local project = build:WindowedApp()
+project:DependOnLib("CHAOS")
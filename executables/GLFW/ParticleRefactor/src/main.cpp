@@ -36,6 +36,11 @@ class ParticleExampleLayerTrait : public chaos::ParticleLayerTrait<ParticleExamp
 {
 public:
 
+	/** constructor */
+	ParticleExampleLayerTrait()
+	{
+		parallel_tick = true; // UpdateParticle(...) only touches its own particle
+	}
 
 	int BeginParticlesToPrimitives(chaos::ParticleConstAccessor<ParticleExample> & accessor, AllocationData const & data) const
 	{
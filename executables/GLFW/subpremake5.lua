@@ -32,3 +32,4 @@ build:ProcessSubPremake("KeyboardLayoutConversion")
 build:ProcessSubPremake("KeyboardLayoutTableGenerator")
 build:ProcessSubPremake("KeyboardLayoutVKGetter")
 build:ProcessSubPremake("ImGuiTests")
+build:ProcessSubPremake("GPUBufferPool")
@@ -539,6 +539,9 @@ void LudumLevelInstance::CommitDisplacements()
 			}
 		}
 	}
+	// the particles have been moved : the collision index of the layer is no more valid
+	if (TMLayerInstance* layer_instance = FindLayerInstance("GameObjects", true))
+		layer_instance->InvalidateSpatialIndex();
 }
 
 void LudumLevelInstance::DisplacementConsequences()
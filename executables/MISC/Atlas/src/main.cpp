@@ -118,6 +118,107 @@ void TestAtlasNormalMode(boost::filesystem::path const & dest_p, boost::filesyst
 	chaos::BitmapAtlas::AtlasGenerator::CreateAtlasFromDirectory(resources_path, result_path, true, params);
 }
 
+// fill an input with bitmaps of random sizes
+void AddRandomBitmaps(chaos::BitmapAtlas::FolderInfoInput * folder_input, int count, int max_size)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		int w = 4 + rand() % max_size;
+		int h = 4 + rand() % max_size;
+
+		FIBITMAP * bitmap = FreeImage_Allocate(w, h, 32);
+		if (bitmap != nullptr)
+		{
+			float color = chaos::MathTools::RandFloat();
+
+			chaos::ImageDescription image_description = chaos::ImageTools::GetImageDescription(bitmap);
+			chaos::ImageTools::FillImageBackground(image_description, glm::vec4(color, color, color, 1.0f));
+
+			if (folder_input->AddBitmap(bitmap, true, chaos::StringTools::Printf("bitmap_%d", i).c_str(), 0) == nullptr)
+				FreeImage_Unload(bitmap);
+		}
+	}
+}
+
+// every entry is inside its atlas page and does not overlap any other entry of the same page
+bool CheckAtlasLayout(chaos::BitmapAtlas::Atlas & atlas)
+{
+	chaos::BitmapAtlas::Rectangle page;
+	page.width  = atlas.GetAtlasDimension().x;
+	page.height = atlas.GetAtlasDimension().y;
+
+	std::vector<chaos::BitmapAtlas::BitmapLayout> layouts;
+	atlas.CollectEntries(layouts, true);
+
+	std::vector<std::vector<chaos::BitmapAtlas::Rectangle>> page_rectangles(atlas.GetBitmapCount());
+	for (chaos::BitmapAtlas::BitmapLayout const & layout : layouts)
+	{
+		if (layout.bitmap_index < 0 || layout.bitmap_index >= int(page_rectangles.size()))
+			return false;
+
+		chaos::BitmapAtlas::Rectangle r;
+		r.x = layout.x;
+		r.y = layout.y;
+		r.width = layout.width;
+		r.height = layout.height;
+		if (!r.IsFullyInside(page))
+			return false;
+
+		for (chaos::BitmapAtlas::Rectangle const & other : page_rectangles[layout.bitmap_index])
+			if (r.IsIntersecting(other))
+				return false;
+		page_rectangles[layout.bitmap_index].push_back(r);
+	}
+	return true;
+}
+
+// pack the same input with several strategies : display the duration and the fill ratio of the pages
+void BenchmarkPackingStrategies(chaos::BitmapAtlas::AtlasInput const & input, char const * input_name, std::vector<chaos::BitmapAtlas::AtlasPackingStrategy> const & strategies)
+{
+	for (chaos::BitmapAtlas::AtlasPackingStrategy strategy : strategies)
+	{
+		chaos::BitmapAtlas::Atlas                atlas;
+		chaos::BitmapAtlas::AtlasGenerator       generator;
+		chaos::BitmapAtlas::AtlasGeneratorParams params = chaos::BitmapAtlas::AtlasGeneratorParams(1024, 1024, 2, chaos::PixelFormatMergeParams());
+		params.packing_strategy = strategy;
+
+		auto t0 = std::chrono::steady_clock::now();
+		bool result = generator.ComputeResult(input, atlas, params);
+		auto t1 = std::chrono::steady_clock::now();
+		assert(result);
+		assert(CheckAtlasLayout(atlas));
+
+		glm::ivec2 dimension = atlas.GetAtlasDimension();
+		float fill_ratio = 100.0f * atlas.ComputeSurface(-1) / (float(atlas.GetBitmapCount()) * float(dimension.x) * float(dimension.y));
+
+		chaos::Log::Message("%s %s : %f ms, %d pages of %dx%d, fill %f %%",
+			input_name, EnumToString(strategy),
+			std::chrono::duration<double, std::milli>(t1 - t0).count(),
+			int(atlas.GetBitmapCount()), dimension.x, dimension.y, fill_ratio);
+	}
+}
+
+void TestPackingStrategies(boost::filesystem::path const & resources_path)
+{
+	using chaos::BitmapAtlas::AtlasPackingStrategy;
+
+	// synthetic inputs (CORNERS is too slow for the biggest one)
+	chaos::BitmapAtlas::AtlasInput small_input;
+	AddRandomBitmaps(small_input.AddFolder("random", 0), 1000, 125);
+	BenchmarkPackingStrategies(small_input, "1000 random bitmaps", { AtlasPackingStrategy::CORNERS, AtlasPackingStrategy::MAXRECTS_BSSF, AtlasPackingStrategy::SKYLINE });
+
+	chaos::BitmapAtlas::AtlasInput huge_input;
+	AddRandomBitmaps(huge_input.AddFolder("random", 0), 20000, 60);
+	BenchmarkPackingStrategies(huge_input, "20000 random bitmaps", { AtlasPackingStrategy::MAXRECTS_BSSF, AtlasPackingStrategy::SKYLINE });
+
+	// real inputs
+	chaos::BitmapAtlas::AtlasInput real_input;
+	real_input.AddFont((resources_path / "unispace bold italic.ttf").string().c_str(), nullptr, true, "font_info1", 0, chaos::BitmapAtlas::FontInfoInputParams());
+	real_input.AddFont((resources_path / "unispace.ttf").string().c_str(), nullptr, true, "font_info2", 0, chaos::BitmapAtlas::FontInfoInputParams());
+	real_input.AddFolder("images", 0)->AddBitmapFilesFromDirectory(resources_path / "Images", true);
+	BenchmarkPackingStrategies(real_input, "fonts and images", { AtlasPackingStrategy::CORNERS, AtlasPackingStrategy::MAXRECTS_BSSF, AtlasPackingStrategy::SKYLINE });
+}
+
 
 
 
@@ -222,6 +323,8 @@ protected:
 
 			TestAtlasFont(dst_p, rp);
 
+			TestPackingStrategies(rp);
+
 			chaos::WinTools::ShowFile(dst_p);
 		}
 
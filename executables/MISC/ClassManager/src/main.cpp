@@ -31,6 +31,17 @@ public:
 
 };
 
+class DerivedClass : public BaseClass
+{
+public:
+
+	CHAOS_DECLARE_OBJECT_CLASS(DerivedClass, BaseClass);
+};
+
+class NotDeclaredClass : public BaseClass
+{
+};
+
 //
 //   BaseClass           ???     Unknown (does not exist)
 //       ^                ^               ^
@@ -68,8 +79,130 @@ protected:
 		assert(object3 != nullptr);
 		assert(object3->value == 777);
 
+		TestFindCPPClass();
+		TestInheritsFrom();
+		TestConcurrentInheritsFrom();
+		BenchmarkLookups();
+
+		chaos::WinTools::PressToContinue();
 		return 0;
 	}
+
+	void TestFindCPPClass()
+	{
+		chaos::ClassManager* manager = chaos::ClassManager::GetDefaultInstance();
+
+		// the C++ classes are found by type
+		chaos::Class const* base_class = manager->FindCPPClass<BaseClass>();
+		assert(base_class != nullptr);
+		assert(base_class == (chaos::Class*)manager->FindClass("BaseClass"));
+		assert(base_class == (chaos::Class*)manager->FindClass("BC"));
+		assert(manager->FindCPPClass<DerivedClass>() == (chaos::Class*)manager->FindClass("DerivedClass"));
+		assert(manager->FindCPPClass<chaos::Object>() == (chaos::Class*)manager->FindClass("Object"));
+
+		// the JSON classes share the type of their C++ parent, but are never the result of a search by type
+		chaos::Class const* child_class = manager->FindClass("ChildClass");
+		assert(child_class != nullptr);
+		assert(child_class != base_class);
+		assert(manager->FindCPPClass<BaseClass>() == base_class);
+
+		// a class that has not been declared is not found (and the search does not register it)
+		assert(manager->FindCPPClass<NotDeclaredClass>() == nullptr);
+		assert(manager->FindCPPClass<NotDeclaredClass>() == nullptr);
+
+		chaos::Log::Message("FindCPPClass : OK");
+	}
+
+	void TestInheritsFrom()
+	{
+		chaos::ClassManager* manager = chaos::ClassManager::GetDefaultInstance();
+
+		chaos::Class const* object_class = manager->FindCPPClass<chaos::Object>();
+		chaos::Class const* base_class = manager->FindCPPClass<BaseClass>();
+		chaos::Class const* derived_class = manager->FindCPPClass<DerivedClass>();
+		chaos::Class const* child_class = manager->FindClass("ChildClass");
+		chaos::Class const* child_class2 = manager->FindClass("ChildClass2");
+
+		// twice : the first call fills the ancestors cache, the second one uses it
+		for (int i = 0; i < 2; ++i)
+		{
+			assert(chaos::Class::InheritsFrom(derived_class, base_class) == chaos::InheritanceType::YES);
+			assert(chaos::Class::InheritsFrom(derived_class, object_class) == chaos::InheritanceType::YES);
+			assert(chaos::Class::InheritsFrom(child_class, base_class) == chaos::InheritanceType::YES);
+			assert(chaos::Class::InheritsFrom(child_class2, child_class) == chaos::InheritanceType::YES);
+			assert(chaos::Class::InheritsFrom(child_class2, object_class) == chaos::InheritanceType::YES);
+
+			assert(chaos::Class::InheritsFrom(base_class, derived_class) == chaos::InheritanceType::NO);
+			assert(chaos::Class::InheritsFrom(child_class, child_class2) == chaos::InheritanceType::NO);
+			assert(chaos::Class::InheritsFrom(derived_class, child_class) == chaos::InheritanceType::NO);
+
+			assert(chaos::Class::InheritsFrom(base_class, base_class) == chaos::InheritanceType::NO);
+			assert(chaos::Class::InheritsFrom(base_class, base_class, true) == chaos::InheritanceType::YES);
+
+			// broken hierarchies are never considered as inheriting
+			assert(chaos::Class::InheritsFrom(manager->FindClass("BrokenInheritance2"), base_class) != chaos::InheritanceType::YES);
+			assert(chaos::Class::InheritsFrom(manager->FindClass("NoParent"), base_class) != chaos::InheritanceType::YES);
+			assert(chaos::Class::InheritsFrom(base_class, nullptr) == chaos::InheritanceType::UNKNOWN);
+			assert(chaos::Class::InheritsFrom(nullptr, base_class) == chaos::InheritanceType::UNKNOWN);
+		}
+		chaos::Log::Message("InheritsFrom : OK");
+	}
+
+	void TestConcurrentInheritsFrom()
+	{
+		chaos::JobSystem* job_system = chaos::Application::GetJobSystemInstance();
+		assert(job_system != nullptr);
+
+		chaos::ClassManager* manager = chaos::ClassManager::GetDefaultInstance();
+
+		chaos::Class const* base_class = manager->FindCPPClass<BaseClass>();
+		chaos::Class const* child_class2 = manager->FindClass("ChildClass2");
+
+		// lookups and inheritance tests can be done from any thread once the classes are declared
+		std::atomic<int> error_count = 0;
+		job_system->ParallelFor(100000, 100, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (manager->FindCPPClass<BaseClass>() != base_class)
+					++error_count;
+				if (manager->FindCPPClass<DerivedClass>()->InheritsFrom(base_class) != chaos::InheritanceType::YES)
+					++error_count;
+				if (child_class2->InheritsFrom(base_class) != chaos::InheritanceType::YES)
+					++error_count;
+			}
+		});
+		assert(error_count == 0);
+
+		chaos::Log::Message("Concurrent lookups : OK");
+	}
+
+	void BenchmarkLookups()
+	{
+		int const lookup_count = 1000000;
+
+		chaos::ClassManager* manager = chaos::ClassManager::GetDefaultInstance();
+
+		chaos::Class const* object_class = manager->FindCPPClass<chaos::Object>();
+		chaos::Class const* child_class2 = manager->FindClass("ChildClass2");
+
+		size_t found_count = 0;
+		auto t0 = std::chrono::steady_clock::now();
+		for (int i = 0; i < lookup_count; ++i)
+			found_count += (manager->FindCPPClass<DerivedClass>() != nullptr) ? 1 : 0;
+		auto t1 = std::chrono::steady_clock::now();
+		for (int i = 0; i < lookup_count; ++i)
+			found_count += (child_class2->InheritsFrom(object_class) == chaos::InheritanceType::YES) ? 1 : 0;
+		auto t2 = std::chrono::steady_clock::now();
+
+		assert(found_count == 2 * lookup_count);
+
+		auto ms = [](auto d) { return std::chrono::duration<double, std::milli>(d).count(); };
+
+		chaos::Log::Message("%d lookups", lookup_count);
+		chaos::Log::Message("  FindCPPClass : %f ms", ms(t1 - t0));
+		chaos::Log::Message("  InheritsFrom : %f ms", ms(t2 - t1));
+	}
 };
 
 
@@ -0,0 +1,267 @@
+#include "chaos/Chaos.h"
+
+// generate an image whose pixels are randomly opaque (the default color filter keeps the pixels with some alpha)
+FIBITMAP* GenerateImage(int width, int height, int opaque_percent)
+{
+	return chaos::ImageTools::GenFreeImage<chaos::PixelBGRA>(width, height, [opaque_percent](chaos::ImageDescription& desc)
+	{
+		chaos::ImagePixelAccessor<chaos::PixelBGRA> accessor(desc);
+		for (int y = 0; y < desc.height; ++y)
+		{
+			for (int x = 0; x < desc.width; ++x)
+			{
+				chaos::PixelBGRA& pixel = accessor(x, y);
+				pixel.B = (unsigned char)(rand() & 0xFF);
+				pixel.G = (unsigned char)(rand() & 0xFF);
+				pixel.R = (unsigned char)(rand() & 0xFF);
+				pixel.A = (rand() % 100 < opaque_percent) ? 255 : 0;
+			}
+		}
+	});
+}
+
+// compare the pixels of two images
+bool SamePixels(FIBITMAP* image1, FIBITMAP* image2)
+{
+	chaos::ImagePixelAccessor<chaos::PixelBGRA> accessor1(chaos::ImageTools::GetImageDescription(image1));
+	chaos::ImagePixelAccessor<chaos::PixelBGRA> accessor2(chaos::ImageTools::GetImageDescription(image2));
+	if (!accessor1.IsValid() || !accessor2.IsValid())
+		return false;
+
+	chaos::ImageDescription desc1 = chaos::ImageTools::GetImageDescription(image1);
+	chaos::ImageDescription desc2 = chaos::ImageTools::GetImageDescription(image2);
+	if (desc1.width != desc2.width || desc1.height != desc2.height)
+		return false;
+
+	for (int y = 0; y < desc1.height; ++y)
+		for (int x = 0; x < desc1.width; ++x)
+			if (memcmp(&accessor1(x, y), &accessor2(x, y), sizeof(chaos::PixelBGRA)) != 0)
+				return false;
+	return true;
+}
+
+// convert a color as the processors do
+chaos::PixelBGRA GetPixel(glm::vec4 const& color)
+{
+	chaos::PixelRGBAFloat c = color;
+	chaos::PixelBGRA result;
+	chaos::PixelConverter::Convert(result, c);
+	return result;
+}
+
+// the reference : test every pixel in the neighbourhood of every destination pixel
+FIBITMAP* BruteForceOutline(chaos::ImageProcessorOutline const& processor, FIBITMAP* src)
+{
+	chaos::ImageDescription src_desc = chaos::ImageTools::GetImageDescription(src);
+	chaos::ImagePixelAccessor<chaos::PixelBGRA> src_accessor(src_desc);
+
+	int distance = processor.distance;
+	int dest_width = src_desc.width + 2 * distance;
+	int dest_height = src_desc.height + 2 * distance;
+
+	chaos::PixelBGRA outline = GetPixel(processor.color);
+	chaos::PixelBGRA empty = GetPixel(processor.empty_color);
+
+	auto is_kept = [&](int x, int y)
+	{
+		return (x >= 0 && x < src_desc.width && y >= 0 && y < src_desc.height && processor.color_filter.Filter(src_accessor(x, y)));
+	};
+
+	return chaos::ImageTools::GenFreeImage<chaos::PixelBGRA>(dest_width, dest_height, [&](chaos::ImageDescription& desc)
+	{
+		chaos::ImagePixelAccessor<chaos::PixelBGRA> dst_accessor(desc);
+		for (int y = 0; y < dest_height; ++y)
+		{
+			for (int x = 0; x < dest_width; ++x)
+			{
+				int src_x = x - distance;
+				int src_y = y - distance;
+
+				bool near_kept_pixel = false;
+				for (int dy = -distance; dy <= distance && !near_kept_pixel; ++dy)
+					for (int dx = -distance; dx <= distance && !near_kept_pixel; ++dx)
+						if (dx * dx + dy * dy <= distance * distance && is_kept(src_x + dx, src_y + dy))
+							near_kept_pixel = true;
+
+				if (distance >= 0 && is_kept(src_x, src_y))
+					dst_accessor(x, y) = src_accessor(src_x, src_y);
+				else if (near_kept_pixel)
+					dst_accessor(x, y) = outline;
+				else
+					dst_accessor(x, y) = empty;
+			}
+		}
+	});
+}
+
+// the reference : test every pixel in the neighbourhood of every destination pixel
+FIBITMAP* BruteForceShadow(chaos::ImageProcessorShadow const& processor, FIBITMAP* src)
+{
+	chaos::ImageDescription src_desc = chaos::ImageTools::GetImageDescription(src);
+	chaos::ImagePixelAccessor<chaos::PixelBGRA> src_accessor(src_desc);
+
+	int distance = std::max(processor.distance, 0);
+	int offset_x = int(std::round(processor.offset.x));
+	int offset_y = int(std::round(processor.offset.y));
+
+	int src_origin_x = distance + std::max(-offset_x, 0);
+	int src_origin_y = distance + std::max(-offset_y, 0);
+
+	int dest_width = src_desc.width + std::abs(offset_x) + 2 * distance;
+	int dest_height = src_desc.height + std::abs(offset_y) + 2 * distance;
+
+	chaos::PixelBGRA shadow = GetPixel(processor.color);
+	chaos::PixelBGRA empty = GetPixel(processor.empty_color);
+
+	auto is_kept = [&](int x, int y)
+	{
+		return (x >= 0 && x < src_desc.width && y >= 0 && y < src_desc.height && processor.color_filter.Filter(src_accessor(x, y)));
+	};
+
+	return chaos::ImageTools::GenFreeImage<chaos::PixelBGRA>(dest_width, dest_height, [&](chaos::ImageDescription& desc)
+	{
+		chaos::ImagePixelAccessor<chaos::PixelBGRA> dst_accessor(desc);
+		for (int y = 0; y < dest_height; ++y)
+		{
+			for (int x = 0; x < dest_width; ++x)
+			{
+				int src_x = x - src_origin_x;
+				int src_y = y - src_origin_y;
+
+				bool near_shadow_pixel = false;
+				for (int dy = -distance; dy <= distance && !near_shadow_pixel; ++dy)
+					for (int dx = -distance; dx <= distance && !near_shadow_pixel; ++dx)
+						if (dx * dx + dy * dy <= distance * distance && is_kept(src_x - offset_x + dx, src_y - offset_y + dy))
+							near_shadow_pixel = true;
+
+				if (is_kept(src_x, src_y))
+					dst_accessor(x, y) = src_accessor(src_x, src_y);
+				else if (near_shadow_pixel)
+					dst_accessor(x, y) = shadow;
+				else
+					dst_accessor(x, y) = empty;
+			}
+		}
+	});
+}
+
+// the distance transform gives the same images than the brute force
+template<typename PROCESSOR, typename REFERENCE_FUNC>
+void CompareWithBruteForce(PROCESSOR const& processor, REFERENCE_FUNC reference_func)
+{
+	int const sizes[][2] = { { 1, 1 }, { 7, 3 }, { 32, 32 }, { 61, 47 }, { 300, 260 } }; // the last one is processed in parallel
+	int const opaque_percents[] = { 0, 1, 10, 50, 100 };
+
+	for (auto const& size : sizes)
+	{
+		for (int opaque_percent : opaque_percents)
+		{
+			FIBITMAP* src = GenerateImage(size[0], size[1], opaque_percent);
+			assert(src != nullptr);
+
+			FIBITMAP* result = processor.ProcessImage(chaos::ImageTools::GetImageDescription(src));
+			FIBITMAP* expected = reference_func(processor, src);
+			assert(result != nullptr && expected != nullptr);
+			assert(SamePixels(result, expected));
+
+			FreeImage_Unload(expected);
+			FreeImage_Unload(result);
+			FreeImage_Unload(src);
+		}
+	}
+}
+
+void TestOutline()
+{
+	chaos::ImageProcessorOutline processor;
+	processor.color = { 1.0f, 0.0f, 0.0f, 1.0f };
+	processor.empty_color = { 0.0f, 0.0f, 1.0f, 0.5f };
+
+	for (int distance : { 0, 1, 2, 3, 5, 8, 13 })
+	{
+		processor.distance = distance;
+		CompareWithBruteForce(processor, BruteForceOutline);
+	}
+
+	// a negative distance gives an empty image
+	processor.distance = -1;
+	FIBITMAP* src = GenerateImage(10, 10, 50);
+	FIBITMAP* result = processor.ProcessImage(chaos::ImageTools::GetImageDescription(src));
+	FIBITMAP* expected = BruteForceOutline(processor, src);
+	assert(SamePixels(result, expected));
+	FreeImage_Unload(expected);
+	FreeImage_Unload(result);
+	FreeImage_Unload(src);
+
+	chaos::Log::Message("Outline same as brute force : OK");
+}
+
+void TestShadow()
+{
+	chaos::ImageProcessorShadow processor;
+	processor.color = { 0.0f, 0.0f, 0.0f, 0.5f };
+	processor.empty_color = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+	glm::vec2 const offsets[] = { { 0.0f, 0.0f }, { 5.0f, 5.0f }, { -3.0f, 2.0f }, { 1.4f, -6.6f } };
+	for (glm::vec2 const& offset : offsets)
+	{
+		for (int distance : { -1, 0, 1, 4, 9 })
+		{
+			processor.offset = offset;
+			processor.distance = distance;
+			CompareWithBruteForce(processor, BruteForceShadow);
+		}
+	}
+	chaos::Log::Message("Shadow same as brute force : OK");
+}
+
+// the duration of the outline processing : with the brute force, it grows with the square of the distance
+void BenchmarkOutline()
+{
+	FIBITMAP* src = GenerateImage(512, 512, 5);
+	assert(src != nullptr);
+
+	chaos::ImageProcessorOutline processor;
+	for (int distance : { 1, 4, 16, 64 })
+	{
+		processor.distance = distance;
+
+		auto t0 = std::chrono::steady_clock::now();
+		FIBITMAP* result = processor.ProcessImage(chaos::ImageTools::GetImageDescription(src));
+		auto t1 = std::chrono::steady_clock::now();
+		FreeImage_Unload(result);
+
+		chaos::Log::Message("Outline 512x512 distance %d : %f ms", distance, std::chrono::duration<double, std::milli>(t1 - t0).count());
+
+		if (distance <= 16) // the brute force is too slow beyond
+		{
+			auto t2 = std::chrono::steady_clock::now();
+			FIBITMAP* expected = BruteForceOutline(processor, src);
+			auto t3 = std::chrono::steady_clock::now();
+			FreeImage_Unload(expected);
+
+			chaos::Log::Message("  brute force : %f ms", std::chrono::duration<double, std::milli>(t3 - t2).count());
+		}
+	}
+	FreeImage_Unload(src);
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	virtual int Main() override
+	{
+		TestOutline();
+		TestShadow();
+		BenchmarkOutline();
+
+		chaos::WinTools::PressToContinue();
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
@@ -0,0 +1,6 @@
+-- =============================================================================
+-- ROOT_PATH/executables/MISC/ImageProcessor
+-- =============================================================================
+
+local project = build:WindowedApp()
+project:DependOnLib("CHAOS")
@@ -0,0 +1,221 @@
+#include "chaos/Chaos.h"
+
+// many small jobs : each one is executed exactly once
+void TestSchedule(chaos::JobSystem& job_system)
+{
+	int const job_count = 10000;
+
+	std::vector<int> executions(job_count, 0);
+
+	chaos::JobCounter counter;
+	for (int i = 0; i < job_count; ++i)
+		job_system.Schedule([&executions, i]() { ++executions[i]; }, &counter);
+	job_system.Wait(counter);
+
+	assert(counter.IsDone());
+	for (int i = 0; i < job_count; ++i)
+		assert(executions[i] == 1);
+
+	chaos::Log::Message("Schedule : OK");
+}
+
+// the jobs of the second stage only start once all the jobs of the first stage are executed
+void TestDependency(chaos::JobSystem& job_system)
+{
+	int const job_count = 256;
+
+	std::vector<int> values(job_count, 0);
+	std::atomic<int> first_stage_done = 0;
+	std::atomic<int> early_starts = 0;
+	std::atomic<int> sum = 0;
+
+	chaos::JobCounter first_stage;
+	chaos::JobCounter second_stage;
+	for (int i = 0; i < job_count; ++i)
+	{
+		job_system.Schedule([&values, &first_stage_done, i]()
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(50));
+			values[i] = i + 1;
+			++first_stage_done;
+		}, &first_stage);
+	}
+	for (int i = 0; i < job_count; ++i)
+	{
+		job_system.Schedule([&values, &first_stage_done, &early_starts, &sum, i, job_count]()
+		{
+			if (first_stage_done != job_count)
+				++early_starts;
+			sum += values[job_count - 1 - i];
+		}, &second_stage, &first_stage);
+	}
+	job_system.Wait(second_stage);
+	job_system.Wait(first_stage); // already done
+
+	assert(early_starts == 0);
+	assert(sum == job_count * (job_count + 1) / 2);
+
+	// a dependency that is already done does not delay the job
+	chaos::JobCounter third_stage;
+	job_system.Schedule([&sum]() { sum = 0; }, &third_stage, &first_stage);
+	job_system.Wait(third_stage);
+	assert(sum == 0);
+
+	chaos::Log::Message("Dependency : OK");
+}
+
+// jobs that schedule jobs and wait for them (the waiting thread executes jobs meanwhile, so this cannot starve the workers)
+void TestNestedWait(chaos::JobSystem& job_system)
+{
+	int const outer_count = 64;
+	int const inner_count = 64;
+
+	std::atomic<int> executions = 0;
+
+	chaos::JobCounter outer_counter;
+	for (int i = 0; i < outer_count; ++i)
+	{
+		job_system.Schedule([&job_system, &executions, inner_count]()
+		{
+			chaos::JobCounter inner_counter;
+			for (int j = 0; j < inner_count; ++j)
+				job_system.Schedule([&executions]() { ++executions; }, &inner_counter);
+			job_system.Wait(inner_counter);
+			assert(inner_counter.IsDone());
+		}, &outer_counter);
+	}
+	job_system.Wait(outer_counter);
+
+	assert(executions == outer_count * inner_count);
+
+	chaos::Log::Message("Nested Wait : OK");
+}
+
+// each index is processed exactly once, whatever the grain size
+void TestParallelFor(chaos::JobSystem& job_system)
+{
+	size_t const counts[] = { 0, 1, 7, 100, 1000, 100003 };
+	size_t const grain_sizes[] = { 0, 1, 3, 64, 1000, 1000000 };
+
+	for (size_t count : counts)
+	{
+		for (size_t grain_size : grain_sizes)
+		{
+			std::vector<int> executions(count, 0);
+			std::atomic<size_t> range_count = 0;
+
+			job_system.ParallelFor(count, grain_size, [&executions, &range_count, grain_size](size_t begin, size_t end)
+			{
+				assert(begin < end);
+				assert(end - begin <= std::max(grain_size, size_t(1)));
+				for (size_t i = begin; i < end; ++i)
+					++executions[i]; // the ranges do not overlap
+				++range_count;
+			});
+
+			for (size_t i = 0; i < count; ++i)
+				assert(executions[i] == 1);
+			if (count > 0)
+				assert(range_count > 0);
+		}
+	}
+	chaos::Log::Message("ParallelFor : OK");
+}
+
+// without workers, the jobs are executed by the waiting thread. Stopping the workers executes the scheduled jobs
+void TestWorkers()
+{
+	std::atomic<int> executions = 0;
+
+	{
+		chaos::shared_ptr<chaos::JobSystem> job_system = new chaos::JobSystem;
+		assert(job_system->GetWorkerCount() == 0);
+
+		chaos::JobCounter counter;
+		for (int i = 0; i < 100; ++i)
+			job_system->Schedule([&executions]() { ++executions; }, &counter);
+		job_system->Wait(counter);
+		assert(executions == 100);
+	}
+
+	{
+		chaos::shared_ptr<chaos::JobSystem> job_system = new chaos::JobSystem;
+		bool started = job_system->StartWorkers(4);
+		assert(started);
+		assert(job_system->GetWorkerCount() == 4);
+		assert(!job_system->StartWorkers(4)); // already started
+
+		executions = 0;
+		for (int i = 0; i < 1000; ++i)
+			job_system->Schedule([&executions]() { ++executions; });
+		job_system->StopWorkers();
+		assert(executions == 1000);
+		assert(job_system->GetWorkerCount() == 0);
+
+		// the system can be started again
+		started = job_system->StartWorkers(2);
+		assert(started);
+		TestSchedule(*job_system);
+	}
+	chaos::Log::Message("Workers : OK");
+}
+
+// the duration of a CPU bound loop, sequential then with ParallelFor
+void BenchmarkParallelFor(chaos::JobSystem& job_system)
+{
+	size_t const count = 1 << 22;
+
+	std::vector<float> values(count);
+	for (size_t i = 0; i < count; ++i)
+		values[i] = float(i % 1000) * 0.001f;
+
+	auto process = [&values](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			float v = values[i];
+			for (int j = 0; j < 32; ++j)
+				v = std::sqrt(v * v + 1.0f) - 0.5f;
+			values[i] = v;
+		}
+	};
+
+	auto t0 = std::chrono::steady_clock::now();
+	process(0, count);
+	auto t1 = std::chrono::steady_clock::now();
+	job_system.ParallelFor(count, 4096, process);
+	auto t2 = std::chrono::steady_clock::now();
+
+	auto ms = [](auto d) { return std::chrono::duration<double, std::milli>(d).count(); };
+
+	chaos::Log::Message("%d values (%d workers)", int(count), int(job_system.GetWorkerCount()));
+	chaos::Log::Message("  sequential  : %f ms", ms(t1 - t0));
+	chaos::Log::Message("  ParallelFor : %f ms", ms(t2 - t1));
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	virtual int Main() override
+	{
+		// the job system owned by the application
+		chaos::JobSystem* job_system = chaos::Application::GetJobSystemInstance();
+		assert(job_system != nullptr);
+
+		TestSchedule(*job_system);
+		TestDependency(*job_system);
+		TestNestedWait(*job_system);
+		TestParallelFor(*job_system);
+		TestWorkers();
+		BenchmarkParallelFor(*job_system);
+
+		chaos::WinTools::PressToContinue();
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
@@ -0,0 +1,6 @@
+-- =============================================================================
+-- ROOT_PATH/executables/MISC/JobSystem
+-- =============================================================================
+
+local project = build:WindowedApp()
+project:DependOnLib("CHAOS")
\ No newline at end of file
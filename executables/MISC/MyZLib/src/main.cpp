@@ -81,6 +81,107 @@ void TestFromFile()
 	}
 }
 
+// compress with zlib (window_bits = 15) or gzip (window_bits = 15 + 16) headers
+std::vector<unsigned char> Deflate(chaos::Buffer<char> const & src, int window_bits)
+{
+	z_stream strm = {};
+	if (deflateInit2(&strm, Z_BEST_COMPRESSION, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		return {};
+
+	std::vector<unsigned char> result(deflateBound(&strm, (uLong)src.bufsize));
+	strm.next_in = (Bytef *)src.data;
+	strm.avail_in = (uInt)src.bufsize;
+	strm.next_out = result.data();
+	strm.avail_out = (uInt)result.size();
+	int error = deflate(&strm, Z_FINISH);
+	result.resize(strm.total_out);
+	deflateEnd(&strm);
+	return (error == Z_STREAM_END) ? result : std::vector<unsigned char>();
+}
+
+// the same pipeline than TileLayer::DoLoadTileChunkFromBase64(...) : base64 is decoded by parts that are directly given to inflate
+std::vector<unsigned char> StreamDecode(char const * text, size_t chunk_size)
+{
+	std::vector<unsigned char> result;
+
+	// skip the heading non base64 characters (spaces and line returns)
+	while (*text != 0 && !chaos::MyBase64::IsBase64((unsigned char)*text))
+		++text;
+
+	std::vector<unsigned char> base64_buffer(chunk_size);
+	std::vector<unsigned char> output_buffer(chunk_size);
+
+	z_stream strm = {};
+	if (inflateInit2(&strm, 15 + 32) != Z_OK) // 15 + 32 : automatic zlib/gzip header detection
+		return result;
+
+	bool stream_end = false;
+	while (!stream_end)
+	{
+		size_t size = chaos::MyBase64::DecodePart(text, base64_buffer.data(), chunk_size);
+		if (size == 0)
+			break;
+
+		strm.avail_in = (uInt)size;
+		strm.next_in = base64_buffer.data();
+		do
+		{
+			strm.avail_out = (uInt)chunk_size;
+			strm.next_out = output_buffer.data();
+
+			int error = inflate(&strm, Z_NO_FLUSH);
+			assert(error == Z_OK || error == Z_STREAM_END || error == Z_BUF_ERROR);
+			result.insert(result.end(), output_buffer.data(), output_buffer.data() + (chunk_size - strm.avail_out));
+			if (error == Z_STREAM_END)
+			{
+				stream_end = true;
+				break;
+			}
+		}
+		while (strm.avail_out == 0 || strm.avail_in > 0);
+	}
+	inflateEnd(&strm);
+	assert(stream_end);
+	return result;
+}
+
+void TestStreamingDecode(chaos::Buffer<char> initial_buffer, char const * title)
+{
+	for (int window_bits : {15, 15 + 16}) // zlib and gzip
+	{
+		std::vector<unsigned char> compressed = Deflate(initial_buffer, window_bits);
+		assert(compressed.size() > 0);
+
+		// the text as it appears in a TMX file
+		std::string text = "\n   " + chaos::MyBase64().Encode(chaos::Buffer<char>((char *)compressed.data(), compressed.size())) + "\n  ";
+
+		// base64 decoded by parts is the same than base64 decoded at once
+		for (size_t chunk_size : {3, 7, 64, 1000, 1024 * 12})
+		{
+			chaos::Buffer<char> reference = chaos::MyBase64().Decode(text.c_str() + 4);
+
+			std::vector<unsigned char> decoded;
+			std::vector<unsigned char> part(chunk_size);
+			char const * src = text.c_str() + 4;
+			while (size_t size = chaos::MyBase64::DecodePart(src, part.data(), chunk_size))
+				decoded.insert(decoded.end(), part.data(), part.data() + size);
+
+			assert(decoded.size() == reference.bufsize);
+			assert(memcmp(decoded.data(), reference.data, decoded.size()) == 0);
+			assert(decoded == compressed);
+		}
+
+		// whole pipeline, with small chunks (many inflate calls) and big ones
+		for (size_t chunk_size : {3, 7, 64, 1000, 1024 * 12})
+		{
+			std::vector<unsigned char> uncompressed = StreamDecode(text.c_str(), chunk_size);
+			assert(uncompressed.size() == initial_buffer.bufsize);
+			assert(memcmp(uncompressed.data(), initial_buffer.data, uncompressed.size()) == 0);
+		}
+	}
+	chaos::Log::Message("Streaming decode %s : 1", title);
+}
+
 class MyApplication : public chaos::Application
 {
 protected:
@@ -95,6 +196,10 @@ protected:
 
 		TestFromFile();
 
+		TestStreamingDecode(GenerateRandomBuffer(), "Random text");
+
+		TestStreamingDecode(GetIpsumBuffer(), "Ipsum text");
+
 		chaos::WinTools::PressToContinue();
 
 		return 0;
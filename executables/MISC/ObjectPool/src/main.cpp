@@ -0,0 +1,182 @@
+#include "chaos/Chaos.h"
+
+// an object that counts its constructions and destructions
+template<size_t SIZE>
+class TrackedObject
+{
+public:
+
+	TrackedObject(int in_value) : value(in_value) { ++live_count; }
+
+	~TrackedObject() { --live_count; }
+
+	int value = 0;
+
+	char padding[SIZE] = {};
+
+	static inline int live_count = 0;
+};
+
+// allocate, free in random order and allocate again : every object must be found in the pool and destroyed once
+template<typename T>
+void TestAllocateFree(char const* name, size_t count)
+{
+	{
+		chaos::ObjectPool<T> pool;
+
+		std::vector<T*> objects;
+		for (size_t i = 0; i < count; ++i)
+		{
+			T* object = pool.Allocate(int(i));
+			assert(object != nullptr);
+			assert(object->value == int(i));
+			objects.push_back(object);
+		}
+		assert(T::live_count == int(count));
+
+		// the objects do not overlap
+		std::vector<T*> sorted_objects = objects;
+		std::sort(sorted_objects.begin(), sorted_objects.end());
+		for (size_t i = 1; i < sorted_objects.size(); ++i)
+			assert((char*)sorted_objects[i] >= (char*)sorted_objects[i - 1] + sizeof(T));
+
+		// free half of the objects in random order (nodes move between the full, partially used and unused lists)
+		std::shuffle(objects.begin(), objects.end(), std::mt19937(12345));
+		for (size_t i = 0; i < count / 2; ++i)
+			pool.Free(objects[i]);
+		objects.erase(objects.begin(), objects.begin() + count / 2);
+		assert(T::live_count == int(objects.size()));
+
+		// the remaining objects are untouched
+		size_t visited_count = 0;
+		pool.ForEachObject([&visited_count](T* object)
+		{
+			++visited_count;
+		});
+		assert(visited_count == objects.size());
+		for (T* object : objects)
+			assert(std::find(sorted_objects.begin(), sorted_objects.end(), object) != sorted_objects.end());
+
+		// allocate again (the freed slots are reused before any new node)
+		for (size_t i = 0; i < count / 2; ++i)
+			objects.push_back(pool.Allocate(int(i)));
+		assert(T::live_count == int(count));
+
+		// free everything except a few objects : the destructor of the pool destroys them
+		pool.FreeN(objects.data(), objects.size() - 3);
+		assert(T::live_count == 3);
+	}
+	assert(T::live_count == 0);
+
+	chaos::Log::Message("%s (%d objects) : OK", name, int(count));
+}
+
+void TestBulk()
+{
+	using T = TrackedObject<4>;
+
+	chaos::ObjectPool<T> pool;
+
+	std::vector<T*> objects(1000, nullptr);
+	size_t allocated = pool.AllocateN(objects.data(), objects.size(), 7);
+	assert(allocated == objects.size());
+	for (T* object : objects)
+		assert(object != nullptr && object->value == 7);
+	assert(T::live_count == 1000);
+
+	pool.FreeN(objects.data(), objects.size());
+	assert(T::live_count == 0);
+
+	pool.FreeN(nullptr, 0);
+	assert(pool.AllocateN(nullptr, 0, 0) == 0);
+
+	chaos::Log::Message("AllocateN/FreeN : OK");
+}
+
+void TestUnusedNodes()
+{
+	using T = TrackedObject<4>;
+
+	chaos::ObjectPool<T> pool;
+	pool.SetMaxUnusedNodeCount(0); // empty nodes are deleted immediately
+	assert(pool.GetMaxUnusedNodeCount() == 0);
+
+	std::vector<T*> objects(64 * 10, nullptr);
+	pool.AllocateN(objects.data(), objects.size(), 0);
+	pool.FreeN(objects.data(), objects.size());
+	assert(T::live_count == 0);
+
+	// the pool is still usable
+	T* object = pool.Allocate(3);
+	assert(object != nullptr && object->value == 3);
+	pool.Free(object);
+
+	pool.SetMaxUnusedNodeCount(std::nullopt);
+	pool.AllocateN(objects.data(), objects.size(), 0);
+	pool.FreeN(objects.data(), objects.size());
+	pool.SetMaxUnusedNodeCount(1); // trims the unused nodes that are kept
+	assert(T::live_count == 0);
+
+	chaos::Log::Message("Unused nodes : OK");
+}
+
+// allocate then free (in random order) with an allocator
+template<typename ALLOCATOR>
+double BenchmarkAllocator(size_t count, std::vector<size_t> const& free_order)
+{
+	ALLOCATOR allocator;
+
+	std::vector<typename ALLOCATOR::type*> objects(count, nullptr);
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < count; ++i)
+		objects[i] = allocator.Allocate(int(i));
+	for (size_t index : free_order)
+		allocator.Free(objects[index]);
+	auto t1 = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+void Benchmark(size_t count)
+{
+	using T = TrackedObject<32>;
+
+	std::vector<size_t> free_order(count);
+	for (size_t i = 0; i < count; ++i)
+		free_order[i] = i;
+	std::shuffle(free_order.begin(), free_order.end(), std::mt19937(54321));
+
+	double standard_duration = BenchmarkAllocator<chaos::StandardAllocator<T>>(count, free_order);
+	double pool_duration = BenchmarkAllocator<chaos::ObjectPool<T>>(count, free_order);
+
+	chaos::Log::Message("%d objects allocated then freed", int(count));
+	chaos::Log::Message("  StandardAllocator : %f ms", standard_duration);
+	chaos::Log::Message("  ObjectPool        : %f ms", pool_duration);
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	virtual int Main() override
+	{
+		TestAllocateFree<TrackedObject<1>>("small objects", 10000);
+		TestAllocateFree<TrackedObject<200>>("large objects", 10000);
+		TestAllocateFree<TrackedObject<4000>>("huge objects", 300);
+		TestBulk();
+		TestUnusedNodes();
+
+		Benchmark(1000);
+		Benchmark(100000);
+		Benchmark(1000000);
+
+		chaos::WinTools::PressToContinue();
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
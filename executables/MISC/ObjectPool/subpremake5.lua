@@ -0,0 +1,6 @@
+-- =============================================================================
+-- ROOT_PATH/executables/MISC/ObjectPool
+-- =============================================================================
+
+local project = build:WindowedApp()
+project:DependOnLib("CHAOS")
\ No newline at end of file
@@ -0,0 +1,185 @@
+#include "chaos/Chaos.h"
+
+// ==============================================================
+// the particle (same data for both storages)
+// ==============================================================
+
+class SmokeParticle : public chaos::ParticleDefault
+{
+public:
+
+	glm::vec2 velocity = { 0.0f, 0.0f };
+	float age = 0.0f;
+	float lifetime = 1.0f;
+};
+
+CHAOS_REGISTER_CLASS(SmokeParticle, chaos::ParticleDefault);
+
+// ==============================================================
+// array of structures : one particle at a time
+// ==============================================================
+
+class SmokeAoSLayerTrait : public chaos::ParticleLayerTrait<SmokeParticle, chaos::VertexDefault>
+{
+public:
+
+	bool UpdateParticle(float delta_time, SmokeParticle& particle) const
+	{
+		particle.age += delta_time;
+		if (particle.age > particle.lifetime)
+			return true;
+		particle.bounding_box.position += particle.velocity * delta_time;
+		return false;
+	}
+
+	void ParticleToPrimitives(SmokeParticle const& particle, chaos::PrimitiveOutput<chaos::VertexDefault>& output) const
+	{
+		chaos::ParticleToPrimitives(particle, output);
+	}
+};
+
+// ==============================================================
+// structure of arrays : each member is updated in its own array
+// ==============================================================
+
+class SmokeSoALayerTrait : public chaos::ParticleLayerTrait<SmokeParticle, chaos::VertexDefault>
+{
+public:
+
+	using SoAFields = chaos::ParticleSoAFields<&SmokeParticle::bounding_box, &SmokeParticle::texcoords, &SmokeParticle::color, &SmokeParticle::velocity, &SmokeParticle::age, &SmokeParticle::lifetime>;
+
+	void UpdateParticleArrays(float delta_time, chaos::ParticleSoAAccessor<SmokeParticle, SoAFields> particles, uint8_t* destroyed_particles) const
+	{
+		size_t count = particles.GetDataCount();
+
+		float* age = particles.GetField<&SmokeParticle::age>();
+		float const* lifetime = particles.GetField<&SmokeParticle::lifetime>();
+		for (size_t i = 0; i < count; ++i)
+		{
+			age[i] += delta_time;
+			destroyed_particles[i] = (age[i] > lifetime[i]);
+		}
+
+		chaos::box2* bounding_box = particles.GetField<&SmokeParticle::bounding_box>();
+		glm::vec2 const* velocity = particles.GetField<&SmokeParticle::velocity>();
+		for (size_t i = 0; i < count; ++i)
+			bounding_box[i].position += velocity[i] * delta_time;
+	}
+
+	void ParticleArraysToPrimitives(chaos::ParticleSoAConstAccessor<SmokeParticle, SoAFields> particles, chaos::PrimitiveOutput<chaos::VertexDefault>& output) const
+	{
+		size_t count = particles.GetDataCount();
+		for (size_t i = 0; i < count; ++i)
+			chaos::ParticleToPrimitives(SmokeParticle(particles[i]), output);
+	}
+};
+
+// ==============================================================
+// tests
+// ==============================================================
+
+SmokeParticle MakeParticle(size_t index)
+{
+	SmokeParticle result;
+	result.bounding_box.position = { float(index % 1000), float(index / 1000) };
+	result.bounding_box.half_size = { 0.5f, 0.5f };
+	result.velocity = { chaos::MathTools::RandFloat(-1.0f, 1.0f), chaos::MathTools::RandFloat(-1.0f, 1.0f) };
+	result.lifetime = (index % 10 == 0) ? 0.5f : 1000.0f; // some particles are destroyed
+	return result;
+}
+
+void TestSoAReference()
+{
+	chaos::shared_ptr<chaos::ParticleLayer<SmokeSoALayerTrait>> layer = new chaos::ParticleLayer<SmokeSoALayerTrait>();
+	layer->SpawnParticles(4, true);
+
+	auto* allocation = static_cast<chaos::ParticleAllocation<SmokeSoALayerTrait>*>(layer->GetAllocation(0));
+	assert(allocation != nullptr);
+	assert(allocation->HasSoAStorage());
+	assert(allocation->GetParticleBuffer() == nullptr);
+
+	auto accessor = allocation->GetSoAAccessor();
+	assert(accessor.GetDataCount() == 4);
+
+	// writes through a reference go into the arrays
+	accessor[1].Get<&SmokeParticle::age>() = 3.0f;
+	assert(accessor.GetField<&SmokeParticle::age>()[1] == 3.0f);
+
+	// scatter then gather
+	SmokeParticle p = MakeParticle(42);
+	accessor[2] = p;
+	SmokeParticle q = accessor[2];
+	assert(q.bounding_box.position == p.bounding_box.position);
+	assert(q.velocity == p.velocity);
+	assert(q.lifetime == p.lifetime);
+
+	// copy between references
+	accessor[3] = accessor[2];
+	assert(accessor.GetField<&SmokeParticle::velocity>()[3] == p.velocity);
+}
+
+template<typename LAYER_TRAIT, typename INIT_FUNC>
+double BenchmarkLayer(size_t particle_count, int tick_count, INIT_FUNC init_func, size_t & remaining_particles)
+{
+	chaos::shared_ptr<chaos::ParticleLayer<LAYER_TRAIT>> layer = new chaos::ParticleLayer<LAYER_TRAIT>();
+	layer->SpawnParticles(particle_count, true);
+
+	auto* allocation = static_cast<chaos::ParticleAllocation<LAYER_TRAIT>*>(layer->GetAllocation(0));
+	assert(allocation != nullptr);
+	init_func(allocation);
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (int i = 0; i < tick_count; ++i)
+		layer->Tick(1.0f / 60.0f);
+	auto t1 = std::chrono::steady_clock::now();
+
+	remaining_particles = allocation->GetParticleCount();
+	return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+void TestBenchmark(size_t particle_count, int tick_count)
+{
+	size_t aos_remaining = 0;
+	double aos_duration = BenchmarkLayer<SmokeAoSLayerTrait>(particle_count, tick_count, [](auto* allocation)
+	{
+		chaos::ParticleAccessor<SmokeParticle> accessor = allocation->GetParticleAccessor<SmokeParticle>();
+		for (size_t i = 0; i < accessor.GetDataCount(); ++i)
+			accessor[i] = MakeParticle(i);
+	}, aos_remaining);
+
+	size_t soa_remaining = 0;
+	double soa_duration = BenchmarkLayer<SmokeSoALayerTrait>(particle_count, tick_count, [](auto* allocation)
+	{
+		auto accessor = allocation->GetSoAAccessor();
+		for (size_t i = 0; i < accessor.GetDataCount(); ++i)
+			accessor[i] = MakeParticle(i);
+	}, soa_remaining);
+
+	// both storages destroy the same particles
+	assert(aos_remaining == soa_remaining);
+
+	chaos::Log::Message("%d particles, %d ticks (%d remaining)", int(particle_count), tick_count, int(aos_remaining));
+	chaos::Log::Message("  array of structures : %f ms", aos_duration);
+	chaos::Log::Message("  structure of arrays : %f ms", soa_duration);
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	virtual int Main() override
+	{
+		TestSoAReference();
+		TestBenchmark(10000, 100);
+		TestBenchmark(100000, 100);
+		TestBenchmark(1000000, 20);
+
+		chaos::WinTools::PressToContinue();
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
@@ -0,0 +1,202 @@
+#include "chaos/Chaos.h"
+
+// the widths to test : around the vector sizes (4, 8, 16, 32 pixels) so that every tail is used
+static int const widths[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 255, 257, 1023 };
+// the offsets (in pixels) of the rows inside their buffers, so that they are not aligned
+static int const offsets[] = { 0, 1, 2, 3 };
+// the number of guard pixels after the rows (they must be left untouched)
+static int const guard_count = 8;
+
+static char const* GetInstructionSetName(chaos::PixelKernelInstructionSet instruction_set)
+{
+	switch (instruction_set)
+	{
+	case chaos::PixelKernelInstructionSet::SSE2: return "SSE2";
+	case chaos::PixelKernelInstructionSet::AVX2: return "AVX2";
+	default: return "SCALAR";
+	}
+}
+
+// fill pixels with random bytes
+template<typename PIXEL_TYPE>
+void FillRandom(std::vector<PIXEL_TYPE>& pixels)
+{
+	unsigned char* bytes = (unsigned char*)pixels.data();
+	for (size_t i = 0; i < pixels.size() * sizeof(PIXEL_TYPE); ++i)
+		bytes[i] = (unsigned char)(rand() & 0xFF);
+}
+
+// fill pixels with random floats, some above 1, some on the rounding boundaries (a negative float has no defined conversion into a byte for the scalar path)
+template<typename PIXEL_TYPE>
+void FillRandomFloat(std::vector<PIXEL_TYPE>& pixels)
+{
+	static_assert(sizeof(PIXEL_TYPE) % sizeof(float) == 0);
+
+	float* values = (float*)pixels.data();
+	for (size_t i = 0; i < pixels.size() * sizeof(PIXEL_TYPE) / sizeof(float); ++i)
+	{
+		switch (rand() % 4)
+		{
+		case 0: values[i] = chaos::MathTools::RandFloat(0.0f, 1.25f); break;
+		case 1: values[i] = float(rand() % 256) / 255.0f; break;
+		case 2: values[i] = (float(rand() % 256) + 0.5f) / 255.0f; break;
+		default: values[i] = chaos::MathTools::RandFloat(); break;
+		}
+	}
+}
+
+// run a row function with every instruction set and compare with the scalar one
+template<typename DST_PIXEL, typename SRC_PIXEL, typename FILL_FUNC, typename ROW_FUNC>
+void TestRowFunction(char const* name, FILL_FUNC fill_func, ROW_FUNC row_func)
+{
+	chaos::PixelKernelInstructionSet best = chaos::PixelKernels::GetBestInstructionSet();
+
+	for (int width : widths)
+	{
+		for (int offset : offsets)
+		{
+			std::vector<SRC_PIXEL> src(offset + width + guard_count);
+			fill_func(src);
+
+			// the reference
+			std::vector<DST_PIXEL> expected(offset + width + guard_count);
+			FillRandom(expected);
+			std::vector<DST_PIXEL> initial = expected;
+
+			chaos::PixelKernels::SetInstructionSet(chaos::PixelKernelInstructionSet::SCALAR);
+			row_func(expected.data() + offset, src.data() + offset, width);
+
+			for (int instruction_set = int(chaos::PixelKernelInstructionSet::SSE2); instruction_set <= int(best); ++instruction_set)
+			{
+				chaos::PixelKernels::SetInstructionSet(chaos::PixelKernelInstructionSet(instruction_set));
+				assert(chaos::PixelKernels::GetInstructionSet() == chaos::PixelKernelInstructionSet(instruction_set));
+
+				std::vector<DST_PIXEL> result = initial; // same guards than the reference
+				row_func(result.data() + offset, src.data() + offset, width);
+				assert(memcmp(result.data(), expected.data(), result.size() * sizeof(DST_PIXEL)) == 0);
+			}
+			// the pixels out of the row are untouched
+			assert(memcmp(expected.data(), initial.data(), offset * sizeof(DST_PIXEL)) == 0);
+			assert(memcmp(expected.data() + offset + width, initial.data() + offset + width, guard_count * sizeof(DST_PIXEL)) == 0);
+		}
+	}
+	chaos::PixelKernels::SetInstructionSet(best);
+
+	chaos::Log::Message("%s : OK", name);
+}
+
+// compare the scalar path with PixelConverter, pixel by pixel
+template<typename DST_PIXEL, typename SRC_PIXEL, typename FILL_FUNC>
+void TestConverter(char const* name, FILL_FUNC fill_func)
+{
+	std::vector<SRC_PIXEL> src(257);
+	fill_func(src);
+
+	std::vector<DST_PIXEL> expected(src.size());
+	for (size_t i = 0; i < src.size(); ++i)
+		chaos::PixelConverter::Convert(expected[i], src[i]);
+
+	chaos::PixelKernelInstructionSet best = chaos::PixelKernels::GetBestInstructionSet();
+	for (int instruction_set = int(chaos::PixelKernelInstructionSet::SCALAR); instruction_set <= int(best); ++instruction_set)
+	{
+		chaos::PixelKernels::SetInstructionSet(chaos::PixelKernelInstructionSet(instruction_set));
+
+		std::vector<DST_PIXEL> result(src.size());
+		chaos::PixelKernels::ConvertRow(result.data(), src.data(), int(src.size()));
+		assert(memcmp(result.data(), expected.data(), result.size() * sizeof(DST_PIXEL)) == 0);
+	}
+	chaos::PixelKernels::SetInstructionSet(best);
+
+	chaos::Log::Message("%s same as PixelConverter : OK", name);
+}
+
+void TestInstructionSet()
+{
+	chaos::PixelKernelInstructionSet best = chaos::PixelKernels::GetBestInstructionSet();
+	assert(chaos::PixelKernels::GetInstructionSet() == best); // the default one
+
+	// clamped to what the CPU supports
+	chaos::PixelKernels::SetInstructionSet(chaos::PixelKernelInstructionSet::AVX2);
+	assert(chaos::PixelKernels::GetInstructionSet() == best);
+
+	chaos::PixelKernels::SetInstructionSet(chaos::PixelKernelInstructionSet::SCALAR);
+	assert(chaos::PixelKernels::GetInstructionSet() == chaos::PixelKernelInstructionSet::SCALAR);
+
+	chaos::PixelKernels::SetInstructionSet(best);
+
+	chaos::Log::Message("Best instruction set : %s", GetInstructionSetName(best));
+}
+
+// the duration of the conversion of rows with each instruction set
+template<typename DST_PIXEL, typename SRC_PIXEL, typename FILL_FUNC>
+void BenchmarkConversion(char const* name, FILL_FUNC fill_func)
+{
+	int const width = 4096;
+	int const row_count = 2048;
+
+	std::vector<SRC_PIXEL> src(width);
+	fill_func(src);
+	std::vector<DST_PIXEL> dst(width);
+
+	chaos::PixelKernelInstructionSet best = chaos::PixelKernels::GetBestInstructionSet();
+	for (int instruction_set = int(chaos::PixelKernelInstructionSet::SCALAR); instruction_set <= int(best); ++instruction_set)
+	{
+		chaos::PixelKernels::SetInstructionSet(chaos::PixelKernelInstructionSet(instruction_set));
+
+		auto t0 = std::chrono::steady_clock::now();
+		for (int i = 0; i < row_count; ++i)
+			chaos::PixelKernels::ConvertRow(dst.data(), src.data(), width);
+		auto t1 = std::chrono::steady_clock::now();
+
+		chaos::Log::Message("%s %s : %f ms", name, GetInstructionSetName(chaos::PixelKernelInstructionSet(instruction_set)), std::chrono::duration<double, std::milli>(t1 - t0).count());
+	}
+	chaos::PixelKernels::SetInstructionSet(best);
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	virtual int Main() override
+	{
+		auto fill = [](auto& pixels) { FillRandom(pixels); };
+		auto fill_float = [](auto& pixels) { FillRandomFloat(pixels); };
+		auto convert = [](auto* dst, auto const* src, int count) { chaos::PixelKernels::ConvertRow(dst, src, count); };
+
+		TestInstructionSet();
+
+		TestRowFunction<chaos::PixelBGRA, chaos::PixelBGR>("BGR to BGRA", fill, convert);
+		TestRowFunction<chaos::PixelBGR, chaos::PixelBGRA>("BGRA to BGR", fill, convert);
+		TestRowFunction<chaos::PixelBGRA, chaos::PixelGray>("Gray to BGRA", fill, convert);
+		TestRowFunction<chaos::PixelBGRA, chaos::PixelRGBAFloat>("RGBAFloat to BGRA", fill_float, convert);
+		TestRowFunction<chaos::PixelGray, chaos::PixelGrayFloat>("GrayFloat to Gray", fill_float, convert);
+
+		TestRowFunction<chaos::PixelBGRA, chaos::PixelBGRA>("ReverseCopyRow", fill, [](chaos::PixelBGRA* dst, chaos::PixelBGRA const* src, int count)
+		{
+			chaos::PixelKernels::ReverseCopyRow(dst, src, count);
+		});
+		TestRowFunction<chaos::PixelBGRA, chaos::PixelBGRA>("ReverseRow", fill, [](chaos::PixelBGRA* dst, chaos::PixelBGRA const* src, int count)
+		{
+			for (int i = 0; i < count; ++i) // the row is reversed in place
+				dst[i] = src[i];
+			chaos::PixelKernels::ReverseRow(dst, count);
+		});
+
+		TestConverter<chaos::PixelBGRA, chaos::PixelBGR>("BGR to BGRA", fill);
+		TestConverter<chaos::PixelBGR, chaos::PixelBGRA>("BGRA to BGR", fill);
+		TestConverter<chaos::PixelBGRA, chaos::PixelGray>("Gray to BGRA", fill);
+		TestConverter<chaos::PixelBGRA, chaos::PixelRGBAFloat>("RGBAFloat to BGRA", fill_float);
+		TestConverter<chaos::PixelGray, chaos::PixelGrayFloat>("GrayFloat to Gray", fill_float);
+
+		BenchmarkConversion<chaos::PixelBGRA, chaos::PixelBGR>("BGR to BGRA", fill);
+		BenchmarkConversion<chaos::PixelBGRA, chaos::PixelRGBAFloat>("RGBAFloat to BGRA", fill_float);
+
+		chaos::WinTools::PressToContinue();
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
@@ -0,0 +1,6 @@
+-- =============================================================================
+-- ROOT_PATH/executables/MISC/PixelKernels
+-- =============================================================================
+
+local project = build:WindowedApp()
+project:DependOnLib("CHAOS")
@@ -0,0 +1,146 @@
+#include "chaos/Chaos.h"
+
+// generate a map of tiles (some cells are empty)
+std::vector<chaos::box2> GenerateTiles(int width, int height, float tile_size)
+{
+	std::vector<chaos::box2> result;
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			if (rand() % 4 == 0)
+				continue;
+			chaos::box2 b;
+			b.position = { (float(x) + 0.5f) * tile_size, (float(y) + 0.5f) * tile_size };
+			b.half_size = { 0.5f * tile_size, 0.5f * tile_size };
+			result.push_back(b);
+		}
+	}
+	return result;
+}
+
+// generate the pawn-sized boxes to query
+std::vector<chaos::box2> GenerateQueries(size_t count, glm::vec2 const& map_size, float tile_size)
+{
+	std::vector<chaos::box2> result;
+	for (size_t i = 0; i < count; ++i)
+	{
+		chaos::box2 b;
+		b.position = { chaos::MathTools::RandFloat() * map_size.x, chaos::MathTools::RandFloat() * map_size.y };
+		b.half_size = { tile_size * chaos::MathTools::RandFloat(0.5f, 2.0f), tile_size * chaos::MathTools::RandFloat(0.5f, 2.0f) };
+		result.push_back(b);
+	}
+	return result;
+}
+
+// the former path : every tile is tested
+void QueryBruteForce(std::vector<chaos::box2> const& tiles, chaos::box2 const& query, std::vector<uint64_t>& result)
+{
+	result.clear();
+	for (size_t i = 0; i < tiles.size(); ++i)
+		if (chaos::Collide(query, tiles[i], false))
+			result.push_back(chaos::TMSpatialIndex::MakeParticleKey(0, i));
+}
+
+// the indexed path : only the candidates are tested
+void QueryGrid(chaos::TMSpatialGrid const& grid, std::vector<chaos::box2> const& tiles, chaos::box2 const& query, std::vector<uint64_t>& candidates, std::vector<uint64_t>& result)
+{
+	result.clear();
+	candidates.clear();
+	grid.Query(query, candidates);
+	for (uint64_t key : candidates)
+		if (chaos::Collide(query, tiles[chaos::TMSpatialIndex::GetParticleIndex(key)], false))
+			result.push_back(key);
+}
+
+void TestRevision()
+{
+	chaos::shared_ptr<chaos::ParticleLayerBase> layer = new chaos::ParticleLayer<chaos::TMParticleLayerTrait>();
+
+	uint64_t revision = layer->GetContentRevision();
+	chaos::SpawnParticleResult spawn = layer->SpawnParticles(10, true);
+	assert(layer->GetContentRevision() != revision); // allocation added and resized
+
+	chaos::ParticleAllocationBase* allocation = layer->GetAllocation(0);
+	assert(allocation != nullptr);
+
+	// reading (or getting a mutable accessor) does not invalidate the index
+	revision = layer->GetContentRevision();
+	chaos::ParticleAccessor<chaos::TMParticle> accessor = allocation->GetParticleAccessor<chaos::TMParticle>();
+	assert(accessor.GetDataCount() == 10);
+	std::as_const(*allocation).GetParticleAccessor(0, 0);
+	layer->Tick(0.1f);
+	assert(layer->GetContentRevision() == revision);
+
+	// explicit writes do
+	accessor[0].bounding_box.position = { 10.0f, 10.0f };
+	allocation->NotifyParticlesChanged();
+	assert(layer->GetContentRevision() != revision);
+
+	revision = layer->GetContentRevision();
+	allocation->Resize(5);
+	assert(layer->GetContentRevision() != revision);
+}
+
+void TestQueries(int width, int height)
+{
+	float const tile_size = 32.0f;
+	float const cell_size = 4.0f * tile_size;
+
+	std::vector<chaos::box2> tiles = GenerateTiles(width, height, tile_size);
+	std::vector<chaos::box2> queries = GenerateQueries(1000, { float(width) * tile_size, float(height) * tile_size }, tile_size);
+
+	auto t0 = std::chrono::steady_clock::now();
+
+	chaos::TMSpatialGrid grid;
+	grid.Clear(cell_size);
+	for (size_t i = 0; i < tiles.size(); ++i)
+		grid.Insert(tiles[i], chaos::TMSpatialIndex::MakeParticleKey(0, i));
+
+	auto t1 = std::chrono::steady_clock::now();
+
+	std::vector<std::vector<uint64_t>> brute_results(queries.size());
+	for (size_t i = 0; i < queries.size(); ++i)
+		QueryBruteForce(tiles, queries[i], brute_results[i]);
+
+	auto t2 = std::chrono::steady_clock::now();
+
+	std::vector<uint64_t> candidates;
+	std::vector<std::vector<uint64_t>> grid_results(queries.size());
+	for (size_t i = 0; i < queries.size(); ++i)
+		QueryGrid(grid, tiles, queries[i], candidates, grid_results[i]);
+
+	auto t3 = std::chrono::steady_clock::now();
+
+	// same results in the same order
+	for (size_t i = 0; i < queries.size(); ++i)
+		assert(brute_results[i] == grid_results[i]);
+
+	auto ms = [](auto d) { return std::chrono::duration<double, std::milli>(d).count(); };
+
+	chaos::Log::Message("Map %dx%d : %d tiles, %d queries", width, height, int(tiles.size()), int(queries.size()));
+	chaos::Log::Message("  build grid  : %f ms (%d cells)", ms(t1 - t0), int(grid.GetCellCount()));
+	chaos::Log::Message("  brute force : %f ms", ms(t2 - t1));
+	chaos::Log::Message("  grid        : %f ms", ms(t3 - t2));
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	virtual int Main() override
+	{
+		TestRevision();
+		TestQueries(50, 50);
+		TestQueries(200, 200);
+		TestQueries(500, 500);
+
+		chaos::WinTools::PressToContinue();
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
@@ -0,0 +1,127 @@
+#include "chaos/Chaos.h"
+
+// the asynchronous texture loading decodes the files on workers : everything here is done without any GL context
+
+// encode a bitmap into a file format in memory
+chaos::Buffer<char> EncodeImage(FIBITMAP* bitmap, FREE_IMAGE_FORMAT format)
+{
+	chaos::Buffer<char> result;
+
+	FIMEMORY* memory = FreeImage_OpenMemory();
+	if (memory == nullptr)
+		return result;
+	if (FreeImage_SaveToMemory(format, bitmap, memory, 0))
+	{
+		BYTE* data = nullptr;
+		DWORD size = 0;
+		if (FreeImage_AcquireMemory(memory, &data, &size))
+		{
+			result = chaos::SharedBufferPolicy<char>::NewBuffer(size);
+			memcpy(result.data, data, size);
+		}
+	}
+	FreeImage_CloseMemory(memory);
+	return result;
+}
+
+// generate an image whose pixels all differ
+template<typename PIXEL_TYPE>
+FIBITMAP* GenerateImage(int width, int height)
+{
+	return chaos::ImageTools::GenFreeImage<PIXEL_TYPE>(width, height, [](chaos::ImageDescription& desc)
+	{
+		unsigned char* data = (unsigned char*)desc.data;
+		for (int j = 0; j < desc.height; ++j)
+			for (int i = 0; i < desc.line_size; ++i)
+				data[j * desc.pitch_size + i] = (unsigned char)((i * 7 + j * 13) & 0xFF);
+	});
+}
+
+// compare the pixels (not the padding)
+bool SamePixels(chaos::ImageDescription const& src, chaos::ImageDescription const& dst)
+{
+	if (src.width != dst.width || src.height != dst.height || src.pixel_format != dst.pixel_format || src.line_size != dst.line_size)
+		return false;
+	for (int j = 0; j < src.height; ++j)
+		if (memcmp((char const*)src.data + j * src.pitch_size, (char const*)dst.data + j * dst.pitch_size, src.line_size) != 0)
+			return false;
+	return true;
+}
+
+template<typename PIXEL_TYPE>
+void TestDecode(int width, int height, FREE_IMAGE_FORMAT format, char const* format_name)
+{
+	FIBITMAP* bitmap = GenerateImage<PIXEL_TYPE>(width, height);
+	assert(bitmap != nullptr);
+
+	chaos::Buffer<char> buffer = EncodeImage(bitmap, format);
+	assert(buffer != nullptr);
+
+	chaos::GPUTextureDecodedImage decoded_image;
+	bool decoded = decoded_image.Decode(buffer);
+	assert(decoded);
+	assert(decoded_image.IsValid());
+
+	// rows ready for GL
+	chaos::ImageDescription const& image = decoded_image.GetImageDescription();
+	assert(image.pitch_size % 4 == 0);
+	assert(SamePixels(chaos::ImageTools::GetImageDescription(bitmap), image));
+
+	// the pixels move with the object
+	chaos::GPUTextureDecodedImage other_image = std::move(decoded_image);
+	assert(!decoded_image.IsValid());
+	assert(other_image.IsValid());
+	assert(SamePixels(chaos::ImageTools::GetImageDescription(bitmap), other_image.GetImageDescription()));
+
+	other_image.Release();
+	assert(!other_image.IsValid());
+
+	FreeImage_Unload(bitmap);
+
+	chaos::Log::Message("Decode %s %dx%d (%d bytes) : OK", format_name, width, height, int(buffer.bufsize));
+}
+
+void TestNotAnImage()
+{
+	// a JSON description (skybox ...) is not decoded : the synchronous loader takes it
+	char const* text = "{ \"left\" : \"left.png\" }";
+
+	chaos::Buffer<char> buffer = chaos::SharedBufferPolicy<char>::NewBuffer(strlen(text));
+	memcpy(buffer.data, text, buffer.bufsize);
+
+	chaos::GPUTextureDecodedImage decoded_image;
+	bool decoded = decoded_image.Decode(buffer);
+	assert(!decoded);
+	assert(!decoded_image.IsValid());
+
+	// an empty buffer
+	decoded = decoded_image.Decode(chaos::Buffer<char>());
+	assert(!decoded);
+	assert(!decoded_image.IsValid());
+
+	chaos::Log::Message("Not an image : OK");
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	virtual int Main() override
+	{
+		// odd widths so that the rows are padded
+		TestDecode<chaos::PixelBGRA>(64, 32, FIF_PNG, "PNG");
+		TestDecode<chaos::PixelBGR>(13, 7, FIF_PNG, "PNG");
+		TestDecode<chaos::PixelBGR>(13, 7, FIF_BMP, "BMP");
+		TestDecode<chaos::PixelGray>(17, 5, FIF_PNG, "PNG");
+		TestDecode<chaos::PixelBGRA>(1, 1, FIF_TARGA, "TGA");
+		TestNotAnImage();
+
+		chaos::WinTools::PressToContinue();
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
@@ -0,0 +1,23 @@
+<?xml version="1.0" encoding="UTF-8"?>
+<tileset version="1.5" tiledversion="1.5.0" name="tileset" tilewidth="32" tileheight="32" tilecount="2" columns="0" objectalignment="center">
+ <grid orientation="orthogonal" width="1" height="1"/>
+ <properties>
+  <property name="THEME" value="cave"/>
+ </properties>
+ <tile id="0" type="WALL">
+  <properties>
+   <property name="ObjectType" type="int" value="3"/>
+  </properties>
+  <image width="32" height="32" source="wall.png"/>
+ </tile>
+ <tile id="1" type="Diamond" probability="0.5">
+  <properties>
+   <property name="ObjectType" type="int" value="5"/>
+   <property name="SCORE" type="float" value="10"/>
+  </properties>
+  <image width="32" height="32" source="diamond.png"/>
+  <objectgroup draworder="index" id="2">
+   <object id="1" x="4" y="4" width="24" height="24"/>
+  </objectgroup>
+ </tile>
+</tileset>
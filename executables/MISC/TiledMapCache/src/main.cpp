@@ -0,0 +1,435 @@
+#include "chaos/Chaos.h"
+
+// the binary forms of the XML files (.tmb) in the cache directory
+std::vector<boost::filesystem::path> GetCacheEntries(boost::filesystem::path const& cache_directory)
+{
+	std::vector<boost::filesystem::path> result;
+
+	boost::system::error_code error_code;
+	for (boost::filesystem::directory_iterator it(cache_directory, error_code), end; !error_code && it != end; it.increment(error_code))
+		if (it->path().extension() == ".tmb")
+			result.push_back(it->path());
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+bool WriteFile(boost::filesystem::path const& path, char const* data, size_t size)
+{
+	std::ofstream stream(path.string().c_str(), std::ios::binary | std::ios::trunc);
+	if (!stream)
+		return false;
+	stream.write(data, std::streamsize(size));
+	return !stream.fail();
+}
+
+bool CopyFile(boost::filesystem::path const& src, boost::filesystem::path const& dst)
+{
+	chaos::Buffer<char> buffer = chaos::FileTools::LoadFile(src);
+	if (buffer == nullptr)
+		return false;
+	return WriteFile(dst, buffer.data, buffer.bufsize);
+}
+
+// ==========================================
+// compare the objects loaded from XML and from binary
+// ==========================================
+
+bool SameProperty(chaos::TiledMap::PropertyOwner const* owner1, chaos::TiledMap::PropertyOwner const* owner2, char const* name)
+{
+	chaos::TiledMap::Property const* property1 = owner1->FindInternalProperty(name, chaos::TiledMap::PropertyType::ANY);
+	chaos::TiledMap::Property const* property2 = owner2->FindInternalProperty(name, chaos::TiledMap::PropertyType::ANY);
+	if (property1 == nullptr || property2 == nullptr)
+		return (property1 == property2);
+	if (property1->GetPropertyType() != property2->GetPropertyType())
+		return false;
+
+	if (property1->IsPropertyInt())
+		return (*property1->GetPropertyInt() == *property2->GetPropertyInt());
+	if (property1->IsPropertyFloat())
+		return (*property1->GetPropertyFloat() == *property2->GetPropertyFloat());
+	if (property1->IsPropertyBool())
+		return (*property1->GetPropertyBool() == *property2->GetPropertyBool());
+	if (property1->IsPropertyString())
+		return (*property1->GetPropertyString() == *property2->GetPropertyString());
+	if (property1->IsPropertyColor())
+		return (*property1->GetPropertyColor() == *property2->GetPropertyColor());
+	if (property1->IsPropertyObject())
+		return (*property1->GetPropertyObject() == *property2->GetPropertyObject());
+	return false;
+}
+
+bool SameProperties(chaos::TiledMap::PropertyOwner const* owner1, chaos::TiledMap::PropertyOwner const* owner2, std::initializer_list<char const*> names)
+{
+	for (char const* name : names)
+		if (!SameProperty(owner1, owner2, name))
+			return false;
+	return true;
+}
+
+bool SameGeometricObject(chaos::TiledMap::GeometricObject const* object1, chaos::TiledMap::GeometricObject const* object2)
+{
+	if (typeid(*object1) != typeid(*object2))
+		return false;
+	if (object1->id != object2->id || object1->name != object2->name || object1->type != object2->type || object1->visible != object2->visible)
+		return false;
+	if (object1->position != object2->position || object1->rotation != object2->rotation)
+		return false;
+
+	chaos::box2 box1 = object1->GetBoundingBox(true);
+	chaos::box2 box2 = object2->GetBoundingBox(true);
+	if (box1.position != box2.position || box1.half_size != box2.half_size)
+		return false;
+
+	if (chaos::TiledMap::GeometricObjectPolyline const* polyline1 = auto_cast(object1))
+		if (chaos::TiledMap::GeometricObjectPolyline const* polyline2 = auto_cast(object2))
+			if (polyline1->points != polyline2->points)
+				return false;
+
+	if (chaos::TiledMap::GeometricObjectTile const* tile1 = auto_cast(object1))
+		if (chaos::TiledMap::GeometricObjectTile const* tile2 = auto_cast(object2))
+			if (tile1->gid != tile2->gid || tile1->particle_flags != tile2->particle_flags)
+				return false;
+
+	return SameProperties(object1, object2, { "LIFE" });
+}
+
+bool SameLayers(std::vector<chaos::shared_ptr<chaos::TiledMap::LayerBase>> const& layers1, std::vector<chaos::shared_ptr<chaos::TiledMap::LayerBase>> const& layers2);
+
+bool SameLayer(chaos::TiledMap::LayerBase const* layer1, chaos::TiledMap::LayerBase const* layer2)
+{
+	if (typeid(*layer1) != typeid(*layer2))
+		return false;
+	if (layer1->id != layer2->id || layer1->name != layer2->name || layer1->visible != layer2->visible || layer1->locked != layer2->locked)
+		return false;
+	if (layer1->opacity != layer2->opacity || layer1->offset != layer2->offset || layer1->parallax_factor != layer2->parallax_factor)
+		return false;
+	if (!SameProperties(layer1, layer2, { "COLLISION" }))
+		return false;
+
+	if (chaos::TiledMap::TileLayer const* tile_layer1 = auto_cast(layer1))
+	{
+		chaos::TiledMap::TileLayer const* tile_layer2 = auto_cast(layer2);
+		if (tile_layer1->size != tile_layer2->size || tile_layer1->tile_size != tile_layer2->tile_size || tile_layer1->tile_chunks.size() != tile_layer2->tile_chunks.size())
+			return false;
+		for (size_t i = 0; i < tile_layer1->tile_chunks.size(); ++i)
+		{
+			chaos::TiledMap::TileLayerChunk const& chunk1 = tile_layer1->tile_chunks[i];
+			chaos::TiledMap::TileLayerChunk const& chunk2 = tile_layer2->tile_chunks[i];
+			if (chunk1.size != chunk2.size || chunk1.offset != chunk2.offset || chunk1.tile_indices.size() != chunk2.tile_indices.size())
+				return false;
+			for (size_t j = 0; j < chunk1.tile_indices.size(); ++j)
+				if (chunk1.tile_indices[j].gid != chunk2.tile_indices[j].gid || chunk1.tile_indices[j].flags != chunk2.tile_indices[j].flags)
+					return false;
+		}
+	}
+	else if (chaos::TiledMap::ObjectLayer const* object_layer1 = auto_cast(layer1))
+	{
+		chaos::TiledMap::ObjectLayer const* object_layer2 = auto_cast(layer2);
+		if (object_layer1->color != object_layer2->color || object_layer1->draw_order != object_layer2->draw_order || object_layer1->geometric_objects.size() != object_layer2->geometric_objects.size())
+			return false;
+		for (size_t i = 0; i < object_layer1->geometric_objects.size(); ++i)
+			if (!SameGeometricObject(object_layer1->geometric_objects[i].get(), object_layer2->geometric_objects[i].get()))
+				return false;
+	}
+	else if (chaos::TiledMap::ImageLayer const* image_layer1 = auto_cast(layer1))
+	{
+		chaos::TiledMap::ImageLayer const* image_layer2 = auto_cast(layer2);
+		if (image_layer1->image_path != image_layer2->image_path || image_layer1->size != image_layer2->size || image_layer1->transparent_color != image_layer2->transparent_color)
+			return false;
+	}
+	else if (chaos::TiledMap::GroupLayer const* group_layer1 = auto_cast(layer1))
+	{
+		chaos::TiledMap::GroupLayer const* group_layer2 = auto_cast(layer2);
+		if (!SameLayers(group_layer1->layers, group_layer2->layers))
+			return false;
+	}
+	return true;
+}
+
+bool SameLayers(std::vector<chaos::shared_ptr<chaos::TiledMap::LayerBase>> const& layers1, std::vector<chaos::shared_ptr<chaos::TiledMap::LayerBase>> const& layers2)
+{
+	if (layers1.size() != layers2.size())
+		return false;
+	for (size_t i = 0; i < layers1.size(); ++i)
+		if (!SameLayer(layers1[i].get(), layers2[i].get()))
+			return false;
+	return true;
+}
+
+bool SameTileSet(chaos::TiledMap::TileSet const* tileset1, chaos::TiledMap::TileSet const* tileset2)
+{
+	if (tileset1->GetPath() != tileset2->GetPath() || tileset1->name != tileset2->name || tileset1->orientation != tileset2->orientation)
+		return false;
+	if (tileset1->size != tileset2->size || tileset1->tile_size != tileset2->tile_size || tileset1->columns != tileset2->columns || tileset1->tile_count != tileset2->tile_count)
+		return false;
+	if (tileset1->image_path != tileset2->image_path || tileset1->image_size != tileset2->image_size || tileset1->object_alignment != tileset2->object_alignment)
+		return false;
+	if (tileset1->min_tile_id != tileset2->min_tile_id || tileset1->max_tile_id != tileset2->max_tile_id)
+		return false;
+	if (!SameProperties(tileset1, tileset2, { "THEME" }))
+		return false;
+
+	if (tileset1->tiles.size() != tileset2->tiles.size())
+		return false;
+	for (size_t i = 0; i < tileset1->tiles.size(); ++i)
+	{
+		chaos::TiledMap::TileData const* tile1 = tileset1->tiles[i].get();
+		chaos::TiledMap::TileData const* tile2 = tileset2->tiles[i].get();
+		if (tile1->id != tile2->id || tile1->type != tile2->type || tile1->probability != tile2->probability)
+			return false;
+		if (tile1->image_path != tile2->image_path || tile1->image_size != tile2->image_size || tile1->atlas_key != tile2->atlas_key)
+			return false;
+		if (!SameProperties(tile1, tile2, { "ObjectType", "SCORE" }))
+			return false;
+		if (tile1->object_layers.size() != tile2->object_layers.size())
+			return false;
+		for (size_t j = 0; j < tile1->object_layers.size(); ++j)
+			if (!SameLayer(tile1->object_layers[j].get(), tile2->object_layers[j].get()))
+				return false;
+	}
+	return true;
+}
+
+bool SameMap(chaos::TiledMap::Map const* map1, chaos::TiledMap::Map const* map2)
+{
+	if (map1->GetPath() != map2->GetPath() || map1->orientation != map2->orientation || map1->size != map2->size || map1->tile_size != map2->tile_size)
+		return false;
+	if (map1->infinite != map2->infinite || map1->render_order != map2->render_order || map1->background_color != map2->background_color || map1->version != map2->version)
+		return false;
+	if (!SameProperties(map1, map2, { "LEVEL_TITLE", "LEVEL_TIMEOUT", "REQUIRED_DIAMOND", "DARK", "MAIN_CAMERA" }))
+		return false;
+
+	if (map1->tilesets.size() != map2->tilesets.size())
+		return false;
+	for (size_t i = 0; i < map1->tilesets.size(); ++i)
+	{
+		chaos::TiledMap::TileSetData const& data1 = map1->tilesets[i];
+		chaos::TiledMap::TileSetData const& data2 = map2->tilesets[i];
+		if (data1.first_gid != data2.first_gid || data1.min_tile_id != data2.min_tile_id || data1.max_tile_id != data2.max_tile_id)
+			return false;
+		if (!SameTileSet(data1.tileset.get(), data2.tileset.get()))
+			return false;
+	}
+	return SameLayers(map1->layers, map2->layers);
+}
+
+// ==========================================
+// the tests
+// ==========================================
+
+// the map loaded from its binary form is the same as the map loaded from XML
+void TestXMLAgainstBinary(boost::filesystem::path const& map_path, boost::filesystem::path const& cache_directory)
+{
+	// the reference : no cache
+	chaos::shared_ptr<chaos::TiledMap::Manager> xml_manager = new chaos::TiledMap::Manager;
+	chaos::TiledMap::Map* xml_map = xml_manager->LoadMap(map_path);
+	assert(xml_map != nullptr);
+	assert(GetCacheEntries(cache_directory).size() == 0);
+
+	// first load with the cache : the XML files are parsed and the binary forms of the map and of its external tileset are written
+	chaos::shared_ptr<chaos::TiledMap::Manager> first_manager = new chaos::TiledMap::Manager;
+	first_manager->SetCacheDirectory(cache_directory);
+	chaos::TiledMap::Map* first_map = first_manager->LoadMap(map_path);
+	assert(first_map != nullptr);
+	assert(SameMap(xml_map, first_map));
+
+	std::vector<boost::filesystem::path> entries = GetCacheEntries(cache_directory);
+	assert(entries.size() == 2);
+
+	// make the entries older : using an entry makes it recent again
+	std::time_t old_time = std::time(nullptr) - 3600;
+	for (boost::filesystem::path const& entry : entries)
+		boost::filesystem::last_write_time(entry, old_time);
+
+	// second load : the binary forms are read
+	chaos::shared_ptr<chaos::TiledMap::Manager> binary_manager = new chaos::TiledMap::Manager;
+	binary_manager->SetCacheDirectory(cache_directory);
+	chaos::TiledMap::Map* binary_map = binary_manager->LoadMap(map_path);
+	assert(binary_map != nullptr);
+	assert(SameMap(xml_map, binary_map));
+
+	for (boost::filesystem::path const& entry : entries)
+		assert(boost::filesystem::last_write_time(entry) > old_time);
+	assert(GetCacheEntries(cache_directory) == entries);
+
+	// the external tileset is registered in the manager as with XML
+	assert(binary_manager->GetTileSetCount() == xml_manager->GetTileSetCount());
+	chaos::TiledMap::TileSet const* binary_tileset = binary_manager->FindTileSet(xml_map->tilesets[0].tileset->GetPath());
+	assert(binary_tileset != nullptr);
+	assert(SameTileSet(xml_map->tilesets[0].tileset.get(), binary_tileset));
+
+	chaos::Log::Message("XML against binary : OK");
+}
+
+// an entry is found from the content of the XML file : any modification makes the entry stale
+void TestInvalidation(boost::filesystem::path const& resources_path, boost::filesystem::path const& work_directory, boost::filesystem::path const& cache_directory)
+{
+	boost::filesystem::create_directories(work_directory);
+	bool copied = CopyFile(resources_path / "map.tmx", work_directory / "map.tmx") && CopyFile(resources_path / "tileset.tsx", work_directory / "tileset.tsx");
+	assert(copied);
+
+	boost::filesystem::path map_path = work_directory / "map.tmx";
+	std::vector<boost::filesystem::path> initial_entries = GetCacheEntries(cache_directory);
+	assert(initial_entries.size() == 2);
+
+	// same contents at another path : the same entries are used, the objects have their own path
+	{
+		chaos::shared_ptr<chaos::TiledMap::Manager> manager = new chaos::TiledMap::Manager;
+		manager->SetCacheDirectory(cache_directory);
+		chaos::TiledMap::Map* map = manager->LoadMap(map_path);
+		assert(map != nullptr);
+		assert(boost::filesystem::equivalent(map->GetPath(), map_path));
+		assert(boost::filesystem::equivalent(map->tilesets[0].tileset->GetPath(), work_directory / "tileset.tsx"));
+		assert(GetCacheEntries(cache_directory) == initial_entries);
+	}
+
+	// modify the map : a new entry is written for the map, the one of the tileset is still used
+	chaos::Buffer<char> buffer = chaos::FileTools::LoadFile(map_path, chaos::LoadFileFlag::ASCII);
+	assert(buffer != nullptr);
+	std::string content = buffer.data;
+	size_t position = content.find("\"Cache test\"");
+	assert(position != std::string::npos);
+	content.replace(position, 12, "\"Modified\"");
+	bool written = WriteFile(map_path, content.c_str(), content.size());
+	assert(written);
+
+	std::vector<boost::filesystem::path> modified_entries;
+	for (int i = 0; i < 2; ++i) // the first time from XML, the second time from binary
+	{
+		chaos::shared_ptr<chaos::TiledMap::Manager> manager = new chaos::TiledMap::Manager;
+		manager->SetCacheDirectory(cache_directory);
+		chaos::TiledMap::Map* map = manager->LoadMap(map_path);
+		assert(map != nullptr);
+		assert(map->GetPropertyValueString("LEVEL_TITLE", "") == "Modified");
+		modified_entries = GetCacheEntries(cache_directory);
+		assert(modified_entries.size() == 3);
+	}
+
+	// the new entry
+	boost::filesystem::path new_entry;
+	for (boost::filesystem::path const& entry : modified_entries)
+		if (std::find(initial_entries.begin(), initial_entries.end(), entry) == initial_entries.end())
+			new_entry = entry;
+	assert(!new_entry.empty());
+
+	// a truncated entry is not used : the XML file is loaded and the entry written again
+	uintmax_t entry_size = boost::filesystem::file_size(new_entry);
+	chaos::Buffer<char> entry_buffer = chaos::FileTools::LoadFile(new_entry);
+	assert(entry_buffer != nullptr);
+	written = WriteFile(new_entry, entry_buffer.data, entry_buffer.bufsize / 2);
+	assert(written);
+	{
+		chaos::shared_ptr<chaos::TiledMap::Manager> manager = new chaos::TiledMap::Manager;
+		manager->SetCacheDirectory(cache_directory);
+		chaos::TiledMap::Map* map = manager->LoadMap(map_path);
+		assert(map != nullptr);
+		assert(map->GetPropertyValueString("LEVEL_TITLE", "") == "Modified");
+		assert(boost::filesystem::file_size(new_entry) == entry_size);
+		assert(GetCacheEntries(cache_directory) == modified_entries);
+	}
+
+	chaos::Log::Message("Invalidation : OK");
+}
+
+// the entries that are too old are removed, then the least recently used ones until the cache fits its max size
+void TestTrim(boost::filesystem::path const& map_path, boost::filesystem::path const& cache_directory)
+{
+	std::vector<boost::filesystem::path> entries = GetCacheEntries(cache_directory);
+	assert(entries.size() == 3);
+
+	std::time_t const DAY = 24 * 60 * 60;
+	std::time_t now = std::time(nullptr);
+	boost::filesystem::last_write_time(entries[0], now - 3 * DAY);
+	boost::filesystem::last_write_time(entries[1], now - 2 * DAY);
+	boost::filesystem::last_write_time(entries[2], now);
+
+	// the remains of an interrupted write are removed, the other files are kept
+	bool written = WriteFile(cache_directory / "interrupted.tmp", "x", 1);
+	assert(written);
+	written = WriteFile(cache_directory / "readme.txt", "x", 1);
+	assert(written);
+
+	chaos::shared_ptr<chaos::TiledMap::Manager> manager = new chaos::TiledMap::Manager;
+	manager->SetCacheDirectory(cache_directory);
+	assert(GetCacheEntries(cache_directory).size() == 3);
+	assert(!boost::filesystem::exists(cache_directory / "interrupted.tmp"));
+	assert(boost::filesystem::exists(cache_directory / "readme.txt"));
+
+	// age
+	manager->SetCacheMaxAge(2 * DAY + DAY / 2);
+	assert(!boost::filesystem::exists(entries[0]));
+	assert(boost::filesystem::exists(entries[1]) && boost::filesystem::exists(entries[2]));
+
+	// size
+	manager->SetCacheMaxSize(boost::filesystem::file_size(entries[2]));
+	assert(!boost::filesystem::exists(entries[1]));
+	assert(boost::filesystem::exists(entries[2]));
+
+	// the loading does not depend on the cache : an entry that does not fit is removed as soon as written
+	manager->SetCacheMaxSize(0);
+	assert(GetCacheEntries(cache_directory).size() == 0);
+	chaos::TiledMap::Map* map = manager->LoadMap(map_path);
+	assert(map != nullptr);
+	assert(GetCacheEntries(cache_directory).size() == 0);
+
+	chaos::Log::Message("Trim : OK");
+}
+
+// the durations of the loadings with and without the cache
+void BenchmarkLoading(boost::filesystem::path const& map_path, boost::filesystem::path const& cache_directory)
+{
+	int const COUNT = 200;
+
+	auto measure = [&](bool use_cache)
+	{
+		auto t0 = std::chrono::steady_clock::now();
+		for (int i = 0; i < COUNT; ++i)
+		{
+			chaos::shared_ptr<chaos::TiledMap::Manager> manager = new chaos::TiledMap::Manager;
+			if (use_cache)
+				manager->SetCacheDirectory(cache_directory);
+			chaos::TiledMap::Map* map = manager->LoadMap(map_path);
+			assert(map != nullptr);
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::milli>(t1 - t0).count() / double(COUNT);
+	};
+
+	// fill the cache
+	chaos::shared_ptr<chaos::TiledMap::Manager> manager = new chaos::TiledMap::Manager;
+	manager->SetCacheDirectory(cache_directory);
+	manager->LoadMap(map_path);
+
+	double xml_duration = measure(false);
+	double binary_duration = measure(true);
+	chaos::Log::Message("Load [%s] : XML %f ms, binary %f ms", map_path.filename().string().c_str(), xml_duration, binary_duration);
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	virtual int Main() override
+	{
+		boost::filesystem::path map_path = GetResourcesPath() / "map.tmx";
+
+		boost::filesystem::path temp_path = GetUserLocalTempPath() / "TiledMapCache";
+		boost::filesystem::remove_all(temp_path);
+
+		boost::filesystem::path cache_directory = temp_path / "cache";
+		TestXMLAgainstBinary(map_path, cache_directory);
+		TestInvalidation(GetResourcesPath(), temp_path / "work", cache_directory);
+		TestTrim(map_path, cache_directory);
+		BenchmarkLoading(map_path, cache_directory);
+
+		boost::filesystem::remove_all(temp_path);
+
+		chaos::WinTools::PressToContinue();
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
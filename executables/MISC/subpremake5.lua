@@ -10,17 +10,25 @@ build:ProcessSubPremake("CutWord")
 build:ProcessSubPremake("ClassManager")
 build:ProcessSubPremake("FadeVortexImage")
 build:ProcessSubPremake("GenerateTexture")
+build:ProcessSubPremake("ImageProcessor")
 build:ProcessSubPremake("JSONTest")
+build:ProcessSubPremake("JobSystem")
 build:ProcessSubPremake("Metaprogramming")
 build:ProcessSubPremake("MyBase64")
 build:ProcessSubPremake("MyZLib")
+build:ProcessSubPremake("ObjectPool")
 build:ProcessSubPremake("OpenCV")
 build:ProcessSubPremake("OpenFileMap")
 build:ProcessSubPremake("OVR")
+build:ProcessSubPremake("ParticleSoA")
+build:ProcessSubPremake("PixelKernels")
 build:ProcessSubPremake("RedirectOutput_Console")
 build:ProcessSubPremake("Screenshot")
 build:ProcessSubPremake("SkyBoxConversion")
 build:ProcessSubPremake("SkyBoxLoading")
+build:ProcessSubPremake("SpatialIndex")
 build:ProcessSubPremake("SparseBuffer")
+build:ProcessSubPremake("TextureDecode")
+build:ProcessSubPremake("TiledMapCache")
 build:ProcessSubPremake("WindowsApp")
 build:ProcessSubPremake("ConfigurationTest")
\ No newline at end of file
@@ -2,6 +2,172 @@
 
 // ================================================================
 
+// a small format 1 file : the tempo track changes the tempo at tick 96, the other track uses running status
+chaos::Buffer<char> GenerateMidiBuffer()
+{
+	static unsigned char const data[] =
+	{
+		'M', 'T', 'h', 'd', 0x00, 0x00, 0x00, 0x06,
+		0x00, 0x01, // format
+		0x00, 0x02, // track count
+		0x00, 0x60, // 96 ticks per quarter note
+
+		'M', 'T', 'r', 'k', 0x00, 0x00, 0x00, 0x12,
+		0x00, 0xFF, 0x51, 0x03, 0x07, 0xA1, 0x20, // tick 0   : 500000 us per quarter note
+		0x60, 0xFF, 0x51, 0x03, 0x03, 0xD0, 0x90, // tick 96  : 250000 us per quarter note
+		0x60, 0xFF, 0x2F, 0x00,                   // tick 192 : end of track
+
+		'M', 'T', 'r', 'k', 0x00, 0x00, 0x00, 0x0C,
+		0x00, 0x90, 0x3C, 0x40,                   // tick 0   : note on
+		0x81, 0x40, 0x3C, 0x00,                   // tick 192 : note on with velocity 0 (running status)
+		0x00, 0xFF, 0x2F, 0x00                    // tick 192 : end of track
+	};
+
+	chaos::Buffer<char> result = chaos::SharedBufferPolicy<char>::NewBuffer(sizeof(data));
+	memcpy(result.data, data, sizeof(data));
+	return result;
+}
+
+// the events are views on the buffer, stored contiguously for all tracks
+void CheckTracks(chaos::MidiLoader const & loader, chaos::Buffer<char> const & buffer)
+{
+	assert(loader.GetTrackCount() == size_t(loader.GetHeader().track_count));
+
+	for (size_t i = 0; i < loader.GetTrackCount(); ++i)
+	{
+		chaos::MidiTrack const & track = loader.GetTrack(i);
+		if (i + 1 < loader.GetTrackCount())
+			assert(track.end() == loader.GetTrack(i + 1).begin()); // a single arena
+
+		uint32_t tick = 0;
+		for (chaos::MidiEvent const & event : track)
+		{
+			assert(event.tick >= tick);
+			tick = event.tick;
+			if (event.data_size > 0)
+				assert(event.data >= buffer.data && event.data + event.data_size <= buffer.data + buffer.bufsize);
+		}
+	}
+}
+
+// the timeline contains all events sorted by time and can be searched
+void CheckTimeline(chaos::MidiLoader const & loader, chaos::MidiTimeline const & timeline)
+{
+	size_t event_count = 0;
+	for (size_t i = 0; i < loader.GetTrackCount(); ++i)
+		event_count += loader.GetTrack(i).event_count;
+	assert(timeline.events.size() == event_count);
+
+	for (size_t i = 1; i < timeline.events.size(); ++i)
+	{
+		chaos::MidiTimedEvent const & previous = timeline.events[i - 1];
+		chaos::MidiTimedEvent const & current = timeline.events[i];
+		assert(current.tick >= previous.tick);
+		assert(current.time >= previous.time);
+		if (current.tick == previous.tick)
+			assert(current.time == previous.time);
+	}
+
+	for (int i = 0; i <= 10; ++i)
+	{
+		double time = timeline.GetDuration() * double(i) / 10.0;
+		size_t index = timeline.GetEventIndexAtTime(time);
+		assert(index <= timeline.events.size());
+		if (index < timeline.events.size())
+			assert(timeline.events[index].time >= time);
+		if (index > 0)
+			assert(timeline.events[index - 1].time < time);
+	}
+	assert(timeline.GetEventIndexAtTime(timeline.GetDuration() + 1.0) == timeline.events.size());
+}
+
+void TestGeneratedFile()
+{
+	chaos::Buffer<char> buffer = GenerateMidiBuffer();
+
+	chaos::MidiLoader loader;
+	bool loaded = loader.LoadBuffer(buffer);
+	assert(loaded);
+	assert(loader.GetHeader().format == chaos::MidiHeader::FORMAT_MULTIPLE_TRACK);
+	assert(loader.GetTrackCount() == 2);
+	assert(loader.GetTrack(0).event_count == 3);
+	assert(loader.GetTrack(1).event_count == 3);
+	CheckTracks(loader, buffer);
+
+	// the running status is resolved
+	chaos::MidiEvent const & note_off = loader.GetTrack(1).events[1];
+	assert(note_off.tick == 192);
+	assert(note_off.signature == 0x90);
+	assert(note_off.data_size == 2 && note_off.data[0] == 0x3C && note_off.data[1] == 0x00);
+
+	chaos::MidiTimeline timeline;
+	bool built = loader.BuildTimeline(timeline);
+	assert(built);
+	CheckTimeline(loader, timeline);
+
+	// ties are ordered by track. 96 ticks at 500000 us + 96 ticks at 250000 us
+	double const expected_times[] = { 0.0, 0.0, 0.5, 0.75, 0.75, 0.75 };
+	size_t const expected_tracks[] = { 0, 1, 0, 0, 1, 1 };
+	assert(timeline.events.size() == 6);
+	for (size_t i = 0; i < timeline.events.size(); ++i)
+	{
+		assert(std::abs(timeline.events[i].time - expected_times[i]) < 1.0e-9);
+		assert(timeline.events[i].track_index == expected_tracks[i]);
+	}
+	assert(timeline.GetEventIndexAtTime(0.25) == 2);
+	assert(timeline.GetEventIndexAtTime(0.75) == 3);
+
+	// a truncated file is rejected
+	chaos::Buffer<char> truncated_buffer = chaos::SharedBufferPolicy<char>::NewBuffer(buffer.bufsize - 3);
+	memcpy(truncated_buffer.data, buffer.data, truncated_buffer.bufsize);
+	chaos::MidiLoader truncated_loader;
+	loaded = truncated_loader.LoadBuffer(truncated_buffer);
+	assert(!loaded);
+
+	chaos::Log::Message("Generated MIDI file : OK");
+}
+
+// load every file of the resources and display the duration of the loading
+bool TestResourceFiles(boost::filesystem::path const & resource_path)
+{
+	size_t file_count = 0;
+	size_t event_count = 0;
+	double load_duration = 0.0;
+
+	boost::filesystem::recursive_directory_iterator end;
+	for (boost::filesystem::recursive_directory_iterator it(resource_path); it != end; ++it)
+	{
+		if (!chaos::FileTools::IsTypedFile(it->path(), ".mid"))
+			continue;
+
+		chaos::Buffer<char> buffer = chaos::FileTools::LoadFile(it->path());
+		if (buffer == nullptr)
+			return false;
+
+		chaos::MidiLoader loader;
+		chaos::MidiTimeline timeline;
+
+		auto t0 = std::chrono::steady_clock::now();
+		bool loaded = loader.LoadBuffer(buffer) && loader.BuildTimeline(timeline);
+		auto t1 = std::chrono::steady_clock::now();
+		if (!loaded)
+		{
+			chaos::Log::Error("failed to load [%s]", it->path().string().c_str());
+			return false;
+		}
+		CheckTracks(loader, buffer);
+		CheckTimeline(loader, timeline);
+
+		++file_count;
+		event_count += timeline.events.size();
+		load_duration += std::chrono::duration<double, std::milli>(t1 - t0).count();
+	}
+	chaos::Log::Message("%d MIDI files, %d events loaded in %f ms : OK", int(file_count), int(event_count), load_duration);
+	return true;
+}
+
+// ================================================================
+
 
 class WindowOpenGLTest : public chaos::Window
 {
@@ -31,6 +197,10 @@ protected:
 
 		boost::filesystem::path const & resource_path = application->GetResourcesPath();
 
+		TestGeneratedFile();
+		if (!TestResourceFiles(resource_path))
+			return false;
+
 		chaos::Buffer<char> buffer = chaos::FileTools::LoadFile(resource_path / "Blues Breaker - 8 Bars" / "BluesBreaker_8Bars_01.mid");
 		if (buffer == nullptr)
 			return false;
@@ -9,6 +9,7 @@ namespace chaos
 		class BitmapAnimationInfo;
 		class BitmapInfo;
 		class CharacterInfo;
+		class CharacterTable;
 		class FontInfo;
 		class FolderInfo;
 		class AtlasBase;
@@ -130,6 +131,39 @@ namespace chaos
 		{
 		};
 
+		/**
+		* CharacterTable : a direct lookup table from charcode to character index (dense for Latin-1, hashed for the rest)
+		*/
+
+		class CHAOS_API CharacterTable
+		{
+		public:
+
+			/** the number of charcodes in the dense part of the table */
+			static constexpr uint32_t DENSE_CHARACTER_COUNT = 256;
+
+			/** constructor */
+			CharacterTable();
+
+			/** remove all entries (the table is not valid until built again) */
+			void Clear();
+			/** returns whether the table has been built for the current elements */
+			bool IsValid() const { return valid; }
+			/** add a character (the first index for a charcode is kept) */
+			void Insert(uint32_t charcode, size_t index);
+			/** get the index of a character */
+			std::optional<size_t> Find(uint32_t charcode) const;
+
+		public:
+
+			/** whether the table has been built for the current elements */
+			bool valid = false;
+			/** the index of the Latin-1 characters (-1 for missing characters) */
+			std::array<int32_t, DENSE_CHARACTER_COUNT> dense_entries;
+			/** the index of the other characters */
+			std::unordered_map<uint32_t, size_t> sparse_entries;
+		};
+
 		/**
 		* FontInfoTemplate : a base template for FontInfo and FontInfoInput
 		*/
@@ -143,12 +177,71 @@ namespace chaos
 			using meta_wrapper_type = META_WRAPPER_TYPE;
 			using character_stored_type = typename boost::mpl::apply<meta_wrapper_type, character_type>::type;
 
-			/** gets an info by name/tag */
+			/** gets an info by name/tag (charcode requests use the character table when it is valid) */
 			character_type const* GetCharacterInfo(ObjectRequest request) const
 			{
+				if (request.IsTagRequest() && character_table.IsValid())
+				{
+					if (request.tag > std::numeric_limits<uint32_t>::max()) // all elements have a 32 bits tag (see UpdateCharacterTable)
+						return nullptr;
+					std::optional<size_t> index = character_table.Find(uint32_t(request.tag));
+					if (index.has_value())
+					{
+						assert(*index < elements.size()); // elements changed without InvalidateCharacterTable()
+						return meta::get_raw_pointer(elements[*index]);
+					}
+					return nullptr;
+				}
 				return request.FindObject(elements);
 			}
 
+			/** invalidate the character table (must be called whenever elements change, until UpdateCharacterTable() is called) */
+			void InvalidateCharacterTable()
+			{
+				character_table.Clear();
+			}
+
+			/** build the character table (to be called once elements are changed) */
+			void UpdateCharacterTable()
+			{
+				character_table.Clear();
+				size_t count = elements.size();
+				for (size_t i = 0; i < count; ++i)
+				{
+					auto e = meta::get_raw_pointer(elements[i]);
+					if (e == nullptr)
+						continue;
+					if (e->GetTag() > std::numeric_limits<uint32_t>::max()) // not a charcode : keep linear search
+						return;
+					character_table.Insert(uint32_t(e->GetTag()), i);
+				}
+				character_table.valid = true;
+			}
+
+			/** get the horizontal kerning between two characters */
+			int GetKerning(uint32_t left_charcode, uint32_t right_charcode) const
+			{
+				if (kerning_pairs.size() == 0)
+					return 0;
+				auto it = kerning_pairs.find(GetKerningKey(left_charcode, right_charcode));
+				if (it == kerning_pairs.end())
+					return 0;
+				return it->second;
+			}
+			/** set the horizontal kerning between two characters */
+			void SetKerning(uint32_t left_charcode, uint32_t right_charcode, int value)
+			{
+				if (value == 0)
+					kerning_pairs.erase(GetKerningKey(left_charcode, right_charcode));
+				else
+					kerning_pairs[GetKerningKey(left_charcode, right_charcode)] = value;
+			}
+			/** get the key for a kerning pair */
+			static uint64_t GetKerningKey(uint32_t left_charcode, uint32_t right_charcode)
+			{
+				return (uint64_t(left_charcode) << 32) | uint64_t(right_charcode);
+			}
+
 		public:
 
 			/** the max bitmap size in the set */
@@ -164,6 +257,10 @@ namespace chaos
 
 			/** the glyph contained in the character info */
 			std::vector<character_stored_type> elements;
+			/** the direct lookup table for elements */
+			CharacterTable character_table;
+			/** the horizontal kerning (in pixels) for pairs of characters */
+			std::unordered_map<uint64_t, int> kerning_pairs;
 		};
 
 		/**
@@ -192,10 +289,10 @@ namespace chaos
 			using bitmap_stored_type = typename boost::mpl::apply<meta_wrapper_type, bitmap_type>::type;
 			using font_stored_type = typename boost::mpl::apply<meta_wrapper_type, font_type>::type;
 
-#define CHAOS_IMPL_GETINFO(result_type, funcname, vector_name, constness)\
+#define CHAOS_IMPL_GETINFO(result_type, funcname, vector_name, index_name, constness)\
 			result_type constness * funcname(ObjectRequest request, bool recursive = false) constness\
 			{\
-				result_type constness * result = request.FindObject(vector_name);\
+				result_type constness * result = request.FindObject(vector_name, index_name);\
 				if (result != nullptr)\
 					return result;\
 				size_t count = folders.size();\
@@ -203,14 +300,14 @@ namespace chaos
 					result = folders[i]->funcname(request, recursive);\
 				return result;\
 			}
-			CHAOS_IMPL_GETINFO(bitmap_type, GetBitmapInfo, bitmaps, BOOST_PP_EMPTY());
-			CHAOS_IMPL_GETINFO(bitmap_type, GetBitmapInfo, bitmaps, const);
+			CHAOS_IMPL_GETINFO(bitmap_type, GetBitmapInfo, bitmaps, bitmap_index, BOOST_PP_EMPTY());
+			CHAOS_IMPL_GETINFO(bitmap_type, GetBitmapInfo, bitmaps, bitmap_index, const);
 
-			CHAOS_IMPL_GETINFO(font_type, GetFontInfo, fonts, BOOST_PP_EMPTY());
-			CHAOS_IMPL_GETINFO(font_type, GetFontInfo, fonts, const);
+			CHAOS_IMPL_GETINFO(font_type, GetFontInfo, fonts, font_index, BOOST_PP_EMPTY());
+			CHAOS_IMPL_GETINFO(font_type, GetFontInfo, fonts, font_index, const);
 
-			CHAOS_IMPL_GETINFO(folder_type, GetFolderInfo, folders, BOOST_PP_EMPTY());
-			CHAOS_IMPL_GETINFO(folder_type, GetFolderInfo, folders, const);
+			CHAOS_IMPL_GETINFO(folder_type, GetFolderInfo, folders, folder_index, BOOST_PP_EMPTY());
+			CHAOS_IMPL_GETINFO(folder_type, GetFolderInfo, folders, folder_index, const);
 #undef CHAOS_IMPL_GETINFO
 
 			/** clear the content of the folder */
@@ -219,6 +316,15 @@ namespace chaos
 				bitmaps.clear();
 				fonts.clear();
 				folders.clear();
+				InvalidateIndexes();
+			}
+
+			/** must be called whenever bitmaps, fonts or folders vectors are modified */
+			void InvalidateIndexes()
+			{
+				folder_index.Invalidate();
+				bitmap_index.Invalidate();
+				font_index.Invalidate();
 			}
 
 		public:
@@ -229,6 +335,13 @@ namespace chaos
 			std::vector<bitmap_stored_type> bitmaps;
 			/** the fonts contained in this folder */
 			std::vector<font_stored_type> fonts;
+
+			/** the index for searching sub folders */
+			NamedObjectIndex folder_index;
+			/** the index for searching bitmaps */
+			NamedObjectIndex bitmap_index;
+			/** the index for searching fonts */
+			NamedObjectIndex font_index;
 		};
 
 		/**
@@ -349,6 +462,8 @@ namespace chaos
 			size_t GetBitmapCount() const { return atlas_count; }
 			/** get the size of bitmaps composing the atlas */
 			glm::ivec2 GetAtlasDimension() const { return dimension; }
+			/** get a counter that changes each time the atlas is cleared (data depending on the content must be rebuilt) */
+			uint64_t GetVersion() const { return version; }
 
 			/** returns the used surface for a bitmap */
 			float ComputeSurface(int bitmap_index) const;
@@ -411,6 +526,8 @@ namespace chaos
 			int atlas_count = 0;
 			/** atlas dimension */
 			glm::ivec2 dimension = glm::ivec2(0, 0);
+			/** the version of the content */
+			uint64_t version = 0;
 		};
 
 		/**
@@ -4,6 +4,7 @@ namespace chaos
 	{
 #ifdef CHAOS_FORWARD_DECLARATION
 
+		enum class AtlasPackingStrategy;
 		class AtlasGeneratorParams;
 		class Rectangle;
 		class AtlasGenerator;
@@ -11,6 +12,22 @@ namespace chaos
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+		/**
+		* AtlasPackingStrategy : the algorithm used to find the position of each bitmap in the atlas
+		*/
+
+		enum class CHAOS_API AtlasPackingStrategy : int
+		{
+			/** the historical algorithm : try every corner of already inserted bitmaps (slow for huge inputs) */
+			CORNERS = 0,
+			/** keep a list of maximal free rectangles and use the one that best fits the shorter side of the bitmap */
+			MAXRECTS_BSSF = 1,
+			/** keep the top boundary of the used space and insert bitmaps as low as possible (fastest, less dense) */
+			SKYLINE = 2
+		};
+
+		CHAOS_DECLARE_ENUM_METHOD(AtlasPackingStrategy, CHAOS_API);
+
 		/**
 		* AtlasGeneratorParams : parameters used when generating an atlas
 		*/
@@ -46,12 +63,16 @@ namespace chaos
 			int atlas_max_height = 0;
 			/** some padding for the bitmap : should be even */
 			int atlas_padding = 0;
+			/** the algorithm used to place the bitmaps (MAXRECTS_BSSF and SKYLINE are faster for huge inputs but give a different layout) */
+			AtlasPackingStrategy packing_strategy = AtlasPackingStrategy::CORNERS;
 			/** the background color */
 			glm::vec4 background_color = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
 			/** parameters for merging different pixel format */
 			PixelFormatMergeParams merge_params;
 			/** the filters to be applyed to each bitmaps */
 			BitmapAtlasFilterSet const* filters = nullptr;
+			/** an atlas whose layout is kept for the entries that did not change (CORNERS and MAXRECTS_BSSF only) */
+			Atlas const* previous_atlas = nullptr;
 		};
 
 		/**
@@ -82,21 +103,42 @@ namespace chaos
 
 		/**
 		* AtlasGenerator :
-		*   each time a BitmapInfo is inserted, the space is split along 4 axis
-		*   this creates a grid of points that serve to new positions for inserting next entries ...
-		*   it select the best position as the one that minimize space at left, right, top and bottom
+		*   bitmaps are inserted from the biggest to the smallest. The position in an atlas page depends on AtlasGeneratorParams::packing_strategy
+		*
+		*   CORNERS       : each time a BitmapInfo is inserted, its corners serve as new positions for inserting next entries ...
+		*                   each position is tested against all inserted rectangles
+		*   MAXRECTS_BSSF : the free space is represented by a set of maximal (possibly overlapping) rectangles.
+		*                   the selected rectangle is the one that minimize the space left along the shorter side of the bitmap
+		*   SKYLINE       : the used space is represented by its top boundary. the bitmap is inserted at the lowest possible position
 		*/
 
 		class CHAOS_API AtlasGenerator
 		{
+			/** an horizontal segment of the skyline */
+			class SkylineSegment
+			{
+			public:
+				/** the left of the segment */
+				int x = 0;
+				/** the top of the used space along the segment */
+				int y = 0;
+				/** the width of the segment */
+				int width = 0;
+			};
+
 			/** an definition is a set of vertical and horizontal lines that split the space */
 			class AtlasDefinition
 			{
 			public:
 				unsigned int surface_sum = 0;
 
+				/** CORNERS strategy */
 				std::vector<Rectangle>  collision_rectangles;
 				std::vector<glm::ivec2> potential_bottomleft_corners;
+				/** MAXRECTS_BSSF strategy */
+				std::vector<Rectangle> free_rectangles;
+				/** SKYLINE strategy (sorted along X) */
+				std::vector<SkylineSegment> skyline;
 			};
 
 			/** an utility class used to reference all entries in input */
@@ -110,8 +152,8 @@ namespace chaos
 			bool ComputeResult(AtlasInput const& in_input, Atlas& in_ouput, AtlasGeneratorParams const& in_params = AtlasGeneratorParams());
 			/** returns a vector with all generated bitmaps (to be deallocated after usage) */
 			std::vector<bitmap_ptr> GenerateBitmaps(BitmapInfoInputVector const& entries, PixelFormat const& final_pixel_format) const;
-			/** create an atlas from a directory into another directory */
-			static bool CreateAtlasFromDirectory(FilePathParam const& bitmaps_dir, FilePathParam const& path, bool recursive, AtlasGeneratorParams const& in_params = AtlasGeneratorParams());
+			/** create an atlas from a directory into another directory (incremental mode uses a bitmap cache and the layout of the atlas previously generated at the same path) */
+			static bool CreateAtlasFromDirectory(FilePathParam const& bitmaps_dir, FilePathParam const& path, bool recursive, AtlasGeneratorParams const& in_params = AtlasGeneratorParams(), bool incremental = false);
 
 		protected:
 
@@ -133,11 +175,34 @@ namespace chaos
 
 			/** the effective function to do the computation */
 			bool DoComputeResult(BitmapInfoInputVector const& entries);
+			/** search for each layout of the output, the layout of the previous atlas with the same name/size */
+			void CollectPreviousLayouts(FolderInfo const* folder_info, FolderInfo const* previous_folder_info, std::unordered_map<BitmapLayout const*, BitmapLayout const*>& result) const;
+			/** place the entries at the same position than in the previous atlas whenever possible (returns the entries placed) */
+			std::vector<bool> InsertPreviousLayouts(BitmapInfoInputVector const& entries);
+			/** returns whether a rectangle can be inserted at its position */
+			bool CanInsertRectangle(Rectangle const& r, AtlasDefinition const& atlas_def) const;
+			/** initialize a new atlas definition */
+			void InitializeAtlasDefinition(AtlasDefinition& atlas_def) const;
 			/** returns the position (if any) in an atlas withe the best score */
 			float FindBestPositionInAtlas(BitmapInfoInputVector const& entries, BitmapInfoInput const& info, AtlasDefinition const& atlas_def, glm::ivec2& position) const;
 			/** insert a bitmap in an atlas definition */
 			void InsertBitmapLayoutInAtlas(BitmapLayout& layout, AtlasDefinition& atlas_def, glm::ivec2 const& position);
 
+			/** search a position with the CORNERS strategy */
+			bool FindPositionWithCorners(Rectangle const& r, AtlasDefinition const& atlas_def, glm::ivec2& position) const;
+			/** search a position with the MAXRECTS_BSSF strategy */
+			bool FindPositionWithMaxRects(Rectangle const& r, AtlasDefinition const& atlas_def, glm::ivec2& position) const;
+			/** search a position with the SKYLINE strategy */
+			bool FindPositionWithSkyline(Rectangle const& r, AtlasDefinition const& atlas_def, glm::ivec2& position) const;
+			/** update the atlas definition for CORNERS strategy */
+			void InsertRectangleWithCorners(Rectangle const& r, AtlasDefinition& atlas_def) const;
+			/** update the atlas definition for MAXRECTS_BSSF strategy */
+			void InsertRectangleWithMaxRects(Rectangle const& r, AtlasDefinition& atlas_def) const;
+			/** update the atlas definition for SKYLINE strategy */
+			void InsertRectangleWithSkyline(Rectangle const& r, AtlasDefinition& atlas_def) const;
+			/** returns the top of the skyline along [x, x + width] starting from a given segment (-1 if out of the atlas) */
+			int GetSkylineTop(AtlasDefinition const& atlas_def, size_t segment_index, int width) const;
+
 			/** an utility function that returns an array with 0.. count - 1*/
 			static std::vector<size_t> CreateIndexTable(size_t count)
 			{
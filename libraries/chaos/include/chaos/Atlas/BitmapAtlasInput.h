@@ -11,6 +11,7 @@ namespace chaos
 		class CharacterInfoInput;
 		class FontInfoInput;
 		class AddFilesToFolderData;
+		class BitmapFileLoadRequest;
 		class FolderInfoInput;
 		class AtlasInput;
 
@@ -166,6 +167,35 @@ namespace chaos
 		};
 
 
+		/**
+		* BitmapFileLoadRequest : an image file to be added into a folder. Loading (decoding + processing) may happen on any thread
+		*/
+
+		class CHAOS_API BitmapFileLoadRequest
+		{
+		public:
+
+			/** the folder where the bitmap is to be inserted */
+			class FolderInfoInput* folder = nullptr;
+			/** the path of the image (or of the manifest if the frames are in a directory) */
+			boost::filesystem::path path;
+			/** the directory containing the frames of the animation (if any) */
+			boost::filesystem::path images_directory;
+			/** the name of the bitmap */
+			std::string name;
+			/** the tag of the bitmap */
+			TagType tag = 0;
+			/** the manifest (null if there is none) */
+			nlohmann::json json_manifest;
+
+			/** the loaded (and processed) images */
+			std::vector<FIBITMAP*> images;
+			/** the animation description */
+			ImageAnimationDescription animation_description;
+			/** an error raised during loading (to be logged on the main thread) */
+			std::string error_message;
+		};
+
 		/**
 		* FolderInfoInput :  this info will produced in the final Atlas a FolderInfo
 		*/
@@ -214,8 +244,12 @@ namespace chaos
 
 			/** internal method to add a bitmap from file (and searching manifest) */
 			BitmapInfoInput* AddBitmapFileImpl(FilePathParam const& path, char const* name, TagType tag, AddFilesToFolderData& add_data);
-			/** internal method to add a bitmap whose manifest (or not) is known */
-			BitmapInfoInput* AddBitmapFileWithManifestImpl(FilePathParam const& path, char const* name, TagType tag, nlohmann::json const* json_manifest, std::vector<FIBITMAP*>* images);
+			/** internal method to prepare the loading of all bitmaps of a directory (recursively or not) */
+			void PrepareBitmapFilesFromDirectory(FilePathParam const& path, bool recursive, std::vector<BitmapFileLoadRequest>& requests);
+			/** internal method to search the manifest of a file and fill a request (returns false if there is nothing to load) */
+			bool PrepareBitmapFileRequest(FilePathParam const& path, char const* name, TagType tag, AddFilesToFolderData& add_data, BitmapFileLoadRequest& request);
+			/** internal method to insert the bitmap of a loaded request */
+			BitmapInfoInput* AddBitmapFileRequest(BitmapFileLoadRequest& request);
 			/** internal method to add a bitmap or a multi bitmap */
 			BitmapInfoInput* AddBitmapImpl(std::vector<FIBITMAP*> pages, char const* name, TagType tag, ImageAnimationDescription const* animation_description);
 
@@ -242,6 +276,7 @@ namespace chaos
 		class CHAOS_API AtlasInput : public AtlasBaseTemplate<NoCopy<Object>, BitmapInfoInput, FontInfoInput, FolderInfoInput>
 		{
 			friend class ObjectBaseInput;
+			friend class FolderInfoInput;
 			friend class AtlasGenerator;
 
 		public:
@@ -253,6 +288,23 @@ namespace chaos
 			/** the clear method */
 			virtual void Clear() override;
 
+			/** set the directory where decoded and processed bitmaps are cached (empty to disable the cache) */
+			void SetCacheDirectory(FilePathParam const& path);
+			/** get the cache directory */
+			boost::filesystem::path const& GetCacheDirectory() const { return cache_directory; }
+			/** change the max size of the cache directory (least recently used entries are removed) */
+			void SetCacheMaxSize(uintmax_t in_cache_max_size) { cache_max_size = in_cache_max_size; }
+			/** get the max size of the cache directory */
+			uintmax_t GetCacheMaxSize() const { return cache_max_size; }
+
+			/** the default max size of the cache directory */
+			static constexpr uintmax_t DEFAULT_CACHE_MAX_SIZE = 256 * 1024 * 1024;
+
+			/** change whether bitmaps files are loaded on several threads */
+			void SetParallelLoading(bool in_parallel_loading) { parallel_loading = in_parallel_loading; }
+			/** returns whether bitmaps files are loaded on several threads */
+			bool IsParallelLoading() const { return parallel_loading; }
+
 			/** insert a Folder set inside the input */
 			FolderInfoInput* AddFolder(char const* name, TagType tag);
 
@@ -294,8 +346,20 @@ namespace chaos
 			/** register face */
 			void RegisterResource(FT_Face face, bool release);
 
+			/** load (decode and process) the images of all requests */
+			void LoadBitmapFileRequests(std::vector<BitmapFileLoadRequest>& requests) const;
+			/** remove the least recently used entries until the cache directory is smaller than its max size */
+			void TrimCache() const;
+
 		protected:
 
+			/** the directory where the bitmaps are cached */
+			boost::filesystem::path cache_directory;
+			/** the max size of the cache directory */
+			uintmax_t cache_max_size = DEFAULT_CACHE_MAX_SIZE;
+			/** whether bitmaps files are loaded on several threads (the filters and the loaders must be thread safe) */
+			bool parallel_loading = false;
+
 			/** the bitmaps to destroy */
 			std::vector<bitmap_ptr> bitmaps;
 			/** the multi bitmaps to destroy */
@@ -39,8 +39,15 @@
 #include <vector>
 #include <map>
 #include <unordered_map>
+#include <typeindex>
+#include <bit>
+#include <atomic>
+#include <deque>
+#include <queue>
+#include <limits>
 #include <tuple>
 #include <array>
+#include <span>
 #include <cstdlib>
 #include <functional>
 #include <algorithm>
@@ -62,11 +69,19 @@
 
 #include <fcntl.h>
 #include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
 #include <future>
 #include <chrono>
 #include <forward_list>
+#include <list>
 #include <type_traits>
 
+#if defined _M_X64 || defined __x86_64__
+#include <immintrin.h>
+#endif
+
 // boost is full of #pragma comment(lib, ...)
 // ignore theses link directive for STATIC_LIBRARIES that would use this header
 #if !defined DEATH_BUILDING_SHARED_LIBRARY && !defined DEATH_BUILDING_EXECUTABLE
@@ -170,6 +185,8 @@
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
+#include FT_TRUETYPE_TABLES_H
+#include FT_TRUETYPE_TAGS_H
 #include FT_BITMAP_H
 
 // implicit conversion
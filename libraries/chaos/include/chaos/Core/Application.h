@@ -27,6 +27,13 @@ namespace chaos
 		/** getter of the singleton instance */
 		static AutoConstCastable<Application> GetConstInstance() { return singleton_instance; }
 
+		/** get the job system */
+		JobSystem* GetJobSystem() { return job_system.get(); }
+		/** get the job system */
+		JobSystem const* GetJobSystem() const { return job_system.get(); }
+		/** getter of the job system */
+		static JobSystem* GetJobSystemInstance();
+
 		/** get the name of the application */
 		char const* GetName() const { return application_name.c_str(); }
 		/** get the name of the application */
@@ -100,6 +107,8 @@ namespace chaos
 
 		/** initialization relative to ConfigurableInterface */
 		bool InitializeConfiguration();
+		/** apply the "logger" entry of the configuration (line count limit and asynchronous mode) */
+		bool InitializeLoggerFromConfiguration();
 
 		/** load the extra classes */
 		virtual bool LoadClasses();
@@ -116,6 +125,9 @@ namespace chaos
 		/** the single application instance */
 		static Application* singleton_instance;
 
+		/** the job system shared by all parallel processing */
+		shared_ptr<JobSystem> job_system;
+
 		/** the name of the application */
 		std::string application_name;
 		/** the application parameters */
@@ -110,6 +110,9 @@ namespace chaos
 		bool HasCyclicParent() const;
 #endif // #if _DEBUG
 
+		/** compute the ancestors bitset if the whole parent chain is declared. returns whether the cache is valid */
+		bool UpdateAncestorsCache() const;
+
 		/** object initialization function */
 		virtual void OnObjectInstanceInitialized(Object* object) const;
 
@@ -140,6 +143,12 @@ namespace chaos
 		std::type_info const* info = nullptr;
 		/** the manager for this class */
 		ClassManager* manager = nullptr;
+		/** an unique index for the class (used for the ancestors bitset) */
+		size_t class_index = 0;
+		/** a bitset (indexed by class_index) of all the ancestors of the class. Written once (under a lock) before ancestors_cached is set, read-only afterwards */
+		mutable std::vector<bool> ancestors;
+		/** whether the ancestors bitset has been computed (atomic so that InheritsFrom(...) can be used from any thread) */
+		mutable std::atomic<bool> ancestors_cached = false;
 	};
 
 #endif
@@ -48,17 +48,17 @@ namespace chaos
 		/** find a class by name */
 		ClassFindResult FindClass(char const* name, FindClassFlags flags = FindClassFlags::ALL);
 
-		/** find a class by type */
+		/** find a class by type (never modifies the manager, so this can be used from any thread once classes are declared) */
 		template<typename CLASS_TYPE>
-		Class const* FindCPPClass(bool search_manager_hierarchy = true)
+		Class const* FindCPPClass(bool search_manager_hierarchy = true) const
 		{
-			if (Class* result = FindOrCreateCPPClassInstance<CLASS_TYPE>(search_manager_hierarchy))
+			if (Class* result = FindCPPClassInstance(typeid(CLASS_TYPE), search_manager_hierarchy))
 				if (result->IsDeclared())
 					return result;
 			return nullptr;
 		}
 
-		/** declare a class */
+		/** declare a class (declarations are not thread safe: they happen at startup, on the main thread) */
 		template<typename CLASS_TYPE, typename PARENT_CLASS_TYPE = EmptyClass>
 		ClassRegistration DeclareCPPClass(std::string name)
 		{
@@ -103,6 +103,9 @@ namespace chaos
 
 	protected:
 
+		/** search the C++ class corresponding to a type_info (no creation) */
+		Class* FindCPPClassInstance(std::type_info const& info, bool search_manager_hierarchy) const;
+
 		/** return the class of a class with its given info */
 		template<typename CLASS_TYPE>
 		Class* FindOrCreateCPPClassInstance(bool search_manager_hierarchy)
@@ -110,21 +113,14 @@ namespace chaos
 			std::type_info const& info = typeid(CLASS_TYPE);
 
 			// search if the class as already been registered in manager chain
-			ClassManager* manager = this;
-			while (manager != nullptr)
-			{
-				for (Class* cls : manager->classes)
-					if (cls->info != nullptr && *cls->info == info)
-						return cls;
-				if (!search_manager_hierarchy)
-					break;
-				manager = manager->parent_manager.get();
-			}
+			if (Class* result = FindCPPClassInstance(info, search_manager_hierarchy))
+				return result;
 			// register the class
 			if (Class* result = new Class(std::string())) // do not name the class yet
 			{
 				result->info = &info;
 				InsertClass(result);
+				cpp_classes[std::type_index(info)] = result;
 				return result;
 			}
 			return nullptr;
@@ -136,6 +132,8 @@ namespace chaos
 		shared_ptr<ClassManager> parent_manager;
 		/** the classes owned by this manager */
 		std::vector<Class*> classes;
+		/** the C++ classes owned by this manager, indexed by their type (JSON classes share the type_info of their parent and are not in this map) */
+		std::unordered_map<std::type_index, Class*> cpp_classes;
 	};
 
 #endif
@@ -232,6 +232,9 @@ namespace chaos
 	* Event that can be triggered by clock
 	*/
 
+	// XXX : while the event is registered in a clock, its start_time must only be changed by the clock itself
+	//       (an event waits in the clock's sleeping heap according to the start_time it was registered with)
+
 	class CHAOS_API ClockEvent : public Object
 	{
 		friend class Clock;
@@ -281,6 +284,14 @@ namespace chaos
 		int execution_count = 0;
 		/** the clock it belongs to */
 		class Clock* clock = nullptr;
+		/** the index of the event in the clock's pending_events */
+		size_t pending_index = 0;
+		/** the index of the event in the clock's sleeping_events or awake_events */
+		size_t schedule_index = 0;
+		/** whether the event is waiting in the clock's sleeping_events */
+		bool sleeping = false;
+		/** the start time the event is waiting for */
+		double wakeup_time = 0.0;
 	};
 
 	/**
@@ -402,6 +413,17 @@ namespace chaos
 		/** ensure given clock is a child of the hierarchy tree */
 		bool IsDescendantClock(Clock const* child_clock) const;
 
+		/** insert an event into the sleeping heap or into the awake events */
+		void ScheduleEvent(ClockEvent* clock_event, bool awake);
+		/** remove an event from the sleeping heap or from the awake events */
+		void UnscheduleEvent(ClockEvent* clock_event);
+		/** restore the heap property for the sleeping event at given index */
+		void SiftSleepingEvent(size_t index);
+		/** insert an index into the current scan (ignored if already present) */
+		void InsertScanIndex(size_t index);
+		/** remove an index from the current scan (returns whether it was present) */
+		bool RemoveScanIndex(size_t index);
+
 	protected:
 
 		/** the parent clock */
@@ -419,6 +441,19 @@ namespace chaos
 
 		/** the events */
 		std::vector<shared_ptr<ClockEvent>> pending_events;
+		/** the events whose start time is not reached yet (min-heap on wakeup_time) */
+		std::vector<ClockEvent*> sleeping_events;
+		/** the events to be considered on each tick */
+		std::vector<ClockEvent*> awake_events;
+
+		/** the indices (in pending_events) of the awake events not processed yet by the current scan (sorted in decreasing order, so that the next one is at the back. The storage is reused between ticks) */
+		std::vector<size_t> scan_indices;
+		/** the index of the event being processed by the current scan */
+		size_t scan_cursor = 0;
+		/** the end of the time slice of the current scan */
+		double scan_max_time = 0.0;
+		/** whether the events are being scanned */
+		bool scanning = false;
 		/** the child clocks */
 		std::vector<shared_ptr<Clock>> children_clocks;
 	};
@@ -30,6 +30,7 @@
 #include "chaos/Core/Object.h"
 #include "chaos/Core/ObjectRequest.h"
 #include "chaos/Core/NamedInterface.h"
+#include "chaos/Core/NamedObjectIndex.h"
 #include "chaos/Core/NamedObjectFilter.h"
 #include "chaos/Core/ClassManager.h"
 #include "chaos/Core/Copyable.h"
@@ -57,11 +58,13 @@
 #include "chaos/Core/InputState.h"
 #include "chaos/Core/KeyboardState.h"
 #include "chaos/Core/InputEventReceiverInterface.h"
+#include "chaos/Core/JobSystem.h"
 #include "chaos/Core/Application.h"
 #include "chaos/Core/ResourceManager.h"
 #include "chaos/Core/ResourceManagerLoader.h"
 #include "chaos/Core/Tickable.h"
 #include "chaos/Core/ClockManager.h"
+#include "chaos/Core/FixedTimeStep.h"
 #include "chaos/Core/BufferReader.h"
 #include "chaos/Core/StateMachine.h"
 #include "chaos/Core/PriorityQueue.h"
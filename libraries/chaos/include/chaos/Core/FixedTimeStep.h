@@ -0,0 +1,86 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class FixedTimeStep;
+	class FramePacer;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* FixedTimeStep : splits the real elapsed time into fixed simulation steps
+	*/
+
+	// XXX : the time that is not consumed by a step is accumulated for next frames.
+	//       Whenever too many steps would be required (the simulation cannot keep up with real time), the excess time is dropped
+	//       Durations are doubles : with floats, the rounding of the step duration is enough to lose steps (249 steps per second at 250Hz)
+
+	class CHAOS_API FixedTimeStep
+	{
+	public:
+
+		/** returns whether fixed steps are enabled */
+		bool IsEnabled() const { return (step_duration > 0.0); }
+
+		/** change the duration of a step (0 to disable) */
+		void SetStepDuration(double in_step_duration);
+		/** get the duration of a step */
+		double GetStepDuration() const { return step_duration; }
+
+		/** change the maximum number of steps for a single frame (0 for no limit) */
+		void SetMaxStepCount(int in_max_step_count);
+		/** get the maximum number of steps for a single frame */
+		int GetMaxStepCount() const { return max_step_count; }
+
+		/** accumulate the frame time and returns the number of steps to run */
+		int AdvanceTime(double delta_time);
+		/** get the number of steps that have been dropped because the simulation could not keep up */
+		uint64_t GetDroppedStepCount() const { return dropped_step_count; }
+
+		/** drop the accumulated time */
+		void Reset();
+
+	protected:
+
+		/** the duration of a step */
+		double step_duration = 0.0;
+		/** the maximum number of steps for a single frame */
+		int max_step_count = 5;
+		/** the time not consumed by steps yet */
+		double accumulated_time = 0.0;
+		/** the number of steps that have been dropped */
+		uint64_t dropped_step_count = 0;
+	};
+
+	/**
+	* FramePacer : wait until the next frame is due so that a target frame rate is not exceeded
+	*/
+
+	class CHAOS_API FramePacer
+	{
+	public:
+
+		/** returns whether frame pacing is enabled */
+		bool IsEnabled() const { return (target_frame_rate > 0.0f); }
+
+		/** change the target frame rate (0 to disable) */
+		void SetTargetFrameRate(float in_target_frame_rate);
+		/** get the target frame rate */
+		float GetTargetFrameRate() const { return target_frame_rate; }
+
+		/** block the thread until the next frame is due */
+		void WaitNextFrame();
+
+	protected:
+
+		/** the target frame rate */
+		float target_frame_rate = 0.0f;
+		/** the time at which the next frame is due */
+		std::chrono::steady_clock::time_point next_frame_time;
+		/** whether next_frame_time is meaningful */
+		bool started = false;
+	};
+
+#endif
+
+}; // namespace chaos
@@ -0,0 +1,156 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class Job;
+	class JobCounter;
+	class JobSystem;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* Job : a function to be executed by the job system
+	*/
+
+	class CHAOS_API Job
+	{
+	public:
+
+		/** the function to execute */
+		std::function<void()> func;
+		/** the counter decremented once the function is executed */
+		JobCounter* counter = nullptr;
+	};
+
+	/**
+	* JobCounter : counts the jobs not executed yet. Jobs may wait for a counter to reach 0 before being started
+	*/
+
+	// XXX : a counter must outlive all the jobs that reference it (JobSystem::Wait(...) ensures this)
+
+	class CHAOS_API JobCounter
+	{
+		friend class JobSystem;
+
+	public:
+
+		/** returns whether all jobs are executed */
+		bool IsDone() const { return (pending_count.load(std::memory_order_acquire) == 0); }
+		/** returns the number of jobs not executed yet */
+		int GetPendingCount() const { return pending_count.load(std::memory_order_acquire); }
+
+	protected:
+
+		/** the number of jobs not executed yet */
+		std::atomic<int> pending_count = 0;
+		/** protects the dependent jobs and the end of the jobs */
+		std::mutex mutex;
+		/** the jobs that wait for the counter to reach 0 */
+		std::vector<Job> dependent_jobs;
+	};
+
+	/**
+	* JobSystem : a pool of worker threads with work stealing
+	*/
+
+	// XXX : each worker has its own queue. A worker pushes and pops its jobs at the back (most recent first) while idle workers
+	//       steal the oldest jobs at the front of the other queues. Threads that are not workers push their jobs into a shared queue.
+	//       The waiting threads help executing jobs, so that a job may itself wait for other jobs
+
+	class CHAOS_API JobSystem : public Object
+	{
+	public:
+
+		/** constructor */
+		JobSystem();
+		/** destructor */
+		virtual ~JobSystem();
+
+		/** start the workers (0 for one worker per hardware thread except the calling thread) */
+		bool StartWorkers(size_t worker_count = 0);
+		/** stop the workers once all scheduled jobs are executed (must not be called while jobs are scheduled from other threads) */
+		void StopWorkers();
+		/** get the number of workers */
+		size_t GetWorkerCount() const { return workers.size(); }
+
+		/** schedule a job (started once the dependency, if any, reaches 0) */
+		void Schedule(std::function<void()> func, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+		/** execute jobs until the counter reaches 0 */
+		void Wait(JobCounter& counter);
+
+		/** call func(begin, end) on ranges of [0, count) whose size is grain_size at most. Returns once all ranges are processed */
+		template<typename FUNC>
+		void ParallelFor(size_t count, size_t grain_size, FUNC const& func)
+		{
+			if (count == 0)
+				return;
+			grain_size = std::max(grain_size, size_t(1));
+
+			size_t chunk_count = (count + grain_size - 1) / grain_size;
+			size_t job_count = std::min(chunk_count, GetWorkerCount() + 1); // the calling thread works too
+			if (job_count <= 1)
+			{
+				for (size_t i = 0; i < chunk_count; ++i)
+					func(i * grain_size, std::min(count, (i + 1) * grain_size));
+				return;
+			}
+
+			// each participant takes the next range to process, so that ranges of different costs are balanced
+			std::atomic<size_t> next_chunk = 0;
+
+			auto process_chunks = [count, grain_size, chunk_count, &func, &next_chunk]()
+			{
+				for (size_t i = next_chunk++; i < chunk_count; i = next_chunk++)
+					func(i * grain_size, std::min(count, (i + 1) * grain_size));
+			};
+
+			JobCounter counter;
+			for (size_t i = 1; i < job_count; ++i)
+				Schedule(process_chunks, &counter);
+			process_chunks();
+			Wait(counter);
+		}
+
+	protected:
+
+		/** a queue of jobs */
+		class JobQueue
+		{
+		public:
+
+			/** protects the jobs */
+			std::mutex mutex;
+			/** the jobs */
+			std::deque<Job> jobs;
+		};
+
+		/** the main function of the workers */
+		void WorkerMain(size_t queue_index);
+		/** push a job into the queue of the calling thread */
+		void PushJob(Job job);
+		/** pop a job from the queue of the calling thread or steal one from another queue */
+		bool PopJob(Job& result);
+		/** execute one job if any. Returns false whether no job was found */
+		bool ExecuteOneJob();
+		/** notify the end of a job to its counter */
+		void CompleteJob(JobCounter* counter);
+
+	protected:
+
+		/** the queues of the workers followed by the shared queue */
+		std::vector<std::unique_ptr<JobQueue>> queues;
+		/** the worker threads */
+		std::vector<std::thread> workers;
+		/** the number of jobs inside the queues */
+		std::atomic<size_t> queued_job_count = 0;
+		/** whether the workers are to be stopped */
+		std::atomic<bool> stopping = false;
+		/** used by workers to sleep while there is no job */
+		std::mutex sleep_mutex;
+		/** used by workers to sleep while there is no job */
+		std::condition_variable sleep_condition;
+	};
+
+#endif
+
+}; // namespace chaos
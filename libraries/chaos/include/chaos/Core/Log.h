@@ -3,7 +3,10 @@ namespace chaos
 #ifdef CHAOS_FORWARD_DECLARATION
 
 	enum class LogSeverity;
+	enum class LogOverflowPolicy;
 	class LogLine;
+	class LogRecord;
+	class LogRecordRing;
 	class LoggerListener;
 	class FileLoggerListener;
 	class Logger;
@@ -28,6 +31,18 @@ namespace chaos
 
 	CHAOS_DECLARE_ENUM_METHOD(LogSeverity, CHAOS_API);
 
+	/**
+	* LogOverflowPolicy: what to do with a new line when the asynchronous ring is full
+	*/
+
+	enum class CHAOS_API LogOverflowPolicy : int
+	{
+		DropNewest,
+		OverwriteOldest
+	};
+
+	CHAOS_DECLARE_ENUM_METHOD(LogOverflowPolicy, CHAOS_API);
+
 	/**
 	* LogLine : an entry in the log system
 	*/
@@ -55,6 +70,60 @@ namespace chaos
 		std::string content;
 	};
 
+	/**
+	* LogRecord : a preformatted line waiting in the asynchronous ring
+	*/
+
+	class CHAOS_API LogRecord
+	{
+	public:
+
+		/** the max size of the content (longer contents are truncated) */
+		static constexpr size_t MAX_CONTENT_SIZE = 4096;
+
+		/** the sequence number used for synchronization */
+		std::atomic<size_t> sequence = 0;
+		/** the date of post */
+		std::chrono::system_clock::time_point time;
+		/** the severity of the message */
+		LogSeverity severity = LogSeverity::Message;
+		/** the domain of the message */
+		char const* domain = nullptr;
+		/** the content of the message (its storage grows on demand and is reused by next rounds) */
+		std::string content;
+	};
+
+	/**
+	* LogRecordRing : a fixed capacity lock-free queue of records (multiple producers, multiple consumers)
+	*/
+
+	class CHAOS_API LogRecordRing
+	{
+	public:
+
+		/** constructor (capacity is rounded up to a power of 2) */
+		LogRecordRing(size_t in_capacity);
+
+		/** get the capacity */
+		size_t GetCapacity() const { return capacity; }
+
+		/** push a record (returns false if the ring is full) */
+		bool Push(char const* domain, LogSeverity severity, std::chrono::system_clock::time_point time, std::string_view content);
+		/** pop a record and convert it to a line (returns false if the ring is empty) */
+		bool Pop(LogLine& result);
+
+	protected:
+
+		/** the capacity */
+		size_t capacity = 0;
+		/** the records */
+		std::unique_ptr<LogRecord[]> records;
+		/** the position where to push */
+		alignas(64) std::atomic<size_t> push_position = 0;
+		/** the position where to pop */
+		alignas(64) std::atomic<size_t> pop_position = 0;
+	};
+
 	/**
 	* LoggerListener : an object dedicated to wait for entries
 	*/
@@ -125,12 +194,15 @@ namespace chaos
 
 		/** an additionnal output */
 		std::ofstream output_file;
-		/** last line index handled */
+		/** last line index written when attached (the lines notified afterwards are more recent) */
 		std::optional<size_t> last_line_index_handled;
 	};
 
 	/**
 	* Logger : deserve to output some logs
+	*
+	* In asynchronous mode, the callers only push preformatted records into a fixed capacity ring.
+	* A background thread converts them into lines, stores them and notifies the listeners (so file I/O happens on that thread).
 	*/
 
 	class CHAOS_API Logger : public Object
@@ -141,6 +213,9 @@ namespace chaos
 
 	public:
 
+		/** the default max number of lines kept in memory (0 for no limit) */
+		static constexpr size_t DEFAULT_MAX_LINE_COUNT = 0;
+
 		/** destructor */
 		virtual ~Logger();
 
@@ -192,11 +267,31 @@ namespace chaos
 		/** whether a transaction is started */
 		bool IsTransactionInProgress() const;
 
-		/** get the entries */
-		std::vector<LogLine> const& GetLines() const
+		/** call a function with the stored lines (the lines cannot change during the call) */
+		template<typename FUNC>
+		decltype(auto) WithLines(FUNC const& func) const
 		{
-			return GetInstance()->lines;
+			std::lock_guard<std::recursive_mutex> lock(lines_mutex);
+			return func(lines);
 		}
+		/** change the max number of lines kept in memory (0 for no limit) */
+		void SetMaxLineCount(size_t in_max_line_count);
+		/** get the max number of lines kept in memory */
+		size_t GetMaxLineCount() const { return max_line_count; }
+
+		/** start the asynchronous mode */
+		void StartAsynchronousMode(size_t ring_capacity = 1024, LogOverflowPolicy in_overflow_policy = LogOverflowPolicy::DropNewest);
+		/** stop the asynchronous mode (pending records are handled) */
+		void StopAsynchronousMode();
+		/** whether the logger is in asynchronous mode */
+		bool IsAsynchronousMode() const { return (ring != nullptr); }
+		/** wait until all pending records have been handled */
+		void Flush();
+
+		/** get the number of lines that have been lost because the ring was full */
+		size_t GetDroppedLineCount() const { return dropped_line_count; }
+		/** get the number of lines that have been overwritten because the ring was full */
+		size_t GetOverwrittenLineCount() const { return overwritten_line_count; }
 
 		/** get the number of listeners */
 		size_t GetListenerCount() const { return listeners.size(); }
@@ -206,9 +301,9 @@ namespace chaos
 		LoggerListener const* GetListener(size_t index) const { return listeners[index].get(); }
 
 		/** get the number of domains */
-		size_t GetDomainCount() const { return domains.size(); }
+		size_t GetDomainCount() const;
 		/** get a given domain */
-		char const * GetDomain(size_t index) const { return domains[index]->c_str(); }
+		char const * GetDomain(size_t index) const;
 
 	protected:
 
@@ -224,6 +319,10 @@ namespace chaos
 
 		/** internal method to display a log */
 		virtual void DoOutput(char const * domain, LogSeverity severity, std::string_view buffer);
+		/** store a line and notify the listeners */
+		void DoOutputLine(LogLine& new_line);
+		/** the function of the background thread */
+		void AsynchronousThreadMain();
 
 		/** register a string for domain and gets its internal pointer */
 		char const* RegisterDomain(std::string_view domain);
@@ -231,9 +330,36 @@ namespace chaos
 	protected:
 
 		/** the line displayed */
-		std::vector<LogLine> lines;
+		std::deque<LogLine> lines;
+		/** the max number of lines kept in memory (0 for no limit) */
+		size_t max_line_count = DEFAULT_MAX_LINE_COUNT;
+		/** protect the lines and the listeners list */
+		mutable std::recursive_mutex lines_mutex;
+		/** serialize the notifications of the listeners (the lines are not locked meanwhile) */
+		std::recursive_mutex notification_mutex;
 		/** domains. store domains only once */
 		std::vector<std::string *> domains;
+		/** protect the domains */
+		mutable std::mutex domains_mutex;
+
+		/** the ring for asynchronous mode */
+		std::unique_ptr<LogRecordRing> ring;
+		/** what to do when the ring is full */
+		LogOverflowPolicy overflow_policy = LogOverflowPolicy::DropNewest;
+		/** the background thread */
+		std::thread asynchronous_thread;
+		/** whether the background thread must stop */
+		std::atomic<bool> asynchronous_stop_requested = false;
+		/** incremented to wake the background thread up */
+		std::atomic<size_t> wakeup_count = 0;
+		/** the number of records pushed */
+		std::atomic<size_t> pushed_record_count = 0;
+		/** the number of records handled by the background thread (or overwritten) */
+		std::atomic<size_t> handled_record_count = 0;
+		/** the number of lines lost */
+		std::atomic<size_t> dropped_line_count = 0;
+		/** the number of lines overwritten */
+		std::atomic<size_t> overwritten_line_count = 0;
 		/** listeners */
 		std::vector<shared_ptr<LoggerListener>> listeners;
 
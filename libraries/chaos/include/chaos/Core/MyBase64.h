@@ -20,6 +20,8 @@ namespace chaos
 
 		/** returns true whether the input is a valid character */
 		static bool IsBase64(unsigned char c);
+		/** decode the text by parts, stopping at the first non base64 character (src is advanced). Returns the number of bytes written (0 when the text is finished) */
+		static size_t DecodePart(char const*& src, unsigned char* dst, size_t dst_size);
 
 	protected:
 
@@ -27,6 +29,8 @@ namespace chaos
 		static void EncodeBuffer(unsigned char const* char_array_3, unsigned char* char_array_4);
 		/** utility function to decode 4 bytes into 3 bytes */
 		static void DecodeBuffer(unsigned char const* char_array_4, unsigned char* char_array_3);
+		/** get the index of a base64 character (-1 for invalid characters) */
+		static int GetCharacterIndex(unsigned char c);
 
 	protected:
 
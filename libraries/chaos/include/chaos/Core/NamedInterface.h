@@ -2,15 +2,36 @@ namespace chaos
 {
 #ifdef CHAOS_FORWARD_DECLARATION
 
+	class NamingObserver;
 	class NamedInterface;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	/** an object that is notified whenever an observed NamedInterface is renamed (see NamedObjectIndex) */
+	class CHAOS_API NamingObserver : public Object
+	{
+	public:
+
+		/** whether an observed object has been renamed since the flag was reset */
+		bool naming_changed = false;
+	};
+
 	/** a class that describe an object that can be reference by tag and by name */
 	class CHAOS_API NamedInterface
 	{
 	public:
 
+		/** constructor */
+		NamedInterface() = default;
+		/** copy constructor (the observers are not copied: the new object is not in the containers of the source) */
+		NamedInterface(NamedInterface const& src);
+		/** move constructor (the observers are not moved: the new object is not in the containers of the source) */
+		NamedInterface(NamedInterface&& src);
+		/** copy operator (the naming of an existing object changes) */
+		NamedInterface& operator = (NamedInterface const& src);
+		/** move operator (the naming of an existing object changes) */
+		NamedInterface& operator = (NamedInterface&& src);
+
 		/** get the name of the object */
 		char const* GetName() const { return name.c_str(); }
 		/** get the Tag of the object */
@@ -19,17 +40,27 @@ namespace chaos
 		/** change the name of the object */
 		void SetName(char const* in_name);
 		/** change the tag of the object */
-		void SetTag(TagType in_tag) { tag = in_tag; }
+		void SetTag(TagType in_tag);
 
 		/** change the naming of the object */
 		void SetObjectNaming(ObjectRequest request);
 
+		/** register an observer to be notified of the next naming change */
+		void AddNamingObserver(NamingObserver* observer) const;
+
+	protected:
+
+		/** notify the observers that the naming of the object changed (they are then unregistered) */
+		void OnNamingChanged();
+
 	protected:
 
 		/** the name of the object */
 		std::string name;
 		/** the tag of the object */
 		TagType tag = 0;
+		/** the observers of the naming (the indexes of the containers of this object) */
+		mutable std::vector<weak_ptr<NamingObserver>> naming_observers;
 	};
 
 	/** NamedInterfaceWrapper : this is a wrapper to ba able to use NamedInterface's static methods */
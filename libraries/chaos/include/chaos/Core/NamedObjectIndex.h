@@ -0,0 +1,127 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class NamedObjectIndex;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* NamedObjectIndex : an opt-in hash index (case insensitive name + tag) for a vector of named objects
+	*
+	* The index is stored beside the vector by the owner and is lazily rebuilt on the next search whenever one of its elements is renamed
+	* (the index observes the naming of its elements, see NamingObserver).
+	* The owner must call Invalidate() each time it modifies the vector (insertion, removal, replacement, clear).
+	* As the vector itself, it is not thread safe: searches may rebuild the index.
+	*/
+
+	class CHAOS_API NamedObjectIndex
+	{
+	public:
+
+		/** constructor */
+		NamedObjectIndex() = default;
+		/** copy constructor (nothing is copied: the index is built on first use) */
+		NamedObjectIndex(NamedObjectIndex const&) {}
+		/** copy operator (nothing is copied: the index is rebuilt on next use) */
+		NamedObjectIndex& operator = (NamedObjectIndex const&);
+
+		/** force the index to be rebuilt on next search */
+		void Invalidate();
+
+		/** search element in a vector */
+		template<typename CHECK_CLASS = EmptyClass, typename P>
+		std::optional<size_t> FindObjectIndex(ObjectRequest const& request, std::vector<P> const& elements) const;
+
+		/** compute a case insensitive hash for a name */
+		static uint64_t GetNameHash(char const* name);
+
+	protected:
+
+		/** search the candidates in a bucket (in increasing index order, so the result is the same than with a linear search) */
+		template<typename CHECK_CLASS, typename P>
+		static std::optional<size_t> FindInBucket(ObjectRequest const& request, std::vector<P> const& elements, std::vector<size_t> const* bucket);
+		/** rebuild the index if it was invalidated or if an element has been renamed */
+		template<typename P>
+		void Update(std::vector<P> const& elements) const;
+
+	protected:
+
+		/** whether the index must be rebuilt (the index is lazily built from const searches) */
+		mutable bool dirty = true;
+		/** the observer registered on the elements (notified whenever one of them is renamed) */
+		mutable shared_ptr<NamingObserver> naming_observer;
+		/** the elements per name hash */
+		mutable std::unordered_map<uint64_t, std::vector<size_t>> name_map;
+		/** the elements per tag */
+		mutable std::unordered_map<TagType, std::vector<size_t>> tag_map;
+	};
+
+#else
+
+	template<typename CHECK_CLASS, typename P>
+	std::optional<size_t> NamedObjectIndex::FindObjectIndex(ObjectRequest const& request, std::vector<P> const& elements) const
+	{
+		// early exit
+		if (request.IsNoneRequest())
+			return {};
+		// nothing to hash
+		if (!request.IsStringRequest() && !request.IsTagRequest())
+			return request.FindObjectIndex<CHECK_CLASS>(elements);
+
+		Update(elements);
+
+		if (request.IsStringRequest())
+		{
+			auto it = name_map.find(GetNameHash(request.name));
+			return FindInBucket<CHECK_CLASS>(request, elements, (it == name_map.end()) ? nullptr : &it->second);
+		}
+		auto it = tag_map.find(request.tag);
+		return FindInBucket<CHECK_CLASS>(request, elements, (it == tag_map.end()) ? nullptr : &it->second);
+	}
+
+	template<typename CHECK_CLASS, typename P>
+	std::optional<size_t> NamedObjectIndex::FindInBucket(ObjectRequest const& request, std::vector<P> const& elements, std::vector<size_t> const* bucket)
+	{
+		if (bucket == nullptr)
+			return {};
+		for (size_t index : *bucket)
+		{
+			auto e = meta::get_raw_pointer(elements[index]);
+			if (request.Match(*e)) // hash collisions
+				if (ObjectRequest::CheckClass<CHECK_CLASS>(e))
+					return index;
+		}
+		return {};
+	}
+
+	template<typename P>
+	void NamedObjectIndex::Update(std::vector<P> const& elements) const
+	{
+		if (!dirty && naming_observer != nullptr && !naming_observer->naming_changed)
+			return;
+
+		if (naming_observer == nullptr)
+			naming_observer = new NamingObserver;
+		naming_observer->naming_changed = false;
+
+		name_map.clear();
+		tag_map.clear();
+
+		size_t count = elements.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			auto e = meta::get_raw_pointer(elements[i]);
+			if (e == nullptr)
+				continue;
+			name_map[GetNameHash(e->GetName())].push_back(i);
+			tag_map[e->GetTag()].push_back(i);
+			e->AddNamingObserver(naming_observer.get());
+		}
+
+		dirty = false;
+	}
+
+#endif
+
+}; // namespace chaos
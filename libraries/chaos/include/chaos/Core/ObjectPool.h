@@ -9,6 +9,8 @@ namespace chaos
 
 	/**
 	* This is an allocator that use in internal ObjectPool64
+	*
+	* Nodes are allocated on an alignment greater than their size, so that the node owning an object is found by masking its address
 	**/
 	template<typename T>
 	class ObjectPool
@@ -24,8 +26,31 @@ namespace chaos
 
 			using node_type = ObjectPool64Node<U>;
 
+		public:
+
+			/** the alignment of the nodes (a power of 2, greater than the node size) */
+			static size_t GetNodeAlignment()
+			{
+				return std::bit_ceil(sizeof(node_type));
+			}
+
+			/** aligned allocation */
+			static void* operator new(size_t size)
+			{
+				assert(size <= GetNodeAlignment());
+				return ::operator new(size, std::align_val_t(GetNodeAlignment()));
+			}
+
+			/** aligned deallocation */
+			static void operator delete(void* ptr)
+			{
+				::operator delete(ptr, std::align_val_t(GetNodeAlignment()));
+			}
+
 		protected:
 
+			/** the pool owning the node */
+			void const* owner = nullptr;
 			/** the next pool node in the pool */
 			node_type* previous_node = nullptr;
 			/** the previous pool node in the pool */
@@ -51,6 +76,8 @@ namespace chaos
 				delete(node);
 			while (node_type* node = ExtractFirstNode(unavailable_nodes))
 				delete(node);
+			while (node_type* node = ExtractFirstNode(unused_nodes))
+				delete(node);
 		}
 
 		/** release an object inside the pool for further usage */
@@ -58,7 +85,16 @@ namespace chaos
 		{
 			if (object != nullptr)
 			{
-				if (node_type* node = SearchOwningNode(used_nodes, object))
+				node_type* node = GetOwningNode(object);
+				assert(node->owner == this); // object does not belong to this pool
+
+				if (!node->HasAvailableInstanceLeft())
+				{
+					ExtractNode(unavailable_nodes, node); // now, the node has a single available entry. it belongs to used_nodes
+					InsertNode(used_nodes, node);
+					node->Free(object);
+				}
+				else
 				{
 					if (node->GetReservedCount() == 1) // the last object is about to be removed from the node. the node now belongs to unused
 					{
@@ -76,19 +112,17 @@ namespace chaos
 						--unused_node_count;
 					}
 				}
-				else if (node_type* node = SearchOwningNode(unavailable_nodes, object))
-				{
-					ExtractNode(unavailable_nodes, node); // now, the node has a single available entry. it belongs to used_nodes
-					InsertNode(used_nodes, node);
-					node->Free(object);
-				}
-				else
-				{
-					assert(0); // object does not belong to this pool
-				}
 			}
 		}
 
+		/** release several objects */
+		void FreeN(type* const* objects, size_t count)
+		{
+			assert(objects != nullptr || count == 0);
+			for (size_t i = 0; i < count; ++i)
+				Free(objects[i]);
+		}
+
 		/** allocate a new object from pool */
 		template<typename ...PARAMS>
 		type* Allocate(PARAMS ...params)
@@ -105,6 +139,7 @@ namespace chaos
 				// need a new node
 				else if (node_type* new_node = new node_type)
 				{
+					new_node->owner = this;
 					InsertNode(used_nodes, new_node);
 				}
 				// failure
@@ -125,6 +160,20 @@ namespace chaos
 			return nullptr;
 		}
 
+		/** allocate several objects from pool (returns the number of objects effectively allocated) */
+		template<typename ...PARAMS>
+		size_t AllocateN(type** results, size_t count, PARAMS ...params)
+		{
+			assert(results != nullptr || count == 0);
+			for (size_t i = 0; i < count; ++i)
+			{
+				results[i] = Allocate(params...);
+				if (results[i] == nullptr)
+					return i;
+			}
+			return count;
+		}
+
 		/** change the maximum number of unused nodes */
 		void SetMaxUnusedNodeCount(std::optional<size_t> count)
 		{
@@ -217,16 +266,13 @@ namespace chaos
 			node->previous_node = node->next_node = nullptr;
 		}
 
-		/** search a node that contains the object */
-		node_type* SearchOwningNode(node_type* node, type const* object)
+		/** get the node that contains the object (by masking its address) */
+		static node_type* GetOwningNode(type const* object)
 		{
-			while (node != nullptr)
-			{
-				if (node->IsObjectInsidePool(object))
-					return node;
-				node = node->next_node;
-			}
-			return nullptr;
+			assert(object != nullptr);
+			node_type* result = (node_type*)(uintptr_t(object) & ~uintptr_t(node_type::GetNodeAlignment() - 1));
+			assert(result->IsObjectInsidePool(object));
+			return result;
 		}
 
 		/** extract the first node (if any) of a given list */
@@ -161,6 +161,16 @@ namespace chaos
 			return {};
 		}
 
+		/** search element in a vector with the help of an index */
+		template<typename CHECK_CLASS = EmptyClass, typename P>
+		auto FindObject(std::vector<P>& elements, NamedObjectIndex const& index) const -> decltype(meta::get_raw_pointer(elements[0]));
+		/** search element in a vector with the help of an index */
+		template<typename CHECK_CLASS = EmptyClass, typename P>
+		auto FindObject(std::vector<P> const& elements, NamedObjectIndex const& index) const -> decltype(meta::get_raw_pointer(elements[0]));
+		/** search element in a vector with the help of an index */
+		template<typename CHECK_CLASS = EmptyClass, typename P>
+		std::optional<size_t> FindObjectIndex(std::vector<P> const& elements, NamedObjectIndex const& index) const;
+
 		/** check whether the element match the wanted class */
 		template<typename CHECK_CLASS = EmptyClass, typename T>
 		static bool CheckClass(T const* element)
@@ -181,6 +191,32 @@ namespace chaos
 		ObjectRequestType request_type = ObjectRequestType::NONE;
 	};
 
+#else
+
+	template<typename CHECK_CLASS, typename P>
+	auto ObjectRequest::FindObject(std::vector<P>& elements, NamedObjectIndex const& index) const -> decltype(meta::get_raw_pointer(elements[0]))
+	{
+		std::optional<size_t> result = index.FindObjectIndex<CHECK_CLASS>(*this, elements);
+		if (result.has_value())
+			return meta::get_raw_pointer(elements[*result]);
+		return nullptr;
+	}
+
+	template<typename CHECK_CLASS, typename P>
+	auto ObjectRequest::FindObject(std::vector<P> const& elements, NamedObjectIndex const& index) const -> decltype(meta::get_raw_pointer(elements[0]))
+	{
+		std::optional<size_t> result = index.FindObjectIndex<CHECK_CLASS>(*this, elements);
+		if (result.has_value())
+			return meta::get_raw_pointer(elements[*result]);
+		return nullptr;
+	}
+
+	template<typename CHECK_CLASS, typename P>
+	std::optional<size_t> ObjectRequest::FindObjectIndex(std::vector<P> const& elements, NamedObjectIndex const& index) const
+	{
+		return index.FindObjectIndex<CHECK_CLASS>(*this, elements);
+	}
+
 #endif
 
 }; // namespace chaos
\ No newline at end of file
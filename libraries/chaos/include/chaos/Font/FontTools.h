@@ -13,6 +13,7 @@ namespace chaos
 	{
 		class CharacterMetrics;
 		class CharacterBitmapGlyph;
+		class KerningPair;
 
 	}; // namespace FontTools
 
@@ -112,6 +113,19 @@ namespace chaos
 			FT_BitmapGlyph bitmap_glyph = nullptr;
 		};
 
+		/** Horizontal kerning between two characters */
+		class CHAOS_API KerningPair
+		{
+		public:
+
+			/** the first character */
+			uint32_t left_charcode = 0;
+			/** the second character */
+			uint32_t right_charcode = 0;
+			/** the horizontal adjustment in pixels */
+			int x = 0;
+		};
+
 		/** get an image description from a FT_Bitmap object */
 		CHAOS_API ImageDescription GetImageDescription(FT_Bitmap const& bitmap);
 
@@ -127,6 +141,8 @@ namespace chaos
 		CHAOS_API FT_BitmapGlyph GetBitmapGlyph(FT_Face face, uint32_t charcode, bool accept_notfound_glyph);
 		/** generate a cache with all glyph required for a string */
 		CHAOS_API std::map<uint32_t, CharacterBitmapGlyph> GetGlyphCacheForString(FT_Face face, char const* str);
+		/** get the non zero kerning for all pairs of characters in a glyph cache (the pixel size must be set on the face) */
+		CHAOS_API std::vector<KerningPair> GetKerningPairs(FT_Face face, std::map<uint32_t, CharacterBitmapGlyph> const& glyph_cache);
 
 	}; // namespace FontTools
 
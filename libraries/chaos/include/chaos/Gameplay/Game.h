@@ -139,6 +139,8 @@ namespace chaos
 
 		/** create the background image */
 		virtual bool CreateBackgroundImage(ObjectRequest material_request, ObjectRequest texture_request);
+		/** create the background image with a texture (no texture for the material's own one) */
+		virtual bool CreateBackgroundImageFromTexture(ObjectRequest material_request, GPUTexture* texture);
 
 		/** returns whether we are in free camera mode */
 		bool IsFreeCameraMode() const;
@@ -259,6 +261,8 @@ namespace chaos
 			char const* default_value,
 			char const* extension,
 			LightweightFunction<bool(TiledMap::Manager*, boost::filesystem::path const&)> func);
+		/** create the tiled map manager if necessary (with the cache directory from the configuration) */
+		TiledMap::Manager* GetOrCreateTiledMapManager();
 
 		/** read in config file for the path of the resource directory. */
 		boost::filesystem::path GetResourceDirectoryFromConfig(nlohmann::json const * config, char const* config_name, char const* default_path) const;
@@ -401,6 +405,12 @@ namespace chaos
 
 		/** a tiled map manager */
 		shared_ptr<TiledMap::Manager> tiled_map_manager;
+		/** where the tiled map manager stores the binary forms of the XML files (empty for no cache) */
+		boost::filesystem::path tiled_map_cache_directory;
+		/** the max size of the tiled map cache directory */
+		uintmax_t tiled_map_cache_max_size = TiledMap::Manager::DEFAULT_CACHE_MAX_SIZE;
+		/** the max age (in seconds) of an unused entry in the tiled map cache directory (0 for no limit) */
+		std::time_t tiled_map_cache_max_age = TiledMap::Manager::DEFAULT_CACHE_MAX_AGE;
 
 		/** level data */
 		std::vector<shared_ptr<Level>> levels;
@@ -75,6 +75,8 @@ namespace chaos
 		nlohmann::json player_save;
 		/** the game state encoded into a JSON */
 		nlohmann::json level_save;
+		/** the level objects whose state changed since level start, in binary form (when empty, the objects are in level_save) */
+		std::vector<char> level_snapshot;
 
 		/** the game state encoded into a JSON */
 		nlohmann::json main_clock_save;
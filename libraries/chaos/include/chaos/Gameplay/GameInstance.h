@@ -139,6 +139,9 @@ namespace chaos
 
 	protected:
 
+		/** measure the time and the size of the level checkpoints, with and without snapshot (see BenchmarkCheckpoints) */
+		void BenchmarkLevelCheckpoints();
+
 		/** the game */
 		Game* game = nullptr;
 
@@ -19,6 +19,8 @@ namespace chaos
 
 		/** override */
 		virtual bool CreateRootWidget() override;
+		/** override */
+		virtual bool EnumerateKnownImGuiObjects(EnumerateKnownImGuiObjectFunc func) const override;
 
 	protected:
 
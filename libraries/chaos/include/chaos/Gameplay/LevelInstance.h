@@ -75,8 +75,20 @@ namespace chaos
 		/** the processor may save its configuration from a JSON file */
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 
+		/** save the level into a checkpoint (the objects go into a binary snapshot whenever possible) */
+		bool SaveIntoCheckpoint(GameCheckpoint* checkpoint, bool use_snapshot) const;
+		/** restore the level from a checkpoint */
+		bool LoadFromCheckpoint(GameCheckpoint const* checkpoint);
+		/** returns whether the level is being saved into a checkpoint with a binary snapshot (the objects of the snapshot must not be written into JSON) */
+		bool IsSavingIntoSnapshot() const { return objects_in_snapshot; }
+
 	protected:
 
+		/** save the objects of the level into a binary snapshot (returns false whether the level has no such representation) */
+		virtual bool SaveIntoSnapshot(std::vector<char>& snapshot) const;
+		/** restore the objects of the level from a binary snapshot */
+		virtual bool LoadFromSnapshot(std::vector<char> const& snapshot);
+
 		/** override */
 		virtual bool DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const override;
 
@@ -147,6 +159,8 @@ namespace chaos
 		float level_timeout = -1.0f;
 		/** the level completion flag */
 		bool level_completion_flag = false;
+		/** whether the objects are being saved into a snapshot (and so must not be written into JSON) */
+		mutable bool objects_in_snapshot = false;
 
 		/** a category for all sound started during that level */
 		shared_ptr<SoundCategory> sound_category;
@@ -21,6 +21,8 @@ namespace chaos
 (TMSoundTrigger)\
 (TMParticle)\
 (TMParticlePopulator)\
+(TMSpatialGrid)\
+(TMSpatialIndex)\
 (TileCollisionComputer)
 
 		// forward declaration
@@ -67,6 +69,7 @@ BOOST_PP_SEQ_FOR_EACH(CHAOS_GAMEPLAY_TM_FORWARD_DECL, _, CHAOS_GAMEPLAY_TM_CLASS
 #include "chaos/Gameplay/TM/TMObjectReferenceSolver.h"
 #include "chaos/Gameplay/TM/TMObject.h"
 #include "chaos/Gameplay/TM/TMLevel.h"
+#include "chaos/Gameplay/TM/TMSpatialIndex.h"
 #include "chaos/Gameplay/TM/TMLayerInstance.h"
 #include "chaos/Gameplay/TM/TMLevelInstance.h"
 #include "chaos/Gameplay/TM/TMLayerInstanceIterator.h"
@@ -159,6 +159,7 @@ namespace chaos
 			++this->li_iterator;
 			allocation_index = 0;
 			particle_index = 0;
+			candidates_computed = false;
 			FindElement(false);
 		}
 
@@ -190,47 +191,84 @@ namespace chaos
 
 				if (particle_layer != nullptr)
 				{
-					while (allocation_index < particle_layer->GetAllocationCount())
+					// the spatial index gives the only particles that may collide (in the same order than the loops below)
+					if (TMSpatialIndex const* spatial_index = this->li_iterator->GetSpatialIndex())
 					{
-						auto* allocation = particle_layer->GetAllocation(allocation_index);
+						if (!candidates_computed)
+						{
+							spatial_index->QueryParticles(this->collision_box, candidates);
+							candidates_computed = true;
+						}
 
-						if (allocation != nullptr)
+						auto it = std::lower_bound(candidates.begin(), candidates.end(), TMSpatialIndex::MakeParticleKey(allocation_index, particle_index));
+						for (; it != candidates.end(); ++it)
 						{
-							while (particle_index < allocation->GetParticleCount())
-							{
-								// same for both ParticleAccessor<...> and ParticleConstAccessor<...>
-								RawDataBufferAccessorBase<boost::mpl::apply<CONSTNESS_OPERATOR, TMParticle>::type> accessor = allocation->GetParticleAccessor(0, 0);
+							allocation_index = TMSpatialIndex::GetAllocationIndex(*it);
+							particle_index = TMSpatialIndex::GetParticleIndex(*it);
 
-								auto * particle = &accessor[particle_index];
+							if (allocation_index < particle_layer->GetAllocationCount())
+							{
+								auto* allocation = particle_layer->GetAllocation(allocation_index);
+								if (allocation != nullptr && particle_index < allocation->GetParticleCount())
+									if (CheckParticle(allocation, ignore_first))
+										return;
+							}
+						}
+					}
+					else
+					{
+						while (allocation_index < particle_layer->GetAllocationCount())
+						{
+							auto* allocation = particle_layer->GetAllocation(allocation_index);
 
-								if (Collide(this->collision_box, particle->bounding_box, this->open_geometry))
+							if (allocation != nullptr)
+							{
+								while (particle_index < allocation->GetParticleCount())
 								{
-									if (!ignore_first)
-									{
-										cached_result.layer_instance = &(*this->li_iterator);
-										cached_result.allocation = allocation;
-										cached_result.particle = particle;
-										cached_result.tile_info = this->level_instance->GetTiledMap()->FindTileInfo(particle->gid);
+									if (CheckParticle(allocation, ignore_first))
 										return;
-									}
-									ignore_first = false;
+									// next particle
+									++particle_index;
 								}
-								// next particle
-								++particle_index;
 							}
+							// next allocation
+							++allocation_index;
+							particle_index = 0;
 						}
-						// next allocation
-						++allocation_index;
-						particle_index = 0;
 					}
 				}
 				// next layer instance
 				++this->li_iterator;
 				allocation_index = 0;
 				particle_index = 0;
+				candidates_computed = false;
 			}
 		}
 
+		/** test the collision with current particle and store the result (returns true whether the search is finished) */
+		template<typename ALLOCATION_TYPE>
+		bool CheckParticle(ALLOCATION_TYPE* allocation, bool& ignore_first)
+		{
+			// a query only reads the particles (a mutable accessor is only required for the result)
+			ParticleConstAccessor<TMParticle> accessor = std::as_const(*allocation).GetParticleAccessor(0, 0);
+
+			auto * particle = const_cast<typename collision_info::particle_type*>(&accessor[particle_index]);
+
+			if (Collide(this->collision_box, particle->bounding_box, this->open_geometry))
+			{
+				if (!ignore_first)
+				{
+					cached_result.layer_instance = &(*this->li_iterator);
+					cached_result.allocation = allocation;
+					cached_result.particle = particle;
+					cached_result.tile_info = this->level_instance->GetTiledMap()->FindTileInfo(particle->gid);
+					return true;
+				}
+				ignore_first = false;
+			}
+			return false;
+		}
+
 	protected:
 
 		/** allocation index in that layer */
@@ -239,6 +277,10 @@ namespace chaos
 		size_t particle_index = 0;
 		/** the collision data */
 		collision_info cached_result;
+		/** the particles given by the spatial index of current layer */
+		std::vector<uint64_t> candidates;
+		/** whether the candidates have been computed for current layer */
+		bool candidates_computed = false;
 	};
 
 	// =====================================
@@ -318,6 +360,7 @@ namespace chaos
 			assert(this->li_iterator); // end not reached
 			++this->li_iterator;
 			object_index = 0;
+			candidates_computed = false;
 			FindElement(false);
 		}
 
@@ -337,36 +380,70 @@ namespace chaos
 		{
 			while (this->li_iterator)
 			{
-				while (object_index < this->li_iterator->GetObjectCount())
+				// the spatial index gives the only objects that may collide (in the same order than the loop below)
+				if (TMSpatialIndex const* spatial_index = this->li_iterator->GetSpatialIndex())
 				{
-					object_type * object = auto_cast(this->li_iterator->GetObject(object_index));
-					if (object != nullptr)
+					if (!candidates_computed)
 					{
-						if (Collide(this->collision_box, object->GetBoundingBox(true), this->open_geometry))
-						{
-							if (!ignore_first)
-							{
-								cached_result = object;
+						spatial_index->QueryObjects(this->collision_box, candidates);
+						candidates_computed = true;
+					}
+
+					auto it = std::lower_bound(candidates.begin(), candidates.end(), uint64_t(object_index));
+					for (; it != candidates.end(); ++it)
+					{
+						object_index = size_t(*it);
+						if (object_index < this->li_iterator->GetObjectCount())
+							if (CheckObject(ignore_first))
 								return;
-							}
-							ignore_first = false;
-						}
 					}
-					// next object
-					++object_index;
+				}
+				else
+				{
+					while (object_index < this->li_iterator->GetObjectCount())
+					{
+						if (CheckObject(ignore_first))
+							return;
+						// next object
+						++object_index;
+					}
 				}
 				// next layer
 				++this->li_iterator;
 				object_index = 0;
+				candidates_computed = false;
 			}
 		}
 
+		/** test the collision with current object and store the result (returns true whether the search is finished) */
+		bool CheckObject(bool& ignore_first)
+		{
+			object_type * object = auto_cast(this->li_iterator->GetObject(object_index));
+			if (object != nullptr)
+			{
+				if (Collide(this->collision_box, object->GetBoundingBox(true), this->open_geometry))
+				{
+					if (!ignore_first)
+					{
+						cached_result = object;
+						return true;
+					}
+					ignore_first = false;
+				}
+			}
+			return false;
+		}
+
 	protected:
 
 		/** object index in current layer */
 		size_t object_index = 0;
 		/** the current result of the research */
 		object_type * cached_result = nullptr;
+		/** the objects given by the spatial index of current layer */
+		std::vector<uint64_t> candidates;
+		/** whether the candidates have been computed for current layer */
+		bool candidates_computed = false;
 	};
 
 #endif
@@ -2,6 +2,9 @@ namespace chaos
 {
 #if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	/** the encoded states of a checkpoint snapshot, indexed by (LAYER_ID, OBJECT_ID) */
+	using TMSnapshotRecords = std::map<std::pair<int, int>, std::span<uint8_t const>>;
+
 	// =====================================
 	// TMLayerInstance : instance of a Layer
 	// =====================================
@@ -146,6 +149,11 @@ namespace chaos
 		/** returns an object by its index */
 		AutoConstCastable<TMObject> GetObject(size_t index) const;
 
+		/** get the spatial index for collisions (nullptr if not enabled). The index is rebuilt whenever the layer content changed */
+		TMSpatialIndex const* GetSpatialIndex() const;
+		/** force the spatial index to be rebuilt (objects call it when they are moved. To be called whenever TMObject::bounding_box is written directly) */
+		void InvalidateSpatialIndex();
+
 		/** get the layer ID */
 		int GetLayerID() const { return id; }
 		/** get the collision mask */
@@ -214,6 +222,13 @@ namespace chaos
 		/** some callbacks */
 		virtual void OnLevelStarted();
 
+		/** start tracking the modifications of the triggers (the reference of checkpoint snapshots is the state at level start) */
+		void StartSnapshotTracking();
+		/** write the triggers whose state differs from level start into a snapshot (recursive) */
+		void SaveIntoSnapshot(TiledMap::BinaryWriter& writer) const;
+		/** restore the triggers from the records of a snapshot. Triggers without record go back to their level start state (recursive) */
+		bool LoadFromSnapshot(TMSnapshotRecords const& records);
+
 		/** compute the collision mask from the formated string */
 		void ComputeLayerCollisionMask(char const* mask);
 
@@ -251,6 +266,11 @@ namespace chaos
 		/** the collision mask for that layer */
 		uint64_t collision_mask = 0;
 
+		/** whether the collisions use a spatial index (the layer content is expected to be static) */
+		bool spatial_index_enabled = false;
+		/** the spatial index (lazily updated during queries) */
+		mutable TMSpatialIndex spatial_index;
+
 		/** the current offset */
 		glm::vec2 offset = glm::vec2(0.0f, 0.0f);
 
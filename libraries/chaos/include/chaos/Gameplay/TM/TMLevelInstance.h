@@ -138,6 +138,11 @@ namespace chaos
 
 		/** override */
 		virtual bool Initialize(Game* in_game, Level* in_level) override;
+
+		/** override */
+		virtual bool SaveIntoSnapshot(std::vector<char>& snapshot) const override;
+		/** override */
+		virtual bool LoadFromSnapshot(std::vector<char> const& snapshot) override;
 		/** override */
 		virtual bool DoTick(float delta_time) override;
 		/** override */
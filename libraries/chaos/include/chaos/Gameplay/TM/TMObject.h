@@ -36,6 +36,11 @@ namespace chaos
 
 		virtual box2 GetBoundingBox(bool world_system) const;
 
+		/** override (the spatial index of the layer is invalidated) */
+		virtual void SetPosition(glm::vec2 const& in_position) override;
+		/** override (the spatial index of the layer is invalidated) */
+		virtual void SetBoundingBox(box2 const& in_bounding_box) override;
+
 		/** override */
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
 		/** override */
@@ -144,6 +149,18 @@ namespace chaos
 		/** change whether the trigger once is enabled or not */
 		void SetTriggerOnce(bool in_trigger_once = true);
 
+		/** notify that the state of the trigger is about to change. Any modification that does not go through the methods of the trigger (Tick ...) must call it, or it is missing from snapshot checkpoints */
+		void SetSnapshotDirty();
+		/** returns whether the state of the trigger may differ from level start */
+		bool IsSnapshotDirty() const { return snapshot_dirty || IsParticleMaster(); }
+
+		/** override */
+		virtual void SetPosition(glm::vec2 const& in_position) override;
+		/** override */
+		virtual void SetBoundingBox(box2 const& in_bounding_box) override;
+		/** override */
+		virtual void SetRotation(float in_rotation) override;
+
 		/** search whether there is a collision given box */
 		virtual bool IsCollisionWith(box2 const& other_box, CollisionType collision_type) const;
 
@@ -159,6 +176,11 @@ namespace chaos
 		/** called whenever a collision with object is detected (returns true, if collision is handled successfully (=> important for TriggerOnce) */
 		virtual bool OnCollisionEvent(float delta_time, Object* object, CollisionType event_type);
 
+		/** encode the state of the trigger (as given by SerializeIntoJSON) into a compact binary form */
+		bool EncodeSnapshotState(std::vector<uint8_t>& result) const;
+		/** restore the state of the trigger from its binary form */
+		bool DecodeSnapshotState(std::span<uint8_t const> data);
+
 	protected:
 
 		/** flag whether to object is enabled or not */
@@ -170,6 +192,13 @@ namespace chaos
 
 		/** whenever the trigger-enter event has happened */
 		bool enter_event_triggered = false;
+
+		/** the encoded state of the trigger before its first modification since level start (the reference of checkpoint snapshots) */
+		std::vector<uint8_t> snapshot_baseline;
+		/** whether the trigger has been modified since level start (or since it has been restored to its baseline) */
+		bool snapshot_dirty = false;
+		/** whether the modifications are tracked (the level is started) */
+		bool snapshot_tracking = false;
 	};
 
 	// =================================================
@@ -0,0 +1,114 @@
+namespace chaos
+{
+#if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// =====================================
+	// TMSpatialGrid : an uniform grid that stores keys for the cells a box overlaps
+	// =====================================
+
+	class CHAOS_API TMSpatialGrid
+	{
+	public:
+
+		/** remove all elements and change the cell size */
+		void Clear(float in_cell_size);
+		/** insert a key for all cells the box overlaps (empty boxes are ignored) */
+		void Insert(box2 const& box, uint64_t key);
+		/** get all keys whose cells overlap the box (result is sorted and without duplicates) */
+		void Query(box2 const& box, std::vector<uint64_t>& result) const;
+
+		/** get the number of non empty cells */
+		size_t GetCellCount() const { return cells.size(); }
+
+		/** the max number of cells an element is inserted into (bigger elements are returned by every query) */
+		static constexpr uint64_t MAX_CELLS_PER_ELEMENT = 1024;
+		/** the cell coordinates are clamped into [-MAX_CELL_COORDINATE, MAX_CELL_COORDINATE] */
+		static constexpr int MAX_CELL_COORDINATE = 1 << 29;
+
+	protected:
+
+		/** get the range of cells overlapped by a box (returns false for empty or non finite boxes) */
+		bool GetCellRange(box2 const& box, glm::ivec2& min_cell, glm::ivec2& max_cell) const;
+		/** compute the key for a cell */
+		static uint64_t GetCellKey(int x, int y);
+
+	protected:
+
+		/** the size of the cells */
+		float cell_size = 0.0f;
+		/** the keys per cell */
+		std::unordered_map<uint64_t, std::vector<uint64_t>> cells;
+		/** the keys of the elements that overlap too many cells */
+		std::vector<uint64_t> oversized_keys;
+	};
+
+	// =====================================
+	// TMSpatialIndex : spatial acceleration for collisions on a layer instance
+	// =====================================
+	//
+	// The index is built from the tiles (particles) and the objects of the layer.
+	// Checking whether it is up to date is O(1):
+	//   - the particles are tracked with ParticleLayerBase::GetContentRevision() (allocations added/removed/resized)
+	//   - the objects invalidate the index when they are inserted or moved (TMObject::SetPosition(...), TMObject::SetBoundingBox(...))
+	// Code that writes directly into TMObject::bounding_box must call TMLayerInstance::InvalidateSpatialIndex().
+	// Code that moves tiles through a mutable accessor must call ParticleAllocationBase::NotifyParticlesChanged().
+	//
+
+	class CHAOS_API TMSpatialIndex
+	{
+	public:
+
+		/** compose a key for a particle */
+		static uint64_t MakeParticleKey(size_t allocation_index, size_t particle_index)
+		{
+			return (uint64_t(allocation_index) << 32) | uint64_t(particle_index & 0xFFFFFFFF);
+		}
+		/** get the allocation index from a particle key */
+		static size_t GetAllocationIndex(uint64_t key) { return size_t(key >> 32); }
+		/** get the particle index from a particle key */
+		static size_t GetParticleIndex(uint64_t key) { return size_t(key & 0xFFFFFFFF); }
+
+		/** change the cell size (this forces the index to be rebuilt) */
+		void SetCellSize(float in_cell_size);
+		/** get the cell size */
+		float GetCellSize() const { return cell_size; }
+
+		/** rebuild the index if the content of the layer changed */
+		void Update(TMLayerInstance const* layer_instance);
+		/** force the index to be rebuilt on next update */
+		void Invalidate() { dirty = true; }
+
+		/** get the particle keys (sorted by allocation then particle) that may collide with the box */
+		void QueryParticles(box2 const& box, std::vector<uint64_t>& result) const;
+		/** get the object indices (sorted) that may collide with the box */
+		void QueryObjects(box2 const& box, std::vector<uint64_t>& result) const;
+
+	protected:
+
+		/** returns whether the index corresponds to the content of the layer */
+		bool IsUpToDate(TMLayerInstance const* layer_instance) const;
+		/** build the whole index */
+		void Build(TMLayerInstance const* layer_instance);
+
+	protected:
+
+		/** the size of the cells */
+		float cell_size = 256.0f;
+		/** whether the index has to be rebuilt */
+		bool dirty = true;
+		/** the grid for particles */
+		TMSpatialGrid particle_grid;
+		/** the grid for objects */
+		TMSpatialGrid object_grid;
+
+		/** the particle layer used when the index was built */
+		ParticleLayerBase const* indexed_particle_layer = nullptr;
+		/** the content revision of the particle layer when the index was built */
+		uint64_t indexed_particle_revision = 0;
+		/** the layer offset when the index was built */
+		glm::vec2 indexed_offset = glm::vec2(0.0f, 0.0f);
+	};
+
+#endif
+
+}; // namespace chaos
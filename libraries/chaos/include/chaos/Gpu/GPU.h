@@ -9,10 +9,12 @@
 #include "chaos/Gpu/GPUSurface.h"
 #include "chaos/Gpu/GPUTexture.h"
 #include "chaos/Gpu/GPUTextureLoader.h"
+#include "chaos/Gpu/GPUTextureUploadQueue.h"
 #include "chaos/Gpu/GPUQuery.h"
 #include "chaos/Gpu/GPUBuffer.h"
 #include "chaos/Gpu/GPUFence.h"
 #include "chaos/Gpu/GPUBufferPool.h"
+#include "chaos/Gpu/ImGuiGPUBufferPoolObject.h"
 #include "chaos/Gpu/GPURenderbuffer.h"
 #include "chaos/Gpu/GPURenderbufferLoader.h"
 #include "chaos/Gpu/GPUVertexArray.h"
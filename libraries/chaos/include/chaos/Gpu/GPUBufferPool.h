@@ -2,11 +2,34 @@ namespace chaos
 {
 #ifdef CHAOS_FORWARD_DECLARATION
 
+    class GPUBufferPoolStats;
     class GPUBufferPoolEntries;
     class GPUBufferPool;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+    /**
+      * GPUBufferPoolStats : some counters about the pool usage
+      */
+
+    class CHAOS_API GPUBufferPoolStats
+    {
+    public:
+
+        /** number of requests served with a cached buffer */
+        size_t hit_count = 0;
+        /** number of requests that required a new buffer */
+        size_t miss_count = 0;
+        /** number of buffers destroyed to respect the memory budget */
+        size_t evicted_count = 0;
+        /** total size of the buffers created by the pool */
+        size_t allocated_bytes = 0;
+        /** total size of the buffers currently waiting in the pool */
+        size_t cached_bytes = 0;
+        /** total of the differences between the size of served buffers and the requested sizes */
+        size_t wasted_bytes = 0;
+    };
+
     /**
       * GPUBufferPoolEntries : an entry that match several GPUBuffers to a GPUFence
       */
@@ -17,25 +40,44 @@ namespace chaos
 
     protected:
 
-        /** returns the best cached buffer for the given size (returns true whether their is no need to search for another buffer) */
-        bool GetBuffer(size_t required_size, size_t max_accepted_size, shared_ptr<GPUBuffer>& result);
+        /** a buffer in the pool with its time of insertion (for LRU eviction) */
+        using stamped_buffer = std::pair<shared_ptr<GPUBuffer>, uint64_t>;
+
+        /** returns the cached buffer for the given size class (nullptr if none) */
+        shared_ptr<GPUBuffer> GetBuffer(size_t size_class);
+        /** insert a buffer */
+        void InsertBuffer(GPUBuffer* buffer, uint64_t stamp);
+        /** remove the oldest buffer of the entry (nullptr if none) */
+        shared_ptr<GPUBuffer> RemoveOldestBuffer();
 
     protected:
 
         /** the fence until which the buffers are in used */
         shared_ptr<GPUFence> fence;
-        /** the buffers attached to the fence */
-        std::vector<shared_ptr<GPUBuffer>> buffers;
+        /** the buffers attached to the fence, by size class (class N contains buffers whose size is in [GetSizeClassSize(N), GetSizeClassSize(N + 1)[) */
+        std::vector<std::deque<stamped_buffer>> size_classes;
+        /** the number of buffers in the entry */
+        size_t buffer_count = 0;
     };
 
     /**
      * GPUBufferPool : a cache that contains several GPU buffers with a pending fence (the resource is not valid until the fence is over)
+     *
+     * Buffers created by the pool have the size of their class, so that any buffer of the size class of a request can be used without search.
+     * There are several classes per power of 2, so that a new buffer exceeds the request by less than 25%
      */
 
     class CHAOS_API GPUBufferPool : public Object
     {
     public:
 
+        /** the smallest buffer created by the pool (smaller requests are rounded up, smaller buffers are not kept) */
+        static constexpr size_t MIN_BUFFER_SIZE = 256;
+        /** the number of bits below the leading one that select a size class inside a power of 2 */
+        static constexpr size_t SIZE_CLASS_BITS = 2;
+        /** the default maximum number of bytes the pool may keep */
+        static constexpr size_t DEFAULT_MEMORY_BUDGET = 32 * 1024 * 1024;
+
         /** get a buffer of required size (looking for cached resources first) */
         bool GetBuffer(size_t required_size, shared_ptr<GPUBuffer>& result);
         /** give back a buffer to this cache to be used later */
@@ -43,22 +85,42 @@ namespace chaos
         /** create a buffer */
         static bool CreateBuffer(size_t required_size, shared_ptr<GPUBuffer>& result);
 
+        /** change the maximum number of bytes the pool may keep (0 for no limit) */
+        void SetMemoryBudget(size_t in_memory_budget);
+        /** get the maximum number of bytes the pool may keep (0 for no limit) */
+        size_t GetMemoryBudget() const { return memory_budget; }
+
+        /** get the usage counters */
+        GPUBufferPoolStats const& GetStats() const { return stats; }
+        /** reset the usage counters (except the cached bytes) */
+        void ResetStats();
+
+        /** get the size class to which a buffer belongs */
+        static size_t GetBufferSizeClass(size_t buffer_size);
+        /** get the size class in which every buffer can handle the request */
+        static size_t GetRequestSizeClass(size_t required_size);
+        /** get the size of the buffers created for a size class */
+        static size_t GetSizeClassSize(size_t size_class);
+
     protected:
 
         /** get the cache entry for given fence */
         GPUBufferPoolEntries* GetCacheEntryForFence(GPUFence* fence);
-
-    public:
-
-        /** percentage of requested size above which a candidate buffer is rejected (to avoid waste) (0 if ignored) */
-        size_t rejected_size_percentage = 50;
+        /** destroy the least recently given buffers until the budget is respected */
+        void EnforceMemoryBudget();
 
     protected:
 
         /** some GPUBuffers per GPUFence */
         std::vector<GPUBufferPoolEntries> entries;
+        /** the maximum number of bytes the pool may keep (0 for no limit) */
+        size_t memory_budget = DEFAULT_MEMORY_BUDGET;
+        /** the counter used to stamp the buffers given to the pool */
+        uint64_t next_stamp = 0;
+        /** the usage counters */
+        GPUBufferPoolStats stats;
     };
 
 #endif
 
-}; // namespace chaos
\ No newline at end of file
+}; // namespace chaos
@@ -9,6 +9,9 @@ namespace chaos
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	/** get a unique integer for an uniform/attribute name so that providers can compare names without string comparisons (-1 for empty names, thread safe). To be resolved once when the name is registered, not per lookup */
+	CHAOS_API int GetGPUVariableNameID(char const* name);
+
 	/**
 	* GLVariableInfo : a base class for uniforms and attributes
 	*/
@@ -19,6 +22,8 @@ namespace chaos
 
 		/** self descriptive */
 		std::string name;
+		/** the unique integer for the name (see GetGPUVariableNameID) */
+		int name_id = -1;
 		/** self descriptive */
 		GLint  array_size = 0;
 		/** self descriptive */
@@ -82,10 +87,22 @@ namespace chaos
 
 		bool SetUniform(GPUTexture const* texture) const;
 
+		/** forget the last value sent to GL (to be called whenever the uniform is set by other means) */
+		void InvalidateCachedValue() const { cached_value_size = 0; }
+		/** returns true whether the value is the same than the last one sent to GL. Otherwise the value is cached */
+		bool CheckAndCacheValue(void const* value, size_t size) const;
+
 	public:
 
 		/** the number of the sampler in the program */
 		GLuint sampler_index = 0;
+
+	protected:
+
+		/** the last value sent to GL (uniform values are stored per program, so unchanged values need not be sent again) */
+		mutable std::array<char, sizeof(glm::dmat4)> cached_value;
+		/** the size of the cached value (0 if there is none) */
+		mutable size_t cached_value_size = 0;
 	};
 
 	/**
@@ -136,6 +153,7 @@ namespace chaos
 			if (uniform == nullptr)
 				return false;
 			GLTools::SetUniform(uniform->location, value); // beware, there is no verification of data coherence
+			uniform->InvalidateCachedValue();
 			return true;
 		}
 		/** try to bind all uniforms */
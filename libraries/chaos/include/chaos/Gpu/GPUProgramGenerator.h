@@ -63,8 +63,34 @@ namespace chaos
 		/** generate a string for all definitions */
 		static std::string DefinitionsToString(DefinitionSet const& definitions);
 
+		/** the default max size of the binary cache (in bytes) */
+		static constexpr uintmax_t DEFAULT_BINARY_CACHE_MAX_SIZE = 64 * 1024 * 1024;
+
+		/** change the directory where linked programs are cached (empty path to disable the cache). The oldest entries are evicted */
+		static void SetBinaryCacheDirectory(FilePathParam const& path);
+		/** get the directory where linked programs are cached */
+		static boost::filesystem::path const& GetBinaryCacheDirectory() { return binary_cache_directory; }
+		/** change the max size of the binary cache (in bytes, the least recently used entries are evicted) */
+		static void SetBinaryCacheMaxSize(uintmax_t in_max_size);
+		/** get the max size of the binary cache (in bytes) */
+		static uintmax_t GetBinaryCacheMaxSize() { return binary_cache_max_size; }
+
 	protected:
 
+		/** the sources of one shader */
+		class ShaderSources
+		{
+		public:
+
+			/** the type of the shader */
+			ShaderType shader_type = ShaderType::ANY;
+			/** the sources */
+			std::vector<char const*> sources;
+		};
+
+		/** collect all the sources for a shader (buffers keep the generated sources alive) */
+		void GatherShaderSources(ShaderType shader_type, GeneratorSet const& generators, DefinitionSet const& definitions, std::string const& definitions_string, std::vector<char const*>& sources, std::vector<Buffer<char>>& buffers) const;
+
 		/** generate a shader for a set of sources and attach it to the program */
 		GLuint GenerateShader(GLuint program, ShaderType shader_type, GeneratorSet const& generators, DefinitionSet const& definitions, std::string const& definitions_string) const;
 		/** generate a shader for a set of sources */
@@ -73,13 +99,33 @@ namespace chaos
 		GLuint DoGenerateShader(ShaderType shader_type, std::vector<char const*> const& sources) const;
 		/** called just before linkage */
 		virtual bool PreLinkProgram(GLuint program) const;
+		/** get a string that identifies what PreLinkProgram(...) does, for the binary cache key (returns false if the program must not be cached). Override it whenever PreLinkProgram(...) depends on instance data */
+		virtual bool GetPreLinkProgramCacheKey(std::string& result) const;
 		/** generate a program from the sources */
 		GLuint GenProgram(DefinitionSet const& definitions = DefinitionSet()) const;
 		/** insert extra source (utility functions ...) for the given shader type */
 		void AddFrameworkSources(ShaderType shader_type, std::vector<char const*>& sources, std::vector<Buffer<char>>& buffers) const;
 
+		/** compute the key of a program in the binary cache (sources, default vertex shader, pre-link discriminator and driver) */
+		static uint64_t GetBinaryCacheKey(std::vector<ShaderSources> const& shader_sources, bool use_default_vertex_shader, std::string const& prelink_key);
+		/** get the path of a program in the binary cache */
+		static boost::filesystem::path GetBinaryCachePath(uint64_t key);
+		/** create a program from the binary cache (0 if there is no valid entry) */
+		static GLuint LoadProgramBinary(uint64_t key);
+		/** store a linked program into the binary cache */
+		static bool SaveProgramBinary(GLuint program, uint64_t key);
+		/** remove the least recently used entries until the cache fits its max size */
+		static void TrimBinaryCache();
+
 	protected:
 
+		/** the directory where linked programs are cached */
+		static boost::filesystem::path binary_cache_directory;
+		/** the max size of the binary cache */
+		static uintmax_t binary_cache_max_size;
+		/** the size of the binary cache (as known since last trim) */
+		static uintmax_t binary_cache_size;
+
 		/** the shaders */
 		std::map<ShaderType, GeneratorSet> shaders;
 		/** whether a render shader has been inserted (nor ANY nor COMPUTE) */
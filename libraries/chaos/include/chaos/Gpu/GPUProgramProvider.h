@@ -41,6 +41,8 @@ namespace chaos
 
 		/** the main method : returns true whether the action has been handled (even if failed) */
 		bool ProcessAction(char const* name, GPUProgramAction& action) const;
+		/** the main method with an already known name ID (see GetGPUVariableNameID) */
+		bool ProcessAction(char const* name, int name_id, GPUProgramAction& action) const;
 
 		/** utility function that deserve to set uniform */
 		bool BindUniform(GLUniformInfo const& uniform) const;
@@ -79,14 +81,14 @@ namespace chaos
 
 		/** constructor */
 		GPUProgramProviderVariableBase(char const* in_name, T const& in_value, GPUProgramProviderPassType in_pass_type = GPUProgramProviderPassType::EXPLICIT) :
-			handled_name(in_name), value(in_value), pass_type(in_pass_type) {}
+			handled_name(in_name), handled_name_id(GetGPUVariableNameID(in_name)), value(in_value), pass_type(in_pass_type) {}
 
 	protected:
 
 		/** the main method */
 		virtual bool DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const override
 		{
-			if (execution_data.Match(handled_name.c_str(), pass_type))
+			if (execution_data.Match(handled_name.c_str(), handled_name_id, pass_type))
 				return execution_data.Process(value, this);
 			return false;
 		}
@@ -95,6 +97,8 @@ namespace chaos
 
 		/** the name of the uniform handled */
 		std::string handled_name;
+		/** the ID of the name of the uniform handled */
+		int handled_name_id = -1;
 		/** the value of the uniform */
 		MEMBER_TYPE value;
 		/** the type of this provider */
@@ -113,7 +117,7 @@ namespace chaos
 
 		/** constructor */
 		GPUProgramProviderTexture(char const* in_name, shared_ptr<GPUTexture> in_value, GPUProgramProviderPassType in_pass_type = GPUProgramProviderPassType::EXPLICIT) :
-			handled_name(in_name), value(in_value), pass_type(in_pass_type) {}
+			handled_name(in_name), handled_name_id(GetGPUVariableNameID(in_name)), value(in_value), pass_type(in_pass_type) {}
 
 	protected:
 
@@ -124,6 +128,8 @@ namespace chaos
 
 		/** the name of the uniform handled */
 		std::string handled_name;
+		/** the ID of the name of the uniform handled */
+		int handled_name_id = -1;
 		/** the value of the uniform */
 		shared_ptr<GPUTexture> value;
 		/** the type of this provider */
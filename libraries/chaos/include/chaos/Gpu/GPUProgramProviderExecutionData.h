@@ -31,8 +31,13 @@ namespace chaos
 
 	public:
 
-		/** constructor */
+		/** the ID for a searched name that has not been resolved (names are compared as strings) */
+		static constexpr int UNRESOLVED_NAME_ID = -2;
+
+		/** constructor (the name is not resolved into an ID) */
 		GPUProgramProviderExecutionData(char const* in_searched_name, GPUProgramAction& in_action, GPUProgramProviderExecutionData const* base_execution = nullptr);
+		/** constructor with an already known name ID (see GetGPUVariableNameID) */
+		GPUProgramProviderExecutionData(char const* in_searched_name, int in_searched_name_id, GPUProgramAction& in_action, GPUProgramProviderExecutionData const* base_execution = nullptr);
 
 		/** check for name and return a lock */
 		GPUProgramProviderDeduceLock CanDeduce(char const* searched_name) const;
@@ -42,6 +47,8 @@ namespace chaos
 
 		/** get the name searched */
 		char const* GetSearchedName() const { return searched_name; }
+		/** get the ID of the name searched */
+		int GetSearchedNameID() const { return searched_name_id; }
 		/** get the wanted action */
 		GPUProgramAction const& GetAction() const { return action; }
 		/** get the wanted action */
@@ -49,6 +56,8 @@ namespace chaos
 
 		/** returns whether the proposed name + type match the initial request */
 		bool Match(char const* other_name, GPUProgramProviderPassType in_pass_type = GPUProgramProviderPassType::EXPLICIT) const;
+		/** returns whether the proposed name + type match the initial request (IDs are compared unless the searched name is unresolved) */
+		bool Match(char const* other_name, int other_name_id, GPUProgramProviderPassType in_pass_type = GPUProgramProviderPassType::EXPLICIT) const;
 
 		/** gets the pass type */
 		GPUProgramProviderPassType GetPassType() const { return pass_type; }
@@ -75,6 +84,8 @@ namespace chaos
 		mutable std::vector<char const*> internal_deduced_searches;
 		/** the name searched */
 		char const* searched_name = nullptr;
+		/** the ID of the name searched (-1 for empty names, UNRESOLVED_NAME_ID for names compared as strings) */
+		int searched_name_id = -1;
 		/** the action to trigger */
 		GPUProgramAction& action;
 	};
@@ -67,6 +67,8 @@ namespace chaos
 
 		/** load a texture */
 		GPUTexture* LoadTexture(FilePathParam const& path, char const* name = nullptr, GenTextureParameters const& texture_parameters = {});
+		/** load a texture without stalling the main loop (returns a placeholder texture, see GPUTextureUploadQueue) */
+		GPUTexture* LoadTextureAsync(FilePathParam const& path, char const* name = nullptr, GenTextureParameters const& texture_parameters = {}, GPUTextureLoadedFunc callback = {});
 		/** load a program */
 		GPUProgram* LoadProgram(FilePathParam const& path, char const* name = nullptr);
 		/** load a material */
@@ -133,6 +135,11 @@ namespace chaos
 		/** get quad simple mesh */
 		GPUMesh* GetQuadMesh();
 
+		/** get the queue for asynchronous texture loading */
+		GPUTextureUploadQueue* GetTextureUploadQueue() { return texture_upload_queue.get(); }
+		/** get the queue for asynchronous texture loading */
+		GPUTextureUploadQueue const* GetTextureUploadQueue() const { return texture_upload_queue.get(); }
+
 	protected:
 
 		/** load the textures from configuration */
@@ -169,10 +176,20 @@ namespace chaos
 		/** the render materials */
 		std::vector<shared_ptr<GPURenderMaterial>> render_materials;
 
+		/** the index for searching textures */
+		NamedObjectIndex texture_index;
+		/** the index for searching programs */
+		NamedObjectIndex program_index;
+		/** the index for searching render materials */
+		NamedObjectIndex render_material_index;
+
 		/** the fullscreen quad mesh */
 		shared_ptr<GPUMesh> quad_mesh;
 		/** the quad to triangle_pair index rendering */
 		shared_ptr<GPUBuffer> quad_index_buffer;
+
+		/** the queue for asynchronous texture loading */
+		shared_ptr<GPUTextureUploadQueue> texture_upload_queue;
 	};
 
 #endif
@@ -9,6 +9,7 @@ namespace chaos
 	class CHAOS_API GPUTexture : public GPUSurface
 	{
 		friend class GPUResourceManager;
+		friend class GPUTextureUploadQueue;
 
 	public:
 
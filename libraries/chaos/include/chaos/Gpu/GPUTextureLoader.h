@@ -22,11 +22,15 @@ namespace chaos
 		virtual GPUTexture* LoadObject(char const* name, nlohmann::json const * json, GenTextureParameters const& parameters = {}) const;
 		/** texture loading from path */
 		virtual GPUTexture* LoadObject(FilePathParam const& path, char const* name = nullptr, GenTextureParameters const& parameters = {}) const;
+		/** texture loading from path without stalling the main loop (returns a placeholder texture) */
+		virtual GPUTexture* LoadObjectAsync(FilePathParam const& path, char const* name = nullptr, GenTextureParameters const& parameters = {}, GPUTextureLoadedFunc callback = {}) const;
 
 		/** Generate a texture from a json content */
 		virtual GPUTexture* GenTextureObject(nlohmann::json const * json, GenTextureParameters const& parameters = {}) const;
 		/** Generate a 1D/2D/rectangle texture from an file */
 		virtual GPUTexture* GenTextureObject(FilePathParam const& path, GenTextureParameters const& parameters = {}) const;
+		/** Generate a texture from an file without stalling the main loop (returns a placeholder texture, see GPUTextureUploadQueue) */
+		virtual GPUTexture* GenTextureObjectAsync(FilePathParam const& path, GenTextureParameters const& parameters = {}, GPUTextureLoadedFunc callback = {}) const;
 		/** Generate a 1D/2D/rectangle texture from an image */
 		virtual GPUTexture* GenTextureObject(ImageDescription const& image, GenTextureParameters const& parameters = {}) const;
 		/** Generate a 1D/2D/rectangle texture from an image */
@@ -0,0 +1,168 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	enum class GPUTextureUploadState;
+
+	class GPUTextureDecodedImage;
+	class GPUTextureUploadRequest;
+	class GPUTextureUploadQueue;
+
+	/** the function called once an asynchronous texture is ready (or has failed) */
+	using GPUTextureLoadedFunc = std::function<void(GPUTexture*, bool)>;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* GPUTextureUploadState : the steps of an asynchronous texture loading
+	*/
+
+	enum class CHAOS_API GPUTextureUploadState : int
+	{
+		/** the file is being loaded and decoded on a worker thread */
+		DECODING = 0,
+		/** the pixels are ready to be uploaded */
+		DECODED = 1,
+		/** the file is not an image (JSON description ...) and is to be loaded the synchronous way */
+		NOT_AN_IMAGE = 2,
+		/** the file cannot be loaded or decoded */
+		FAILED = 3,
+		/** the request has been canceled before its completion */
+		CANCELED = 4
+	};
+
+	/**
+	* GPUTextureDecodedImage : the pixels of an image file, ready to be transfered to GL (no GL call, can be used on any thread)
+	*/
+
+	class CHAOS_API GPUTextureDecodedImage
+	{
+	public:
+
+		/** constructor */
+		GPUTextureDecodedImage() = default;
+		/** no copy */
+		GPUTextureDecodedImage(GPUTextureDecodedImage const& src) = delete;
+		/** move constructor */
+		GPUTextureDecodedImage(GPUTextureDecodedImage&& src);
+		/** destructor */
+		~GPUTextureDecodedImage();
+
+		/** no copy */
+		GPUTextureDecodedImage& operator = (GPUTextureDecodedImage const& src) = delete;
+		/** move assignment */
+		GPUTextureDecodedImage& operator = (GPUTextureDecodedImage&& src);
+
+		/** decode a buffer. Returns false whether this is not an image of a supported format */
+		bool Decode(Buffer<char> buffer);
+		/** release the pixels */
+		void Release();
+
+		/** returns whether there are pixels */
+		bool IsValid() const { return (bitmap != nullptr); }
+		/** get the description of the pixels (rows are DWORD aligned) */
+		ImageDescription const& GetImageDescription() const { return image; }
+
+	protected:
+
+		/** the bitmap that owns the pixels */
+		FIBITMAP* bitmap = nullptr;
+		/** the description of the pixels */
+		ImageDescription image;
+	};
+
+	/**
+	* GPUTextureUploadRequest : an asynchronous texture loading
+	*/
+
+	class CHAOS_API GPUTextureUploadRequest : public Object
+	{
+		friend class GPUTextureUploadQueue;
+
+	public:
+
+		/** get the current state */
+		GPUTextureUploadState GetState() const { return state.load(std::memory_order_acquire); }
+		/** get the texture given to the user (a placeholder until the upload is complete) */
+		GPUTexture* GetTexture() const { return texture.get(); }
+
+		/** load and decode the file (no GL call, can be used on any thread) */
+		void Decode();
+
+	protected:
+
+		/** the file to load */
+		boost::filesystem::path path;
+		/** the parameters for the texture */
+		GenTextureParameters parameters;
+		/** the function to call on completion */
+		GPUTextureLoadedFunc callback;
+		/** the texture given to the user */
+		shared_ptr<GPUTexture> texture;
+		/** the decoded pixels */
+		GPUTextureDecodedImage decoded_image;
+		/** the current state */
+		std::atomic<GPUTextureUploadState> state = GPUTextureUploadState::DECODING;
+
+		/** the texture being filled (swapped into the placeholder once complete) */
+		GLuint texture_id = 0;
+		/** the target of the texture being filled */
+		GLenum target = GL_NONE;
+		/** the number of rows already uploaded */
+		int uploaded_row_count = 0;
+	};
+
+	/**
+	* GPUTextureUploadQueue : load textures without stalling the main loop
+	*/
+
+	// XXX : AddRequest(...) returns at once a 1x1 transparent placeholder texture.
+	//       The file is decoded by the JobSystem (if any), then the pixels are uploaded by slices of rows during several calls to ProcessUploads(...), under a budget of bytes per frame.
+	//       The real texture is created aside and swapped into the placeholder once complete, so that the user never sees a partial texture.
+	//       All methods but GPUTextureUploadRequest::Decode() must be called on the thread that owns the GL context
+
+	class CHAOS_API GPUTextureUploadQueue : public Object
+	{
+	public:
+
+		/** destructor */
+		virtual ~GPUTextureUploadQueue();
+
+		/** start loading a texture. Returns a placeholder texture */
+		GPUTexture* AddRequest(FilePathParam const& path, GenTextureParameters const& parameters = {}, GPUTextureLoadedFunc callback = {});
+		/** upload some pending pixels (the budget of bytes is shared by all requests) */
+		void ProcessUploads();
+		/** cancel all pending requests (their callbacks are called with a failure) */
+		void CancelRequests();
+
+		/** change the number of bytes to upload per call to ProcessUploads(...) (at least one row is uploaded per call, even with a null budget) */
+		void SetFrameByteBudget(size_t in_frame_byte_budget) { frame_byte_budget = in_frame_byte_budget; }
+		/** get the number of bytes to upload per call to ProcessUploads(...) */
+		size_t GetFrameByteBudget() const { return frame_byte_budget; }
+		/** get the number of requests that are not complete yet */
+		size_t GetPendingRequestCount() const { return requests.size(); }
+
+	protected:
+
+		/** process a request. Returns true whether the request is over (success tells whether the texture is ready) */
+		bool ProcessRequest(GPUTextureUploadRequest* request, size_t& byte_budget, bool& success);
+		/** upload some rows of a decoded request. Returns false on failure */
+		bool UploadRows(GPUTextureUploadRequest* request, size_t& byte_budget);
+		/** create the final texture once all rows are uploaded and give it to the placeholder */
+		bool FinalizeUpload(GPUTextureUploadRequest* request);
+		/** notify the users of the end of requests */
+		static void NotifyRequests(std::vector<std::pair<shared_ptr<GPUTextureUploadRequest>, bool>> const& over_requests);
+		/** exchange the GL resources of two textures */
+		static void SwapTextures(GPUTexture* texture1, GPUTexture* texture2);
+
+	protected:
+
+		/** the pending requests */
+		std::vector<shared_ptr<GPUTextureUploadRequest>> requests;
+		/** the number of bytes to upload per call to ProcessUploads(...) */
+		size_t frame_byte_budget = 4 * 1024 * 1024;
+	};
+
+#endif
+
+}; // namespace chaos
@@ -2,11 +2,50 @@ namespace chaos
 {
 #ifdef CHAOS_FORWARD_DECLARATION
 
+	class GPUVertexArrayCacheKey;
+	class GPUVertexArrayCacheKeyHash;
 	class GPUVertexArrayCacheEntry;
+	class GPUVertexArrayCacheStatistics;
 	class GPUVertexArrayCache;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	// ==================================================================
+	// GPUVertexArrayCacheKey : the OpenGL resources an entry is made of
+	// ==================================================================
+
+	class CHAOS_API GPUVertexArrayCacheKey
+	{
+	public:
+
+		/** comparison operator */
+		bool operator == (GPUVertexArrayCacheKey const& other) const = default;
+
+	public:
+
+		/** the context */
+		GLFWwindow* context = nullptr;
+		/** the index of the program */
+		GLuint program_id = 0;
+		/** the vertex buffer */
+		GLuint vertex_buffer_id = 0;
+		/** the index buffer */
+		GLuint index_buffer_id = 0;
+		/** the offset for the vertex buffer */
+		GLintptr vertex_buffer_offset = 0;
+	};
+
+	// ==================================================================
+	// GPUVertexArrayCacheKeyHash : hash function for GPUVertexArrayCacheKey
+	// ==================================================================
+
+	class CHAOS_API GPUVertexArrayCacheKeyHash
+	{
+	public:
+
+		size_t operator ()(GPUVertexArrayCacheKey const& key) const;
+	};
+
 	// ==================================================================
 	// GPUVertexArrayCacheEntry : an entry in the cache vertex array
 	// ==================================================================
@@ -23,6 +62,9 @@ namespace chaos
 		/** whether the entry is still valid (whether one of the pointed element has been destroyed) */
 		bool IsValid() const;
 
+		/** get the key of the entry */
+		GPUVertexArrayCacheKey GetKey() const;
+
 	public:
 
 		/** the program concerned */
@@ -50,15 +92,43 @@ namespace chaos
 		shared_ptr<GPUVertexArray> vertex_array;
 	};
 
+	// =================================================================================================
+	// GPUVertexArrayCacheStatistics : some information about the efficiency of the cache
+	// =================================================================================================
+
+	class CHAOS_API GPUVertexArrayCacheStatistics
+	{
+	public:
+
+		/** get the ratio of searches that found an entry */
+		float GetHitRate() const;
+
+	public:
+
+		/** the number of entries */
+		size_t entry_count = 0;
+		/** the number of searches that found an entry */
+		uint64_t hit_count = 0;
+		/** the number of searches that found no entry */
+		uint64_t miss_count = 0;
+	};
+
 	// =================================================================================================
 	// GPUVertexArrayCache : a binding between GPUProgram/GPUVertexArray that support destruction of both side
 	// =================================================================================================
 
+	// XXX : entries are indexed by the OpenGL resources they are made of. Because OpenGL recycles the names of deleted resources,
+	//       an entry found this way is still checked against the objects themselves.
+	//       Entries whose objects have been destroyed are removed a few at a time on each search
+
 	class CHAOS_API GPUVertexArrayCache : public Object
 	{
 
 	public:
 
+		/** destructor */
+		virtual ~GPUVertexArrayCache();
+
 		/** find vertex array for the program */
 		GPUVertexArray const* FindVertexArray(GPURenderer* renderer, GPUProgram const* program, GPUBuffer const* vertex_buffer, GPUBuffer const* index_buffer, GLintptr offset) const;
 		/** create or return exisiting vertex array for a given program */
@@ -66,12 +136,35 @@ namespace chaos
 		/** reset the whole object */
 		void Clear();
 
+		/** get the statistics of this cache */
+		GPUVertexArrayCacheStatistics GetStatistics() const;
+		/** get the statistics of all caches */
+		static GPUVertexArrayCacheStatistics GetGlobalStatistics() { return global_statistics; }
+
+	protected:
+
+		/** insert an entry */
+		void AddEntry(GPUVertexArrayCacheEntry&& entry);
+		/** remove an entry (the last entry is moved at its place) */
+		void RemoveEntry(size_t index) const;
+		/** remove the invalid entries among the next ones */
+		void SweepEntries(size_t count) const;
+
 	protected:
 
-		/** a counter to know whether to purge the elements */
-		mutable double last_purge_time = 0;
 		/** the cache content */
 		mutable std::vector<GPUVertexArrayCacheEntry> entries;
+		/** the index of the entries */
+		mutable std::unordered_map<GPUVertexArrayCacheKey, size_t, GPUVertexArrayCacheKeyHash> entry_indices;
+		/** the next entry to be checked by the sweep */
+		mutable size_t sweep_index = 0;
+		/** the number of searches that found an entry */
+		mutable uint64_t hit_count = 0;
+		/** the number of searches that found no entry */
+		mutable uint64_t miss_count = 0;
+
+		/** the statistics of all caches */
+		static GPUVertexArrayCacheStatistics global_statistics;
 	};
 
 #endif
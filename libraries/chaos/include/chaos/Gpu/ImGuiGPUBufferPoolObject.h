@@ -0,0 +1,37 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ImGuiGPUBufferPoolObject;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* ImGuiGPUBufferPoolObject: a drawable that displays the usage counters of a GPUBufferPool
+	*/
+
+	class ImGuiGPUBufferPoolObject : public ImGuiObject
+	{
+	public:
+
+		CHAOS_DECLARE_OBJECT_CLASS(ImGuiGPUBufferPoolObject, ImGuiObject);
+
+		/** initialization function */
+		void SetBufferPool(GPUBufferPool* in_buffer_pool);
+
+	protected:
+
+		/** override */
+		virtual int GetImGuiWindowFlags() const override;
+		/** override */
+		virtual void OnDrawImGuiContent() override;
+
+	protected:
+
+		/** the observed pool */
+		GPUBufferPool* buffer_pool = nullptr;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
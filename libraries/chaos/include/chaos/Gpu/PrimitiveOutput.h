@@ -346,14 +346,19 @@ namespace chaos
         ParticleTextGenerator::Generator const* generator = window_application->GetTextGenerator();
         if (generator == nullptr)
             return {};
-        // generate the data
-        ParticleTextGenerator::GeneratorResult generator_result;
-        if (!generator->Generate(in_text, generator_result, params))
+        // generate the data (texts drawn every frame are mostly the same: use the layout cache)
+        shared_ptr<ParticleTextGenerator::GeneratorCacheEntry> generator_entry = generator->GenerateCached(in_text, params);
+        if (generator_entry == nullptr)
             return {};
+        ParticleTextGenerator::GeneratorResult const& generator_result = generator_entry->GetResult();
+        glm::vec2 offset = generator_entry->GetPlacementOffset(params); // the cached text is at origin
         if (out_bounding_box != nullptr)
-            *out_bounding_box = generator_result.bounding_box;
+        {
+            out_bounding_box->bottomleft = generator_result.bounding_box.bottomleft + offset;
+            out_bounding_box->topright = generator_result.bounding_box.topright + offset;
+        }
         // create the primitives
-        return TextToPrimitives(output, generator_result, allocation_params);
+        return TextToPrimitives(output, generator_result, allocation_params, offset);
     }
 
 #endif
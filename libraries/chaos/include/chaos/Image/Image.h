@@ -1,4 +1,5 @@
 #include "Chaos/Image/PixelTypes.h"
+#include "Chaos/Image/PixelKernels.h"
 #include "Chaos/Image/PixelFormat.h"
 #include "Chaos/Image/PixelFormatMerger.h"
 #include "Chaos/Image/ColorFilter.h"
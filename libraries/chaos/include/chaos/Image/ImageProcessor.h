@@ -129,6 +129,8 @@ namespace chaos
 
 		/** the offset of the shadow */
 		glm::vec2 offset = { 5, 5 };
+		/** the size of the shadow around the displaced image */
+		int distance = 0;
 		/** filter to check pixel to keep */
 		ColorFilter color_filter;
 		/** the ouline color */
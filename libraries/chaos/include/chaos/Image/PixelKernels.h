@@ -0,0 +1,63 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	enum class PixelKernelInstructionSet;
+
+	class PixelKernels;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* PixelKernelInstructionSet : the instructions used by the pixel row kernels
+	*/
+
+	enum class CHAOS_API PixelKernelInstructionSet : int
+	{
+		SCALAR = 0,
+		SSE2 = 1,
+		AVX2 = 2
+	};
+
+	/**
+	* PixelKernels : optimized row conversions for the most common pixel pairs (the result is the same than PixelConverter for any instruction set)
+	*/
+
+	class CHAOS_API PixelKernels
+	{
+	public:
+
+		/** get the best instruction set supported by the CPU */
+		static PixelKernelInstructionSet GetBestInstructionSet();
+		/** get the instruction set in use (the best one by default) */
+		static PixelKernelInstructionSet GetInstructionSet();
+		/** change the instruction set in use (it is clamped to the best one supported) */
+		static void SetInstructionSet(PixelKernelInstructionSet instruction_set);
+
+		/** convert a row of pixels */
+		static void ConvertRow(PixelBGRA* dst, PixelBGR const* src, int count);
+		/** convert a row of pixels */
+		static void ConvertRow(PixelBGR* dst, PixelBGRA const* src, int count);
+		/** convert a row of pixels */
+		static void ConvertRow(PixelBGRA* dst, PixelGray const* src, int count);
+		/** convert a row of pixels */
+		static void ConvertRow(PixelBGRA* dst, PixelRGBAFloat const* src, int count);
+		/** convert a row of pixels */
+		static void ConvertRow(PixelGray* dst, PixelGrayFloat const* src, int count);
+
+		/** copy a row of pixels in reverse order */
+		static void ReverseCopyRow(PixelBGRA* dst, PixelBGRA const* src, int count);
+		/** reverse the order of the pixels of a row */
+		static void ReverseRow(PixelBGRA* row, int count);
+	};
+
+	/** concept for pixel pairs that have an optimized row conversion */
+	template<typename DST_PIXEL, typename SRC_PIXEL>
+	concept HasPixelRowKernel = requires(DST_PIXEL* dst, SRC_PIXEL const* src)
+	{
+		PixelKernels::ConvertRow(dst, src, 0);
+	};
+
+#endif
+
+}; // namespace chaos
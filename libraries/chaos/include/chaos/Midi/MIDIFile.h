@@ -4,10 +4,9 @@ namespace chaos
 
 	class MidiChunk;
 	class MidiEvent;
-	class MidiSystemExclusiveEvent;
-	class MidiMetaEvent;
-	class MidiCommandEvent;
 	class MidiTrack;
+	class MidiTimedEvent;
+	class MidiTimeline;
 	class MidiHeader;
 	class MidiLoader;
 
@@ -33,79 +32,95 @@ namespace chaos
 	};
 
 	/**
-	* MidiEvent : an event in MIDI file
+	* MidiEvent : an event in MIDI file (the data are a view on the buffer of the loader)
 	*/
 
 	class CHAOS_API MidiEvent
 	{
 	public:
 
-		/** constructor */
-		MidiEvent(unsigned char in_signature) : signature(in_signature) {}
-		/** destructor */
-		virtual ~MidiEvent() = default;
-		/** try to initialize the event from the chunk of memory */
-		virtual bool InitializeEventFromChunk(BufferReader& reader) { return false; }
+		static unsigned char const META_END_OF_TRACK = 0x2F;
+		static unsigned char const META_SET_TEMPO = 0x51;
+
+		/** returns true whether this is a system exclusive event */
+		bool IsSystemExclusiveEvent() const { return (signature == 0xF0 || signature == 0xF7); }
+		/** returns true whether this is a meta event */
+		bool IsMetaEvent() const { return (signature == 0xFF); }
+		/** returns true whether this is a standard MIDI command */
+		bool IsCommandEvent() const { return !IsSystemExclusiveEvent() && !IsMetaEvent(); }
+		/** returns the corresponding MIDI command (only for command events) */
+		MIDICommand GetCommand() const;
 
 	public:
 
-		/** the signature of the event */
+		/** the time of the event in ticks since the beginning of the track */
+		uint32_t tick = 0;
+		/** the signature of the event (the status, even if it was not repeated in the file) */
 		unsigned char signature = 0;
+		/** the type of meta event */
+		unsigned char meta_type = 0;
+		/** the size of the data */
+		uint32_t data_size = 0;
+		/** the data of the event (without signature, type and length) */
+		char const* data = nullptr;
 	};
 
 	/**
-	* MidiSystemExclusiveEvent : an event in MIDI file
+	* MidiTrack : A track in midi files
 	*/
 
-	class CHAOS_API MidiSystemExclusiveEvent : public MidiEvent
+	class CHAOS_API MidiTrack
 	{
 	public:
 
-		/** constructor */
-		MidiSystemExclusiveEvent(unsigned char in_signature) : MidiEvent(in_signature) {}
+		/** get the first event of the track */
+		MidiEvent const* begin() const { return events; }
+		/** get the end of the events of the track */
+		MidiEvent const* end() const { return events + event_count; }
+
+	public:
 
-		virtual bool InitializeEventFromChunk(BufferReader& reader) override;
+		/** the events (stored in the arena of the loader) */
+		MidiEvent const* events = nullptr;
+		/** the number of events */
+		size_t event_count = 0;
 	};
 
 	/**
-	* MidiMetaEvent : an event in MIDI file
+	* MidiTimedEvent : an event of the merged timeline
 	*/
 
-	class CHAOS_API MidiMetaEvent : public MidiEvent
-	{
-	public:
-
-		/** constructor */
-		MidiMetaEvent(unsigned char in_signature) : MidiEvent(in_signature) {}
-
-		virtual bool InitializeEventFromChunk(BufferReader& reader) override;
-	};
-
-	class CHAOS_API MidiCommandEvent : public MidiEvent
+	class CHAOS_API MidiTimedEvent
 	{
 	public:
 
-		/** constructor */
-		MidiCommandEvent(unsigned char in_signature) : MidiEvent(in_signature) {}
-
-		virtual bool InitializeEventFromChunk(BufferReader& reader) override;
+		/** the time of the event in seconds (tempo changes are taken into account) */
+		double time = 0.0;
+		/** the time of the event in ticks */
+		uint32_t tick = 0;
+		/** the track the event belongs to */
+		size_t track_index = 0;
+		/** the event */
+		MidiEvent const* event = nullptr;
 	};
 
 	/**
-	* MidiTrack : A track in midi files
+	* MidiTimeline : the events of all tracks sorted by time
 	*/
 
-	class CHAOS_API MidiTrack : public NoCopyClass
+	class CHAOS_API MidiTimeline
 	{
 	public:
 
-		/** destructor */
-		virtual ~MidiTrack() = default;
+		/** get the index of the first event whose time is greater or equal than a given time (binary search) */
+		size_t GetEventIndexAtTime(double time) const;
+		/** get the duration of the timeline */
+		double GetDuration() const { return (events.size() > 0) ? events.back().time : 0.0; }
 
 	public:
 
 		/** the events */
-		std::vector<std::unique_ptr<MidiEvent>> events;
+		std::vector<MidiTimedEvent> events;
 	};
 
 	/**
@@ -144,9 +159,19 @@ namespace chaos
 		/** destructor */
 		virtual ~MidiLoader() = default;
 
-		/** the entry point for reading a MIDI file */
+		/** the entry point for reading a MIDI file (the buffer is kept because events refer to it) */
 		bool LoadBuffer(Buffer<char> const& buffer);
 
+		/** get the header */
+		MidiHeader const& GetHeader() const { return header; }
+		/** get the number of tracks */
+		size_t GetTrackCount() const { return tracks.size(); }
+		/** get a track */
+		MidiTrack const& GetTrack(size_t index) const { return tracks[index]; }
+
+		/** merge all tracks into a single time sorted stream (not for FORMAT_MULTIPLE_SONG files) */
+		bool BuildTimeline(MidiTimeline& result) const;
+
 	protected:
 
 		/** clean the content thata have parsed */
@@ -158,19 +183,25 @@ namespace chaos
 		MidiChunk const ReadChunk(BufferReader& reader);
 		/** read the header chunk */
 		MidiChunk const ReadHeaderChunk(BufferReader& reader);
-		/** initialize the track from data contained in the chunk */
-		bool InitializeTrackFromChunk(MidiTrack* track, MidiChunk const& track_chunk);
-		/** read a variable length time in stream */
+		/** append the events of a track chunk to the arena */
+		bool InitializeTrackFromChunk(MidiChunk const& track_chunk);
+		/** read a variable length quantity in stream (time or length) */
 		bool ReadVLTime(BufferReader& reader, uint32_t& result);
 		/** convert the header chunk into a header structure */
 		bool GetHeaderFromChunk(MidiChunk const& chunk, MidiHeader& result);
+		/** get the duration of a tick in seconds for a given tempo (microseconds per quarter note) */
+		double GetTickDuration(uint32_t tempo) const;
 
 	protected:
 
+		/** the buffer the events refer to */
+		Buffer<char> buffer;
 		/** the header */
 		MidiHeader header;
+		/** the events of all tracks (contiguous per track) */
+		std::vector<MidiEvent> events;
 		/** the tracks */
-		std::vector<std::unique_ptr<MidiTrack>> tracks;
+		std::vector<MidiTrack> tracks;
 	};
 
 
@@ -73,6 +73,26 @@
 //	  TYPE_YYY BeginParticlesToPrimitives(...AllocationTrait)
 //
 //
+// 4 - the trait may opt into a structure-of-arrays storage with a nested type listing the members to store (one aligned array each)
+//
+//    using SoAFields = ParticleSoAFields<&PARTICLE::position, &PARTICLE::velocity ...>;
+//
+// in that case the per particle functions are not used. The trait works on whole arrays instead (AllocationTrait is optional)
+//
+//    void UpdateParticleArrays(float delta_time, ParticleSoAAccessor<PARTICLE, SoAFields> particles, uint8_t * destroyed_particles, AllocationTrait) const;  => set destroyed_particles[i] to destroy particle i
+//
+//    void ParticleArraysToPrimitives(ParticleSoAConstAccessor<PARTICLE, SoAFields> particles, PrimitiveOutput<VERTEX> & output, AllocationTrait) const;
+//
+// The allocation has no contiguous PARTICLE buffer: GetParticleAccessor<PARTICLE>() asserts and returns an empty accessor. Use ParticleAllocation::GetSoAAccessor() instead
+//
+//
+// 5 - the trait may set 'parallel_tick' so that the allocations of a layer are ticked on the JobSystem workers (one allocation per job)
+//
+// in that case the update functions (UpdateParticle, BeginUpdateParticles, UpdateParticleArrays) run concurrently for different allocations. They may only
+// read the trait, and read/write the particles and AllocationTrait of their own allocation. No spawning, no allocation/layer creation or destruction, no Class lookup.
+// Vertex generation (ParticleToPrimitives) always happens afterwards on the calling thread
+//
+//
 // There are several rendering mode
 //
 //  - QUAD (transformed as triangle pair)
@@ -101,6 +121,7 @@ namespace chaos
 {
 	// detect whether class have a nested class
 	CHAOS_GENERATE_HAS_TRAIT(AllocationTrait);
+	CHAOS_GENERATE_HAS_TRAIT(SoAFields);
 
 	BOOST_PP_SEQ_FOR_EACH(CHAOS_PARTICLE_FORWARD_DECL, _, CHAOS_PARTICLE_CLASSES);
 
@@ -117,6 +138,7 @@ namespace chaos
 #include "chaos/Particle/ParticleLayerTrait.h"
 #include "chaos/Particle/ParticleDefault.h"
 #include "chaos/Particle/ParticleAccessor.h"
+#include "chaos/Particle/ParticleSoA.h"
 #include "chaos/Particle/ParticleTraitTools.h"
 #include "chaos/Particle/ParticleAllocation.h"
 #include "chaos/Particle/ParticleLayer.h"
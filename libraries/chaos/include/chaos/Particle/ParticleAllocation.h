@@ -44,6 +44,8 @@ namespace chaos
 		virtual void * GetParticleBuffer() { return nullptr; }
 		/** get the particles */
 		virtual void const * GetParticleBuffer() const { return nullptr; }
+		/** returns whether the particles are stored as a structure of arrays (there is no particle buffer) */
+		virtual bool HasSoAStorage() const { return false; }
 		/** resize the particles */
 		virtual AutoCastedParticleAccessor Resize(size_t new_count);
 
@@ -62,6 +64,8 @@ namespace chaos
 
 		/** remove the allocation from its layer */
 		void RemoveFromLayer();
+		/** notify the layer that some particles have been moved through a mutable accessor (spatial indexes are rebuilt) */
+		void NotifyParticlesChanged();
 
 		/** returns true whether the class required is compatible with the one store in the buffer */
 		template<typename PARTICLE_TYPE>
@@ -81,6 +85,7 @@ namespace chaos
 		template<typename PARTICLE_TYPE>
 		ParticleAccessor<PARTICLE_TYPE> GetParticleAccessor(size_t start = 0, size_t count = 0)
 		{
+			assert(!HasSoAStorage()); // there is no contiguous particle buffer. Use GetSoAAccessor()
 			// check for compatibility => returns failure accessor
 			if (!IsParticleClassCompatible<PARTICLE_TYPE>())
 				return {};
@@ -96,6 +101,7 @@ namespace chaos
 		template<typename PARTICLE_TYPE>
 		ParticleConstAccessor<PARTICLE_TYPE> GetParticleConstAccessor(size_t start = 0, size_t count = 0) const
 		{
+			assert(!HasSoAStorage()); // there is no contiguous particle buffer. Use GetSoAAccessor()
 			// check for compatibility => returns failure accessor
 			if (!IsParticleClassCompatible<PARTICLE_TYPE>())
 				return {};
@@ -167,6 +173,13 @@ namespace chaos
 		using vertex_type = typename layer_trait_type::vertex_type;
 		using allocation_trait_type = typename get_AllocationTrait<layer_trait_type>::type;
 
+		/** whether the particles are stored as a structure of arrays (see ParticleSoAFields) */
+		static constexpr bool soa_storage = has_SoAFields_v<layer_trait_type>;
+
+		using soa_fields_type = typename get_SoAFields<layer_trait_type>::type;
+		using soa_accessor_type = ParticleSoAAccessor<particle_type, soa_fields_type>;
+		using soa_const_accessor_type = ParticleSoAConstAccessor<particle_type, soa_fields_type>;
+
 		/** constructor */
 		ParticleAllocation(ParticleLayerBase* in_layer, allocation_trait_type const & in_allocation_trait = {}) :
             ParticleAllocationBase(in_layer),
@@ -180,20 +193,55 @@ namespace chaos
 			return ClassManager::GetDefaultInstance()->FindCPPClass<particle_type>();
 		}
 
-        /** override */
+        /** override (there is no particle buffer for a structure of arrays) */
         virtual void* GetParticleBuffer() override
         {
-            return (particles.size() == 0) ? nullptr : &particles[0];
+			if constexpr (soa_storage)
+				return nullptr;
+			else
+				return (particles.size() == 0) ? nullptr : &particles[0];
         }
-        /** override */
+        /** override (there is no particle buffer for a structure of arrays) */
         virtual void const* GetParticleBuffer() const override
         {
-            return (particles.size() == 0) ? nullptr : &particles[0];
+			if constexpr (soa_storage)
+				return nullptr;
+			else
+				return (particles.size() == 0) ? nullptr : &particles[0];
         }
+		/** override */
+		virtual bool HasSoAStorage() const override
+		{
+			return soa_storage;
+		}
 		/** override */
 		virtual size_t GetParticleCount() const override
 		{
-			return particles.size();
+			if constexpr (soa_storage)
+				return particles.GetCount();
+			else
+				return particles.size();
+		}
+
+		/** get an accessor on the arrays (structure of arrays storage only) */
+		soa_accessor_type GetSoAAccessor(size_t start = 0, size_t count = 0) requires (soa_storage)
+		{
+			size_t particle_count = particles.GetCount();
+			if (start >= particle_count)
+				return {};
+			if (count == 0 || start + count > particle_count)
+				count = particle_count - start;
+			return soa_accessor_type(&particles, start, count);
+		}
+		/** get an accessor on the arrays (structure of arrays storage only) */
+		soa_const_accessor_type GetSoAAccessor(size_t start = 0, size_t count = 0) const requires (soa_storage)
+		{
+			size_t particle_count = particles.GetCount();
+			if (start >= particle_count)
+				return {};
+			if (count == 0 || start + count > particle_count)
+				count = particle_count - start;
+			return soa_const_accessor_type(&particles, start, count);
 		}
 		/** override */
 		virtual size_t GetParticleSize() const override
@@ -208,14 +256,18 @@ namespace chaos
 			if (!IsAttachedToLayer())
 				return AutoCastedParticleAccessor(this, 0, 0);
 			// early exit
-            size_t old_count = particles.size();
+            size_t old_count = GetParticleCount();
 			if (new_count == old_count)
 				return AutoCastedParticleAccessor(this, 0, 0);
 
 			// increment the number of particles
-			particles.resize(new_count);
+			if constexpr (soa_storage)
+				particles.Resize(new_count);
+			else
+				particles.resize(new_count);
 			// notify the layer
 			ConditionalRequireGPUUpdate(true, false);
+			NotifyParticlesChanged();
             // get the accessor on the new particles if any
             if (new_count < old_count)
                 return AutoCastedParticleAccessor(this, 0, 0);
@@ -227,56 +279,69 @@ namespace chaos
         {
 			using Flags = ParticleToPrimitive_ImplementationFlags;
 
-			constexpr int implementation_type = ParticleTraitTools::GetParticleToPrimitivesImplementationType<layer_trait_type>();
-
-			constexpr int trait_implementation    = (implementation_type & Flags::TRAIT_IMPLEMENTATION);
-			constexpr int default_implementation  = (implementation_type & Flags::DEFAULT_IMPLEMENTATION);
-			constexpr int particle_implementation = (implementation_type & Flags::PARTICLE_IMPLEMENTATION);
-			constexpr int with_begin_call         = (implementation_type & Flags::WITH_BEGIN_CALL);
-			constexpr int with_allocation_trait   = (implementation_type & Flags::WITH_ALLOCATION_TRAIT);
+			if constexpr (soa_storage)
+			{
+				constexpr int implementation_type = ParticleTraitTools::GetParticleArraysToPrimitivesImplementationFlags<layer_trait_type>();
+				static_assert(implementation_type != 0, "a layer trait with SoAFields must implement ParticleArraysToPrimitives(...)");
 
-			if constexpr (trait_implementation != 0)
+				if constexpr ((implementation_type & Flags::WITH_ALLOCATION_TRAIT) != 0)
+					layer_trait->ParticleArraysToPrimitives(GetSoAAccessor(), output, this->data);
+				else
+					layer_trait->ParticleArraysToPrimitives(GetSoAAccessor(), output);
+			}
+			else
 			{
-				if constexpr (with_allocation_trait != 0) // the member 'data' owns the information per allocation
+				constexpr int implementation_type = ParticleTraitTools::GetParticleToPrimitivesImplementationType<layer_trait_type>();
+
+				constexpr int trait_implementation    = (implementation_type & Flags::TRAIT_IMPLEMENTATION);
+				constexpr int default_implementation  = (implementation_type & Flags::DEFAULT_IMPLEMENTATION);
+				constexpr int particle_implementation = (implementation_type & Flags::PARTICLE_IMPLEMENTATION);
+				constexpr int with_begin_call         = (implementation_type & Flags::WITH_BEGIN_CALL);
+				constexpr int with_allocation_trait   = (implementation_type & Flags::WITH_ALLOCATION_TRAIT);
+
+				if constexpr (trait_implementation != 0)
 				{
-					if constexpr (with_begin_call != 0)
+					if constexpr (with_allocation_trait != 0) // the member 'data' owns the information per allocation
+					{
+						if constexpr (with_begin_call != 0)
+						{
+							auto accessor = GetParticleConstAccessor<particle_type>();
+
+							DoParticlesToPrimitivesLoop_LayerTraitImplementation(
+								layer_trait,
+								output,
+								layer_trait->BeginParticlesToPrimitives(accessor, this->data), // do not use a temp variable, so it can be a left-value reference
+								this->data);
+						}
+						else
+						{
+							DoParticlesToPrimitivesLoop_LayerTraitImplementation(layer_trait, output, this->data);
+						}
+					}
+					else if constexpr (with_begin_call != 0)
 					{
 						auto accessor = GetParticleConstAccessor<particle_type>();
 
 						DoParticlesToPrimitivesLoop_LayerTraitImplementation(
 							layer_trait,
 							output,
-							layer_trait->BeginParticlesToPrimitives(accessor, this->data), // do not use a temp variable, so it can be a left-value reference
-							this->data);
+							layer_trait->BeginParticlesToPrimitives(accessor) // do not use a temp variable, so it can be a left-value reference
+						);
 					}
 					else
 					{
-						DoParticlesToPrimitivesLoop_LayerTraitImplementation(layer_trait, output, this->data);
+						DoParticlesToPrimitivesLoop_LayerTraitImplementation(layer_trait, output);
 					}
 				}
-				else if constexpr (with_begin_call != 0)
+				else if constexpr (particle_implementation != 0)
 				{
-					auto accessor = GetParticleConstAccessor<particle_type>();
-
-					DoParticlesToPrimitivesLoop_LayerTraitImplementation(
-						layer_trait,
-						output,
-						layer_trait->BeginParticlesToPrimitives(accessor) // do not use a temp variable, so it can be a left-value reference
-					);
+					DoParticlesToPrimitivesLoop_ParticleImplementation(output);
 				}
-				else
+				else if constexpr (default_implementation != 0)
 				{
-					DoParticlesToPrimitivesLoop_LayerTraitImplementation(layer_trait, output);
+					DoParticlesToPrimitivesLoop_DefaultImplementation(output);
 				}
 			}
-			else if constexpr (particle_implementation != 0)
-			{
-				DoParticlesToPrimitivesLoop_ParticleImplementation(output);
-			}
-			else if constexpr (default_implementation != 0)
-			{
-				DoParticlesToPrimitivesLoop_DefaultImplementation(output);
-			}
         }
 
     protected:
@@ -284,8 +349,13 @@ namespace chaos
 		bool TickAllocation(float delta_time, layer_trait_type const * layer_trait)
 		{
             bool destroy_allocation = false;
-			if (particles.size() > 0)
-				destroy_allocation = UpdateParticles(delta_time, layer_trait);
+			if (GetParticleCount() > 0)
+			{
+				if constexpr (soa_storage)
+					destroy_allocation = UpdateParticleArrays(delta_time, layer_trait);
+				else
+					destroy_allocation = UpdateParticles(delta_time, layer_trait);
+			}
             return destroy_allocation;
 		}
 
@@ -305,7 +375,10 @@ namespace chaos
 
 			size_t remaining_particles = particle_count; // by default, no particle destruction
 
-			ParticleAccessor<particle_type> particle_accessor = GetParticleAccessor();
+			// XXX : built from the typed buffer (no Class lookup) because this may run on a worker thread (see ParticleLayerTraitBase::parallel_tick)
+			ParticleAccessor<particle_type> particle_accessor = (particle_count == 0) ?
+				ParticleAccessor<particle_type>() :
+				ParticleAccessor<particle_type>(particles.data(), particle_count, sizeof(particle_type));
 
 			if constexpr (trait_implementation != 0)
 			{
@@ -354,6 +427,39 @@ namespace chaos
 			return false; // do not destroy allocation
 		}
 
+		bool UpdateParticleArrays(float delta_time, layer_trait_type const* layer_trait)
+		{
+			using Flags = UpdateParticle_ImplementationFlags;
+
+			constexpr int implementation_type = ParticleTraitTools::GetUpdateParticleArraysImplementationFlags<layer_trait_type>();
+
+			if constexpr (implementation_type == Flags::NONE)
+			{
+				return false; // static particles
+			}
+			else
+			{
+				size_t particle_count = particles.GetCount();
+
+				// the trait flags the particles to destroy, then whole runs of survivors are moved array per array (order is preserved)
+				destroyed_particles.assign(particle_count, 0);
+				if constexpr ((implementation_type & Flags::WITH_ALLOCATION_TRAIT) != 0)
+					layer_trait->UpdateParticleArrays(delta_time, GetSoAAccessor(), destroyed_particles.data(), this->data);
+				else
+					layer_trait->UpdateParticleArrays(delta_time, GetSoAAccessor(), destroyed_particles.data());
+
+				size_t remaining_particles = particle_count;
+				if (std::any_of(destroyed_particles.begin(), destroyed_particles.end(), [](uint8_t destroyed) { return destroyed != 0; }))
+					remaining_particles = particles.Compact(destroyed_particles.data());
+
+				if (remaining_particles == 0 && GetDestroyWhenEmpty())
+					return true; // destroy allocation
+				else if (remaining_particles != particle_count)
+					Resize(remaining_particles);
+				return false; // do not destroy allocation
+			}
+		}
+
 		template<typename ...PARAMS>
 		size_t DoUpdateParticlesLoop(float delta_time, layer_trait_type const* layer_trait, ParticleAccessor<particle_type> particle_accessor, PARAMS && ...params)
 		{
@@ -367,8 +473,10 @@ namespace chaos
 
             size_t particle_count = particle_accessor.GetDataCount();
 
-			// tick all particles. overide all particles that have been destroyed by next on the array
-			size_t j = 0;
+			// pass 1: tick all particles in place. Destruction is only recorded so that the loop does not move any data
+			destroyed_particles.resize(particle_count);
+
+			size_t destroyed_count = 0;
 			for (size_t i = 0; i < particle_count; ++i)
 			{
 				particle_type& particle = particle_accessor[i];
@@ -381,12 +489,26 @@ namespace chaos
 				else if constexpr (default_implementation != 0)
 					destroy_particle = UpdateParticle(delta_time, particle, std::forward<PARAMS>(params)...);
 
-				if (!destroy_particle)
-				{
-					if (i != j)
-						particle_accessor[j] = particle;
-					++j;
-				}
+				destroyed_particles[i] = destroy_particle;
+				destroyed_count += destroy_particle;
+			}
+
+			// pass 2: compaction. Move whole runs of surviving particles over destroyed ones (order is preserved)
+			if (destroyed_count == 0)
+				return particle_count;
+
+			size_t j = 0;
+			size_t i = 0;
+			while (i < particle_count)
+			{
+				while (i < particle_count && destroyed_particles[i])
+					++i;
+				size_t run_start = i;
+				while (i < particle_count && !destroyed_particles[i])
+					++i;
+				if (run_start != j)
+					std::move(particles.begin() + run_start, particles.begin() + i, particles.begin() + j);
+				j += (i - run_start);
 			}
 			return j; // final number of particles
 		}
@@ -420,8 +542,10 @@ namespace chaos
 
 	protected:
 
-		/** the particles buffer */
-		std::vector<particle_type> particles;
+		/** the particles buffer (one array per field for a structure of arrays) */
+		std::conditional_t<soa_storage, ParticleSoAStorage<particle_type, soa_fields_type>, std::vector<particle_type>> particles;
+		/** a temporary buffer used during update to flag the particles to destroy (kept to avoid reallocations) */
+		std::vector<uint8_t> destroyed_particles;
 	};
 
 #endif
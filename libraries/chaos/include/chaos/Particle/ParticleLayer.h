@@ -38,6 +38,8 @@ namespace chaos
 		virtual bool AreVerticesDynamic() const { return true; }
 		/** returns true whether particles need to be updated */
 		virtual bool AreParticlesDynamic() const { return true; }
+		/** returns true whether allocations are ticked on several threads */
+		virtual bool IsParallelTick() const { return false; }
 
 		/** get the particle ID for this system */
 		virtual Class const* GetParticleClass() const { return nullptr; }
@@ -96,6 +98,11 @@ namespace chaos
 		/** force GPU buffer update */
 		void SetGPUBufferDirty() { require_GPU_update = true; }
 
+		/** get a counter that changes whenever the allocations or their particles may have been modified */
+		uint64_t GetContentRevision() const { return content_revision.load(std::memory_order_relaxed); }
+		/** notify that the allocations or their particles may have been modified */
+		void IncrementContentRevision() { content_revision.fetch_add(1, std::memory_order_relaxed); }
+
 		/** getter on the extra data */
 		template<typename T>
 		T* GetOwnedData()
@@ -138,6 +145,8 @@ namespace chaos
 		bool TickAllocations(float delta_time);
 		/** internal method to only update one allocation */
 		virtual bool TickAllocation(float delta_time, ParticleAllocationBase* allocation) { return false; } // do not destroy the allocation
+		/** tick an allocation and returns whether it is to be destroyed */
+		bool TickOrDestroyAllocation(float delta_time, ParticleAllocationBase* allocation);
 
 		/** override */
 		virtual bool DoUpdateGPUResources(GPURenderer* renderer) override;
@@ -168,8 +177,10 @@ namespace chaos
 		GPUBufferPool buffer_pool;
 		/** the corresponding dynamic mesh */
 		shared_ptr<GPUMesh> mesh;
-		/** whether there was changes in particles, and a vertex array need to be recomputed */
-		bool require_GPU_update = false;
+		/** whether there was changes in particles, and a vertex array need to be recomputed (atomic because allocations may be ticked on several threads) */
+		std::atomic<bool> require_GPU_update = false;
+		/** changes whenever the allocations or their particles may have been modified (allocations may be ticked on several threads) */
+		std::atomic<uint64_t> content_revision = 0;
 };
 
 	// ==============================================================
@@ -215,6 +226,11 @@ namespace chaos
 			return this->data.dynamic_vertices;
 		}
 		/** override */
+		virtual bool IsParallelTick() const override
+		{
+			return this->data.parallel_tick;
+		}
+		/** override */
 		virtual Class const* GetParticleClass() const override { return ClassManager::GetDefaultInstance()->FindCPPClass<particle_type>(); }
 		/** override */
 		virtual GPUVertexDeclaration* GetVertexDeclaration() const override
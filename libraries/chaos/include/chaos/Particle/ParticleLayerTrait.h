@@ -26,6 +26,8 @@ namespace chaos
 		bool dynamic_particles = true;
 		/** whether the vertices are dynamic */
 		bool dynamic_vertices = true;
+		/** whether the allocations may be ticked on several threads (see Particle.h for what the update functions may touch) */
+		bool parallel_tick = false;
 	};
 
 	// ==============================================================
@@ -0,0 +1,388 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	template<auto... MEMBERS>
+	class ParticleSoAFields;
+
+	template<typename TYPE, size_t ALIGNMENT>
+	class ParticleSoAAllocator;
+
+	template<typename PARTICLE_TYPE, typename FIELDS>
+	class ParticleSoAStorage;
+
+	template<typename PARTICLE_TYPE, typename FIELDS, bool CONSTNESS>
+	class ParticleSoAReference;
+
+	template<typename PARTICLE_TYPE, typename FIELDS, bool CONSTNESS>
+	class ParticleSoAAccessorBase;
+
+	template<typename PARTICLE_TYPE, typename FIELDS>
+	using ParticleSoAAccessor = ParticleSoAAccessorBase<PARTICLE_TYPE, FIELDS, false>;
+	template<typename PARTICLE_TYPE, typename FIELDS>
+	using ParticleSoAConstAccessor = ParticleSoAAccessorBase<PARTICLE_TYPE, FIELDS, true>;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// ==============================================================
+	// ParticleSoAFields
+	// ==============================================================
+
+	// XXX : a layer trait opts into the structure-of-arrays storage by declaring
+	//
+	//         using SoAFields = ParticleSoAFields<&MyParticle::position, &MyParticle::velocity, ...>;
+	//
+	//       each listed member is stored in its own contiguous (and aligned) array. The members that are not listed are not stored at all
+
+	template<auto... MEMBERS>
+	class ParticleSoAFields
+	{
+		static_assert(sizeof...(MEMBERS) > 0, "ParticleSoAFields requires at least one member");
+		static_assert((std::is_member_object_pointer_v<decltype(MEMBERS)> && ...), "ParticleSoAFields only accepts pointers to data members");
+
+	public:
+
+		/** the number of fields */
+		static constexpr size_t count = sizeof...(MEMBERS);
+
+		/** returns the index of a member in the list (count if not found) */
+		template<auto MEMBER>
+		static constexpr size_t GetFieldIndex()
+		{
+			size_t result = count;
+			size_t index = 0;
+			([&]()
+			{
+				if constexpr (std::is_same_v<decltype(MEMBER), decltype(MEMBERS)>)
+					if (result == count && MEMBER == MEMBERS)
+						result = index;
+				++index;
+			}(), ...);
+			return result;
+		}
+	};
+
+	// ==============================================================
+	// ParticleSoAAllocator
+	// ==============================================================
+
+	template<typename TYPE, size_t ALIGNMENT>
+	class ParticleSoAAllocator
+	{
+	public:
+
+		using value_type = TYPE;
+
+		template<typename OTHER_TYPE>
+		struct rebind { using other = ParticleSoAAllocator<OTHER_TYPE, ALIGNMENT>; };
+
+		/** constructor */
+		ParticleSoAAllocator() = default;
+		/** conversion constructor */
+		template<typename OTHER_TYPE>
+		ParticleSoAAllocator(ParticleSoAAllocator<OTHER_TYPE, ALIGNMENT> const& src) {}
+
+		/** allocate an aligned buffer */
+		TYPE* allocate(size_t n)
+		{
+			return static_cast<TYPE*>(::operator new(n * sizeof(TYPE), std::align_val_t(ALIGNMENT)));
+		}
+		/** release an aligned buffer */
+		void deallocate(TYPE* p, size_t n)
+		{
+			::operator delete(p, std::align_val_t(ALIGNMENT));
+		}
+
+		/** all instances are interchangeable */
+		template<typename OTHER_TYPE>
+		bool operator == (ParticleSoAAllocator<OTHER_TYPE, ALIGNMENT> const& src) const
+		{
+			return true;
+		}
+	};
+
+	// ==============================================================
+	// ParticleSoAStorage
+	// ==============================================================
+
+	template<typename PARTICLE_TYPE, auto... MEMBERS>
+	class ParticleSoAStorage<PARTICLE_TYPE, ParticleSoAFields<MEMBERS...>>
+	{
+	public:
+
+		using particle_type = PARTICLE_TYPE;
+		using fields_type = ParticleSoAFields<MEMBERS...>;
+
+		/** the alignment of each array (enough for AVX loads) */
+		static constexpr size_t ALIGNMENT = 32;
+
+		/** the type of a field */
+		template<auto MEMBER>
+		using field_type = std::remove_cvref_t<decltype(std::declval<particle_type&>().*MEMBER)>;
+		/** the type of an array */
+		template<typename TYPE>
+		using array_type = std::vector<TYPE, ParticleSoAAllocator<TYPE, ALIGNMENT>>;
+
+		/** gets the number of particles */
+		size_t GetCount() const
+		{
+			return count;
+		}
+
+		/** change the number of particles. New particles are initialized from a default constructed particle */
+		void Resize(size_t new_count)
+		{
+			if (new_count > count)
+			{
+				particle_type default_particle = {};
+				std::apply([&](auto & ... arrays)
+				{
+					(arrays.resize(new_count, default_particle.*MEMBERS), ...);
+				}, arrays);
+			}
+			else
+			{
+				std::apply([new_count](auto & ... arrays)
+				{
+					(arrays.resize(new_count), ...);
+				}, arrays);
+			}
+			count = new_count;
+		}
+
+		/** gets the array for a given member */
+		template<auto MEMBER>
+		field_type<MEMBER>* GetField()
+		{
+			constexpr size_t index = fields_type::template GetFieldIndex<MEMBER>();
+			static_assert(index < fields_type::count, "member is not stored in the ParticleSoAFields");
+			return std::get<index>(arrays).data();
+		}
+		/** gets the array for a given member */
+		template<auto MEMBER>
+		field_type<MEMBER> const* GetField() const
+		{
+			constexpr size_t index = fields_type::template GetFieldIndex<MEMBER>();
+			static_assert(index < fields_type::count, "member is not stored in the ParticleSoAFields");
+			return std::get<index>(arrays).data();
+		}
+
+		/** gather one particle (members that are not stored keep their default value) */
+		particle_type GetParticle(size_t index) const
+		{
+			assert(index < count);
+			particle_type result = {};
+			std::apply([&](auto const & ... arrays)
+			{
+				((result.*MEMBERS = arrays[index]), ...);
+			}, arrays);
+			return result;
+		}
+		/** scatter one particle (members that are not stored are ignored) */
+		void SetParticle(size_t index, particle_type const& particle)
+		{
+			assert(index < count);
+			std::apply([&](auto & ... arrays)
+			{
+				((arrays[index] = particle.*MEMBERS), ...);
+			}, arrays);
+		}
+
+		/** move all particles that are not flagged over the flagged ones (order is preserved). The storage is not resized. Returns the number of remaining particles */
+		size_t Compact(uint8_t const* destroyed_particles)
+		{
+			size_t j = 0;
+			size_t i = 0;
+			while (i < count)
+			{
+				while (i < count && destroyed_particles[i])
+					++i;
+				size_t run_start = i;
+				while (i < count && !destroyed_particles[i])
+					++i;
+				if (run_start != j)
+				{
+					std::apply([&](auto & ... arrays)
+					{
+						(std::move(arrays.begin() + run_start, arrays.begin() + i, arrays.begin() + j), ...);
+					}, arrays);
+				}
+				j += (i - run_start);
+			}
+			return j;
+		}
+
+	protected:
+
+		/** one array per field */
+		std::tuple<array_type<field_type<MEMBERS>>...> arrays;
+		/** the number of particles */
+		size_t count = 0;
+	};
+
+	// ==============================================================
+	// ParticleSoAReference
+	// ==============================================================
+
+	// XXX : there is no particle object in the storage. A reference gives access to the fields of one particle
+	//
+	//         accessor[i].Get<&MyParticle::position>() += velocity;  => written in the array
+	//         MyParticle p = accessor[i];                             => gather a copy
+	//         accessor[i] = p;                                        => scatter (non const accessors only)
+
+	template<typename PARTICLE_TYPE, typename FIELDS, bool CONSTNESS>
+	class ParticleSoAReference
+	{
+	public:
+
+		using particle_type = PARTICLE_TYPE;
+		using storage_type = std::conditional_t<CONSTNESS, ParticleSoAStorage<PARTICLE_TYPE, FIELDS> const, ParticleSoAStorage<PARTICLE_TYPE, FIELDS>>;
+
+		template<auto MEMBER>
+		using field_type = std::conditional_t<CONSTNESS,
+			typename ParticleSoAStorage<PARTICLE_TYPE, FIELDS>::template field_type<MEMBER> const,
+			typename ParticleSoAStorage<PARTICLE_TYPE, FIELDS>::template field_type<MEMBER>>;
+
+		/** constructor */
+		ParticleSoAReference(storage_type* in_storage, size_t in_index) :
+			storage(in_storage), index(in_index)
+		{
+			assert(storage != nullptr);
+			assert(index < storage->GetCount());
+		}
+		/** copy constructor */
+		ParticleSoAReference(ParticleSoAReference const& src) = default;
+
+		/** gets a reference on one field of the particle */
+		template<auto MEMBER>
+		field_type<MEMBER>& Get() const
+		{
+			return storage->template GetField<MEMBER>()[index];
+		}
+
+		/** gather a copy of the particle */
+		operator particle_type() const
+		{
+			return storage->GetParticle(index);
+		}
+
+		/** scatter a particle (members that are not stored are ignored) */
+		ParticleSoAReference const& operator = (particle_type const& particle) const requires (!CONSTNESS)
+		{
+			storage->SetParticle(index, particle);
+			return *this;
+		}
+		/** copy the particle referenced by another reference (the reference itself is not rebound) */
+		template<bool OTHER_CONSTNESS>
+		ParticleSoAReference const& operator = (ParticleSoAReference<PARTICLE_TYPE, FIELDS, OTHER_CONSTNESS> const& src) const requires (!CONSTNESS)
+		{
+			storage->SetParticle(index, particle_type(src));
+			return *this;
+		}
+		/** copy the particle referenced by another reference (the reference itself is not rebound) */
+		ParticleSoAReference const& operator = (ParticleSoAReference const& src) const requires (!CONSTNESS)
+		{
+			storage->SetParticle(index, particle_type(src));
+			return *this;
+		}
+
+	protected:
+
+		/** the storage */
+		storage_type* storage = nullptr;
+		/** the index of the particle in the storage */
+		size_t index = 0;
+	};
+
+	// ==============================================================
+	// ParticleSoAAccessorBase
+	// ==============================================================
+
+	template<typename PARTICLE_TYPE, typename FIELDS, bool CONSTNESS>
+	class ParticleSoAAccessorBase
+	{
+	public:
+
+		using particle_type = PARTICLE_TYPE;
+		using storage_type = std::conditional_t<CONSTNESS, ParticleSoAStorage<PARTICLE_TYPE, FIELDS> const, ParticleSoAStorage<PARTICLE_TYPE, FIELDS>>;
+		using reference_type = ParticleSoAReference<PARTICLE_TYPE, FIELDS, CONSTNESS>;
+
+		template<auto MEMBER>
+		using field_type = std::conditional_t<CONSTNESS,
+			typename ParticleSoAStorage<PARTICLE_TYPE, FIELDS>::template field_type<MEMBER> const,
+			typename ParticleSoAStorage<PARTICLE_TYPE, FIELDS>::template field_type<MEMBER>>;
+
+		/** default constructor */
+		ParticleSoAAccessorBase() = default;
+		/** copy constructor */
+		ParticleSoAAccessorBase(ParticleSoAAccessorBase const& src) = default;
+		/** conversion to const accessor */
+		template<bool OTHER_CONSTNESS> requires (CONSTNESS && !OTHER_CONSTNESS)
+		ParticleSoAAccessorBase(ParticleSoAAccessorBase<PARTICLE_TYPE, FIELDS, OTHER_CONSTNESS> const& src) :
+			storage(src.GetStorage()), start(src.GetStart()), data_count(src.GetDataCount())
+		{
+		}
+		/** constructor */
+		ParticleSoAAccessorBase(storage_type* in_storage, size_t in_start, size_t in_data_count) :
+			storage(in_storage), start(in_start), data_count(in_data_count)
+		{
+			assert(storage != nullptr);
+			assert(start + data_count <= storage->GetCount());
+		}
+
+		/** gets the number of particles */
+		size_t GetDataCount() const
+		{
+			return data_count;
+		}
+		/** gets the index of the first particle in the storage */
+		size_t GetStart() const
+		{
+			return start;
+		}
+		/** gets the storage */
+		storage_type* GetStorage() const
+		{
+			return storage;
+		}
+		/** check whether the accessor has elements */
+		bool IsValid() const
+		{
+			return (data_count > 0);
+		}
+
+		/** gets the array of a member (index 0 is the first particle of the accessor) */
+		template<auto MEMBER>
+		field_type<MEMBER>* GetField() const
+		{
+			if (storage == nullptr)
+				return nullptr;
+			return storage->template GetField<MEMBER>() + start;
+		}
+
+		/** gets a reference on one particle (writes through the reference go into the arrays) */
+		reference_type operator [](size_t index) const
+		{
+			assert(index < data_count);
+			return reference_type(storage, start + index);
+		}
+		/** scatter one particle */
+		void Set(size_t index, particle_type const& particle) const requires (!CONSTNESS)
+		{
+			assert(index < data_count);
+			storage->SetParticle(start + index, particle);
+		}
+
+	protected:
+
+		/** the storage */
+		storage_type* storage = nullptr;
+		/** the first particle */
+		size_t start = 0;
+		/** the number of particles */
+		size_t data_count = 0;
+	};
+
+#endif
+
+}; // namespace chaos
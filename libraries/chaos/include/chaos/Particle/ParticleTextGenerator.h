@@ -11,6 +11,8 @@ namespace chaos
 		class GeneratorResult;
 		class Style;
 		class GeneratorData;
+		class GeneratorCheckpoint;
+		class GeneratorCacheEntry;
 		class Generator;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
@@ -36,6 +38,8 @@ namespace chaos
 			float line_spacing = 5.0f;
 			/** spacing between characters */
 			float character_spacing = 0.0f;
+			/** whether the kerning of the font is applied between characters (opt-in, it changes the layout of existing texts) */
+			bool kerning = false;
 			/** padding for bitmaps */
 			glm::vec2 bitmap_padding = { 0.0f, 0.0f };
 			/** the text limits */
@@ -57,6 +61,19 @@ namespace chaos
 			glm::vec2 position = { 0.0f, 0.0f };
 			/** the hotpoint */
 			Hotpoint hotpoint = Hotpoint::BOTTOM_LEFT;
+
+			/** returns whether the parameters that change the lines (before justification and hotpoint) are the same */
+			bool IsSameLayout(GeneratorParams const& other) const;
+			/** returns whether the parameters that change the justified lines (all but position and hotpoint) are the same */
+			bool IsSameJustifiedLayout(GeneratorParams const& other) const;
+			/** comparison operator */
+			bool operator == (GeneratorParams const& other) const;
+			/** compute a hash for the parameters that change the lines (see IsSameLayout) */
+			uint64_t GetLayoutHash() const;
+			/** compute a hash for the parameters that change the justified lines (see IsSameJustifiedLayout) */
+			uint64_t GetJustifiedLayoutHash() const;
+			/** compute a hash for the parameters */
+			uint64_t GetHash() const;
 		};
 
 		/** json functions */
@@ -165,6 +182,28 @@ namespace chaos
 			BitmapAtlas::FontInfo const* font_info = nullptr;
 		};
 
+		/**
+		* GeneratorCheckpoint : the state of the generation before a given character (used to resume the generation of a text)
+		*/
+
+		class CHAOS_API GeneratorCheckpoint
+		{
+		public:
+
+			/** the position of the next character in the text */
+			size_t text_offset = 0;
+			/** the number of lines */
+			size_t line_count = 0;
+			/** the number of tokens in the last line */
+			size_t last_line_token_count = 0;
+			/** the style (checkpoints are only made outside markups) */
+			Style style;
+			/** current line position for a bitmap */
+			glm::vec2 bitmap_position = { 0.0f, 0.0f };
+			/** current line position for a character */
+			glm::vec2 character_position = { 0.0f, 0.0f };
+		};
+
 		/**
 		* GeneratorData : an utility structure used during particles generation
 		*/
@@ -207,6 +246,11 @@ namespace chaos
 			/** insert a token */
 			void InsertTokenInLine(Token& token);
 
+			/** get the current state of the generation */
+			GeneratorCheckpoint GetCheckpoint(size_t text_offset) const;
+			/** restore a state of the generation (token_lines are the lines the checkpoint was made for) */
+			void RestoreCheckpoint(GeneratorCheckpoint const& checkpoint, std::vector<TokenLine> const& token_lines);
+
 		public:
 
 			/** the generator in use */
@@ -223,6 +267,50 @@ namespace chaos
 			glm::vec2 bitmap_position = { 0.0f, 0.0f };
 			/** current line position for a character (below scanline, at descender level) */
 			glm::vec2 character_position = { 0.0f, 0.0f };
+
+			/** if not null, the checkpoints are stored during generation */
+			std::vector<GeneratorCheckpoint>* checkpoints = nullptr;
+		};
+
+		/**
+		* GeneratorCacheEntry : a text generated by the layout cache (it is shared and must not be modified)
+		*/
+
+		// XXX : the cached text does not depend on the position and on the hotpoint : its result is generated with its bottom left corner at origin
+		//       and the offset to the wanted placement is applied when the particles are emitted (see GetPlacementOffset)
+
+		class CHAOS_API GeneratorCacheEntry : public Object
+		{
+			friend class Generator;
+
+		public:
+
+			/** get the result (bottom left corner at origin) */
+			GeneratorResult const& GetResult() const { return result; }
+			/** get the text */
+			std::string const& GetText() const { return text; }
+			/** get the parameters (position at origin, BOTTOM_LEFT hotpoint) */
+			GeneratorParams const& GetParams() const { return params; }
+
+			/** get the offset that moves the result to the position and hotpoint of the parameters */
+			glm::vec2 GetPlacementOffset(GeneratorParams const& placement_params) const;
+
+		protected:
+
+			/** the text */
+			std::string text;
+			/** the parameters */
+			GeneratorParams params;
+			/** the hash of text and parameters */
+			uint64_t hash = 0;
+			/** the hash of the parameters that change the lines (to quickly discard the entries that cannot be resumed) */
+			uint64_t layout_hash = 0;
+			/** the final result */
+			GeneratorResult result;
+			/** the lines before justification and hotpoint */
+			std::vector<TokenLine> raw_token_lines;
+			/** the states where the generation can be resumed */
+			std::vector<GeneratorCheckpoint> checkpoints;
 		};
 
 		/**
@@ -256,13 +344,31 @@ namespace chaos
 
 			/** the main method to generator a text */
 			bool Generate(char const* text, GeneratorResult& result, GeneratorParams const& params = {}) const;
+			/** generate a text with the layout cache (texts sharing a prefix with a cached one are only generated from the first difference) */
+			shared_ptr<GeneratorCacheEntry> GenerateCached(char const* text, GeneratorParams const& params = {}) const;
+
+			/** change the maximum number of texts in the layout cache (0 to disable) */
+			void SetCacheSize(size_t in_cache_size);
+			/** get the maximum number of texts in the layout cache */
+			size_t GetCacheSize() const { return cache_size; }
+			/** empty the layout cache */
+			void ClearCache() const;
 
 		protected:
 
 			/** the generation internal method */
 			bool DoGenerate(char const* text, GeneratorData& generator_data) const;
 			/** generate the lines, without cutting them */
-			bool DoGenerateLines(char const* text, GeneratorData& generator_data) const;
+			bool DoGenerateLines(char const* text, GeneratorData& generator_data, size_t start_offset = 0) const;
+			/** justify and move the lines to the hotpoint */
+			bool DoFinalizeLines(GeneratorData& generator_data) const;
+			/** push the default style on the stack */
+			void PushDefaultStyle(GeneratorData& generator_data) const;
+
+			/** get the cached entry that shares the longest prefix with the text (the checkpoint to resume from is returned too) */
+			GeneratorCacheEntry const* FindBestPrefixEntry(std::string_view text, GeneratorParams const& params, uint64_t layout_hash, GeneratorCheckpoint const*& checkpoint) const;
+			/** generate a new entry (resuming from a cached entry if possible) */
+			shared_ptr<GeneratorCacheEntry> DoGenerateCacheEntry(std::string_view text, GeneratorParams const& params, uint64_t hash, uint64_t layout_hash) const;
 
 			/** get a color by its name */
 			glm::vec4 const* GetColor(char const* name) const;
@@ -298,6 +404,19 @@ namespace chaos
 
 			/** the atlas where to find entries */
 			BitmapAtlas::AtlasBase const& atlas;
+
+		protected:
+
+			/** the maximum number of texts in the cache */
+			size_t cache_size = 64;
+			/** the cache may be used from const methods */
+			mutable std::mutex cache_mutex;
+			/** the cached texts (most recently used first) */
+			mutable std::list<shared_ptr<GeneratorCacheEntry>> cache_entries;
+			/** the cached texts by hash */
+			mutable std::unordered_map<uint64_t, std::list<shared_ptr<GeneratorCacheEntry>>::iterator> cache_map;
+			/** the version of the atlas used for the cached texts */
+			mutable uint64_t cache_atlas_version = 0;
 		};
 
 		/** transform a token into a particle */
@@ -309,13 +428,13 @@ namespace chaos
 
 		/** output primitives corresponding to generated text */
 		template<typename VERTEX_TYPE>
-		QuadPrimitive<VERTEX_TYPE> TextToPrimitives(PrimitiveOutput<VERTEX_TYPE>& output, GeneratorResult const& generator_result, CreateTextAllocationParams const& allocation_params = {});
+		QuadPrimitive<VERTEX_TYPE> TextToPrimitives(PrimitiveOutput<VERTEX_TYPE>& output, GeneratorResult const& generator_result, CreateTextAllocationParams const& allocation_params = {}, glm::vec2 const& offset = { 0.0f, 0.0f });
 
 #else
 
 		/** output primitives corresponding to generated text */
 		template<typename VERTEX_TYPE>
-		QuadPrimitive<VERTEX_TYPE> TextToPrimitives(PrimitiveOutput<VERTEX_TYPE>& output, GeneratorResult const& generator_result, CreateTextAllocationParams const& allocation_params)
+		QuadPrimitive<VERTEX_TYPE> TextToPrimitives(PrimitiveOutput<VERTEX_TYPE>& output, GeneratorResult const& generator_result, CreateTextAllocationParams const& allocation_params, glm::vec2 const& offset)
 		{
 			// early exit
 			size_t token_count = generator_result.GetTokenCount();
@@ -331,6 +450,7 @@ namespace chaos
 			if (allocation_params.create_background)
 			{
 				ParticleDefault particle = GetBackgroundParticle(generator_result, allocation_params);
+				particle.bounding_box.position += offset;
 				ParticleToPrimitive(particle, current_primitive);
 				current_primitive++;
 			}
@@ -341,6 +461,7 @@ namespace chaos
 				for (size_t j = 0; j < line.size(); ++j)
 				{
 					ParticleDefault particle = TokenToParticle(line[j]);
+					particle.bounding_box.position += offset;
 					ParticleToPrimitive(particle, current_primitive);
 					current_primitive++;
 				}
@@ -16,6 +16,9 @@ namespace chaos
 	CHAOS_GENERATE_CHECK_METHOD_AND_FUNCTION(ParticleToPrimitives);
 	CHAOS_GENERATE_CHECK_METHOD_AND_FUNCTION(BeginParticlesToPrimitives);
 
+	CHAOS_GENERATE_CHECK_METHOD_AND_FUNCTION(UpdateParticleArrays);
+	CHAOS_GENERATE_CHECK_METHOD_AND_FUNCTION(ParticleArraysToPrimitives);
+
 	// ==============================================================
 	// The kind of ParticleToPrimitive to do
 	// ==============================================================
@@ -188,6 +191,59 @@ namespace chaos
 
 			return Flags::NONE;
 		}
+
+		/** returns the kind of implementation for the batch update of a trait with SoAFields (only TRAIT_IMPLEMENTATION and WITH_ALLOCATION_TRAIT are meaningful) */
+		template<typename TRAIT_TYPE>
+		constexpr int GetUpdateParticleArraysImplementationFlags()
+		{
+			using Flags = UpdateParticle_ImplementationFlags;
+
+			// the types used
+			using trait = TRAIT_TYPE;
+
+			using particle = typename trait::particle_type;
+			using accessor = ParticleSoAAccessor<particle, typename trait::SoAFields>;
+
+			if constexpr (has_AllocationTrait_v<trait>)
+			{
+				using allocation_trait = typename trait::AllocationTrait;
+
+				if constexpr (check_method_UpdateParticleArrays_v<trait const, float, accessor, uint8_t*, allocation_trait const&>)
+					return Flags::TRAIT_IMPLEMENTATION | Flags::WITH_ALLOCATION_TRAIT;
+			}
+			if constexpr (check_method_UpdateParticleArrays_v<trait const, float, accessor, uint8_t*>)
+				return Flags::TRAIT_IMPLEMENTATION;
+
+			return Flags::NONE;
+		}
+
+		/** returns the kind of implementation for the batch rendering of a trait with SoAFields (only TRAIT_IMPLEMENTATION and WITH_ALLOCATION_TRAIT are meaningful) */
+		template<typename TRAIT_TYPE>
+		constexpr int GetParticleArraysToPrimitivesImplementationFlags()
+		{
+			using Flags = ParticleToPrimitive_ImplementationFlags;
+
+			// the types used
+			using trait = TRAIT_TYPE;
+
+			using particle = typename trait::particle_type;
+			using vertex = typename trait::vertex_type;
+			using accessor = ParticleSoAConstAccessor<particle, typename trait::SoAFields>;
+
+			using primitive_output = PrimitiveOutput<vertex>;
+
+			if constexpr (has_AllocationTrait_v<trait>)
+			{
+				using allocation_trait = typename trait::AllocationTrait;
+
+				if constexpr (check_method_ParticleArraysToPrimitives_v<trait const, accessor, primitive_output&, allocation_trait const&>)
+					return Flags::TRAIT_IMPLEMENTATION | Flags::WITH_ALLOCATION_TRAIT;
+			}
+			if constexpr (check_method_ParticleArraysToPrimitives_v<trait const, accessor, primitive_output&>)
+				return Flags::TRAIT_IMPLEMENTATION;
+
+			return 0;
+		}
 	};
 
 
@@ -2,6 +2,8 @@
 
 	// all classes in this file
 #define CHAOS_TILEDMAP_CLASSES \
+(BinaryWriter) \
+(BinaryReader) \
 (BaseObject) \
 (Property) \
 (PropertyOwner) \
@@ -58,6 +60,7 @@ namespace chaos
 
 #endif // CHAOS_FORWARD_DECLARATION
 
+#include "Chaos/TiledMap/TiledMapBinary.h"
 #include "Chaos/TiledMap/TiledMapBaseObject.h"
 #include "Chaos/TiledMap/TiledMapPropertyOwner.h"
 #include "Chaos/TiledMap/TiledMapGeometricObject.h"
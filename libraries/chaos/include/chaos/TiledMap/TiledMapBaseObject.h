@@ -162,6 +162,54 @@ namespace chaos
 			/** utility function to load a layer */
 			bool DoLoadLayersImpl(tinyxml2::XMLElement const* element, std::vector<shared_ptr<LayerBase>>& result);
 
+			/** utility function to load objects from binary */
+			template<typename T, typename ...PARAMS>
+			static bool DoLoadBinaryObjectListHelper(BinaryReader& reader, std::vector<T>& result, PARAMS...params)
+			{
+				uint32_t count = 0;
+				if (!reader.ReadCount(count))
+					return false;
+				result.reserve(result.size() + count);
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					if constexpr (is_shared_ptr_v<T>)
+					{
+						using object_type = std::remove_reference_t<decltype(*result[0].get())>; // decltype returns a REFERENCE !!
+						shared_ptr<object_type> object = new object_type(std::forward<PARAMS>(params)...);
+						if (object == nullptr || !object->DoLoadBinary(reader))
+							return false;
+						result.push_back(std::move(object));
+					}
+					else
+					{
+						T object;
+						if (!object.DoLoadBinary(reader))
+							return false;
+						result.push_back(std::move(object));
+					}
+				}
+				return true;
+			}
+
+			/** utility function to save objects into binary */
+			template<typename T>
+			static void DoSaveBinaryObjectListHelper(BinaryWriter& writer, std::vector<T> const& objects)
+			{
+				writer.Write(uint32_t(objects.size()));
+				for (T const& object : objects)
+				{
+					if constexpr (is_shared_ptr_v<T>)
+						object->DoSaveBinary(writer);
+					else
+						object.DoSaveBinary(writer);
+				}
+			}
+
+			/** utility function to load layers from binary */
+			bool DoLoadBinaryLayersImpl(BinaryReader& reader, std::vector<shared_ptr<LayerBase>>& result);
+			/** utility function to save layers into binary */
+			void DoSaveBinaryLayersImpl(BinaryWriter& writer, std::vector<shared_ptr<LayerBase>> const& layers) const;
+
 		protected:
 
 			/** owning object */
@@ -0,0 +1,136 @@
+namespace chaos
+{
+	namespace TiledMap
+	{
+#if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+		// ==========================================
+		// Binary format
+		// ==========================================
+		//
+		// Maps, tilesets and object type sets can be saved into a binary form once loaded from XML (see Manager::SetCacheDirectory).
+		// The binary form contains the final values of the objects, so no parsing nor conversion is necessary on loading.
+		// Paths are stored relatively to the file of the ManagerObject, so that binary files can be produced offline.
+		//
+		//   'CTMB' | version | key of the XML content | object members ...
+		//
+
+		/** the magic number at the beginning of binary files */
+		inline char const BINARY_MAGIC[4] = { 'C', 'T', 'M', 'B' };
+		/** the version of the binary format (to be increased each time the layout of any object changes) */
+		inline uint32_t const BINARY_VERSION = 1;
+
+		// ==========================================
+		// BinaryWriter : used to write objects into a growing buffer
+		// ==========================================
+
+		class CHAOS_API BinaryWriter
+		{
+			CHAOS_TILEDMAP_ALL_FRIENDS
+
+		public:
+
+			/** constructor (paths are written relatively to the reference path) */
+			BinaryWriter(boost::filesystem::path const& in_reference_path);
+
+			/** write a POD value */
+			template<typename T> requires (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+			void Write(T value)
+			{
+				if constexpr (std::is_same_v<T, bool>)
+					Write(uint8_t(value ? 1 : 0));
+				else
+					WriteData(&value, sizeof(T));
+			}
+			/** write a vector */
+			template<glm::length_t L, typename T, glm::qualifier Q>
+			void Write(glm::vec<L, T, Q> const& value)
+			{
+				WriteData(&value, sizeof(value));
+			}
+			/** write a string */
+			void Write(std::string const& value);
+			/** write a path (relatively to the reference path whenever possible) */
+			void Write(boost::filesystem::path const& value);
+			/** write raw data */
+			void WriteData(void const* data, size_t size);
+
+			/** get the written data */
+			std::vector<char> const& GetData() const { return data; }
+			/** write the data into a file (through a temporary file so that concurrent writers never produce a partial file) */
+			bool SaveFile(boost::filesystem::path const& path) const;
+
+		protected:
+
+			/** the directory the paths are relative to */
+			boost::filesystem::path reference_directory;
+			/** the written data */
+			std::vector<char> data;
+		};
+
+		// ==========================================
+		// BinaryReader : used to read objects from a buffer
+		// ==========================================
+
+		// XXX : any failure is sticky. Once a read fails, all following reads fail too and return default values
+
+		class CHAOS_API BinaryReader : public BufferReader
+		{
+			CHAOS_TILEDMAP_ALL_FRIENDS
+
+		public:
+
+			/** constructor (relative paths are resolved against the reference path) */
+			BinaryReader(Buffer<char> const& in_buffer, boost::filesystem::path const& in_reference_path);
+
+			/** returns whether all reads have been successful */
+			bool IsValid() const { return !failed; }
+
+			/** read a POD value */
+			template<typename T> requires (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+			bool Read(T& value)
+			{
+				if constexpr (std::is_same_v<T, bool>)
+				{
+					uint8_t tmp = 0;
+					if (!Read(tmp) || tmp > 1)
+						return SetFailed();
+					value = (tmp != 0);
+					return true;
+				}
+				else
+					return ReadData(&value, sizeof(T));
+			}
+			/** read a vector */
+			template<glm::length_t L, typename T, glm::qualifier Q>
+			bool Read(glm::vec<L, T, Q>& value)
+			{
+				return ReadData(&value, sizeof(value));
+			}
+			/** read a string */
+			bool Read(std::string& value);
+			/** read a path */
+			bool Read(boost::filesystem::path& value);
+			/** read raw data */
+			bool ReadData(void* data, size_t size);
+			/** read a number of elements (fails whether there cannot be so many elements in the remaining data) */
+			bool ReadCount(uint32_t& count);
+
+		protected:
+
+			/** mark the reader as failed */
+			bool SetFailed();
+
+		protected:
+
+			/** the path relative paths are resolved against */
+			boost::filesystem::path reference_path;
+			/** whether a read failed */
+			bool failed = false;
+		};
+
+#endif
+
+	}; // namespace TiledMap
+
+}; // namespace chaos
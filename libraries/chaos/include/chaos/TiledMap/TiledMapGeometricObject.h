@@ -32,6 +32,10 @@ namespace chaos
 
 			/** override */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 			/** get the local bounding box */
 			virtual box2 DoGetBoundingBox() const;
@@ -90,6 +94,10 @@ namespace chaos
 			virtual box2 DoGetBoundingBox() const override;
 			/** loading method from XML */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -148,6 +156,10 @@ namespace chaos
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
 			/** override */
 			virtual box2 DoGetBoundingBox() const override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -174,6 +186,10 @@ namespace chaos
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
 			/** override */
 			virtual box2 DoGetBoundingBox() const override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -221,6 +237,10 @@ namespace chaos
 
 			/** loading method from XML */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -267,6 +287,10 @@ namespace chaos
 			virtual box2 DoGetBoundingBox() const override;
 			/** loading method from XML */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -33,6 +33,10 @@ namespace chaos
 
 			/** the loading method */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element);
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -68,6 +72,10 @@ namespace chaos
 
 			/** the loading method */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -106,6 +114,10 @@ namespace chaos
 			bool DoLoadObjects(tinyxml2::XMLElement const* element);
 			/** the loading method */
 			GeometricObject* DoLoadOneObject(tinyxml2::XMLElement const* element);
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -191,10 +203,14 @@ namespace chaos
 			bool DoLoadTileBuffer(tinyxml2::XMLElement const* element);
 			/** load all chunks of tiles */
 			bool DoLoadTileChunk(tinyxml2::XMLElement const* element, char const* encoding, char const* compression);
-			/** loading buffer method */
-			std::vector<Tile> DoLoadTileChunkFromBuffer(Buffer<char> const& buffer, glm::ivec2 const& chunk_size);
+			/** decode a base64 (and maybe compressed) text into tiles */
+			bool DoLoadTileChunkFromBase64(char const* text, char const* compression, size_t count, std::vector<Tile>& tiles);
 			/** add some flags to tiles */
 			virtual void ComputeTileFlags();
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -220,6 +236,10 @@ namespace chaos
 			using LayerBase::LayerBase;
 			/** the loading method */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
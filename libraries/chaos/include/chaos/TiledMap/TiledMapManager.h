@@ -14,6 +14,11 @@ namespace chaos
 
 		public:
 
+			/** the default max size of the cache directory */
+			static constexpr uintmax_t DEFAULT_CACHE_MAX_SIZE = 64 * 1024 * 1024;
+			/** the default max age (in seconds) of an unused entry in the cache directory */
+			static constexpr std::time_t DEFAULT_CACHE_MAX_AGE = 30 * 24 * 60 * 60;
+
 			/** constructor */
 			Manager() : BaseObject(nullptr) {}
 
@@ -51,6 +56,19 @@ namespace chaos
 			/** find the property in an ObjectTypeSet */
 			virtual Property const * FindObjectProperty(char const * type, char const * name, PropertyType type_id = PropertyType::ANY) const;
 
+			/** set the directory where the binary forms of the loaded XML files are stored (empty to disable the cache) */
+			void SetCacheDirectory(FilePathParam const & path);
+			/** get the cache directory */
+			boost::filesystem::path const & GetCacheDirectory() const { return cache_directory; }
+			/** change the max size of the cache directory (the least recently used entries are removed first) */
+			void SetCacheMaxSize(uintmax_t in_max_size);
+			/** get the max size of the cache directory */
+			uintmax_t GetCacheMaxSize() const { return cache_max_size; }
+			/** change the max age (in seconds) of an unused entry in the cache directory (0 for no limit) */
+			void SetCacheMaxAge(std::time_t in_max_age);
+			/** get the max age of an unused entry in the cache directory */
+			std::time_t GetCacheMaxAge() const { return cache_max_age; }
+
 			/** returns the number of map */
 			size_t GetMapCount() const { return maps.size();}
 			/** returns the number of tileset */
@@ -97,6 +115,19 @@ namespace chaos
 			/** internal method to load a object type set (with no search for exisiting items) */
 			ObjectTypeSet * DoLoadObjectTypeSet(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object);
 
+			/** compute the key of a XML content in the cache */
+			static uint64_t GetCacheKey(char const * type_name, Buffer<char> const & buffer);
+			/** get the path of the binary file for a key */
+			boost::filesystem::path GetCachePath(uint64_t key) const;
+			/** called whenever an entry of the cache has been used */
+			void OnCacheEntryLoaded(boost::filesystem::path const & cache_path);
+			/** called whenever an entry has been written into the cache */
+			void OnCacheEntrySaved(boost::filesystem::path const & cache_path);
+			/** remove the entries that are too old, then the least recently used ones until the cache fits its max size */
+			void TrimCache();
+			/** remove the embedded tilesets a failed loading has already registered (external tilesets are complete and stay in the manager) */
+			void RemoveTileSetsOwnedBy(BaseObject const * owner);
+
 		public:
 
 			/** the maps */
@@ -105,6 +136,17 @@ namespace chaos
 			std::vector<shared_ptr<TileSet>> tile_sets;
 			/** the assets */
 			std::vector<shared_ptr<ObjectTypeSet>> object_type_sets;
+
+		protected:
+
+			/** the directory where binary files are stored */
+			boost::filesystem::path cache_directory;
+			/** the max size of the cache directory */
+			uintmax_t cache_max_size = DEFAULT_CACHE_MAX_SIZE;
+			/** the max age of an unused entry in the cache directory */
+			std::time_t cache_max_age = DEFAULT_CACHE_MAX_AGE;
+			/** the size of the cache directory (as known since the last trim) */
+			uintmax_t cache_size = 0;
 		};
 
 #endif
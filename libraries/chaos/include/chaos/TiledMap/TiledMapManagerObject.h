@@ -33,6 +33,19 @@ namespace chaos
 			/** get the name of the expected markup */
 			virtual char const * GetXMLMarkupName() const { return nullptr; }
 
+			/** loading method from a binary file (fails whether the file does not correspond to the key) */
+			bool DoLoadBinaryFile(boost::filesystem::path const & binary_path, uint64_t key);
+			/** saving method into a binary file */
+			bool DoSaveBinaryFile(boost::filesystem::path const & binary_path, uint64_t key) const;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader & reader) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinaryMembers(BinaryReader & reader) { return true; }
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter & writer) const override;
+			/** saving method into binary */
+			virtual void DoSaveBinaryMembers(BinaryWriter & writer) const {}
+
 		public:
 
 			/** the filename */
@@ -126,6 +126,19 @@ namespace chaos
 			/** load all the layers */
 			bool DoLoadLayers(tinyxml2::XMLElement const* element);
 
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinaryMembers(BinaryReader& reader) override;
+			/** loading method from binary */
+			bool DoLoadBinaryTileSet(BinaryReader& reader);
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
+			/** saving method into binary */
+			virtual void DoSaveBinaryMembers(BinaryWriter& writer) const override;
+			/** saving method into binary */
+			void DoSaveBinaryTileSet(BinaryWriter& writer) const;
+
 		public:
 
 			/** find tileset data for a given gid */
@@ -27,6 +27,10 @@ namespace chaos
 			{
 				return element; // XXX: the properties are not contained by a 'properties' node
 			}
+			/** override */
+			virtual bool DoLoadBinary(BinaryReader & reader) override;
+			/** override */
+			virtual void DoSaveBinary(BinaryWriter & writer) const override;
 
 		public:
 
@@ -77,6 +81,11 @@ namespace chaos
 			/** load all types */
 			bool DoLoadObjectTypes(tinyxml2::XMLElement const * element);
 
+			/** override */
+			virtual bool DoLoadBinary(BinaryReader & reader) override;
+			/** override */
+			virtual void DoSaveBinary(BinaryWriter & writer) const override;
+
 		protected:
 
 			/** object set information */
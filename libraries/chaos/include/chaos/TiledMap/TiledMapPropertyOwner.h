@@ -181,6 +181,11 @@ namespace chaos
 			/** returns the container of properties */
 			virtual tinyxml2::XMLElement const * GetPropertiesChildNode(tinyxml2::XMLElement const * element) const;
 
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader);
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const;
+
 		protected:
 
 			/** the properties of the object */
@@ -208,6 +213,10 @@ namespace chaos
 			using PropertyOwner::PropertyOwner;
 			/** override */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** override */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** override */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
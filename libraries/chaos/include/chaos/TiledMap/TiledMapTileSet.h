@@ -23,6 +23,10 @@ namespace chaos
 
 			/** loading method from XML */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -44,6 +48,10 @@ namespace chaos
 
 			/** loading method from XML */
 			bool DoLoad(tinyxml2::XMLElement const* element); // XXX : not a virtual function, this is the simplest class possible
+			/** loading method from binary */
+			bool DoLoadBinary(BinaryReader& reader);
+			/** saving method into binary */
+			void DoSaveBinary(BinaryWriter& writer) const;
 
 		public:
 
@@ -89,6 +97,10 @@ namespace chaos
 
 			/** loading method from XML */
 			bool DoLoad(tinyxml2::XMLElement const* element); // XXX : not a virtual function, this is the simplest class possible
+			/** loading method from binary */
+			bool DoLoadBinary(BinaryReader& reader);
+			/** saving method into binary */
+			void DoSaveBinary(BinaryWriter& writer) const;
 
 		public:
 
@@ -118,6 +130,10 @@ namespace chaos
 
 			/** loading method from XML */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 		public:
 
@@ -148,6 +164,10 @@ namespace chaos
 
 			/** override */
 			virtual bool DoLoad(tinyxml2::XMLElement const* element) override;
+			/** override */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** override */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
 
 			/** initialize terrain indices from string */
 			bool ComputeTerrainIndices(char const* str);
@@ -210,6 +230,15 @@ namespace chaos
 			/** loading method from XML */
 			bool DoLoadWangsets(tinyxml2::XMLElement const* element);
 
+			/** loading method from binary */
+			virtual bool DoLoadBinary(BinaryReader& reader) override;
+			/** loading method from binary */
+			virtual bool DoLoadBinaryMembers(BinaryReader& reader) override;
+			/** saving method into binary */
+			virtual void DoSaveBinary(BinaryWriter& writer) const override;
+			/** saving method into binary */
+			virtual void DoSaveBinaryMembers(BinaryWriter& writer) const override;
+
 			/** get the name of the expected markup */
 			virtual char const* GetXMLMarkupName() const override { return "tileset"; }
 
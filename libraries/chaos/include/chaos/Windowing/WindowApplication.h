@@ -87,6 +87,15 @@ namespace chaos
 		/** used to force for one frame the duration of tick function to 0 : usefull for function that are long and would block the game for some time */
 		void FreezeNextFrameTickDuration();
 
+		/** gets the fixed time step of the simulation */
+		FixedTimeStep& GetFixedTimeStep() { return fixed_time_step; }
+		/** gets the fixed time step of the simulation */
+		FixedTimeStep const& GetFixedTimeStep() const { return fixed_time_step; }
+		/** gets the frame pacer */
+		FramePacer& GetFramePacer() { return frame_pacer; }
+		/** gets the frame pacer */
+		FramePacer const& GetFramePacer() const { return frame_pacer; }
+
 		/** reload all GPU resources */
 		virtual bool ReloadGPUResources();
 		/** override */
@@ -288,6 +297,8 @@ namespace chaos
 
 		/** the window list */
 		std::vector<shared_ptr<Window>> windows;
+		/** the index for searching windows */
+		NamedObjectIndex window_index;
 
 		/** forced time slice for tick */
 		float forced_tick_duration = 0.0f;
@@ -295,6 +306,15 @@ namespace chaos
 		float max_tick_duration = 0.0f;
 		/** whether the delta time is forced to 0 for one frame (usefull for long operations like screen capture or GPU resource reloading) */
 		bool forced_zero_tick_duration = false;
+		/** the fixed time step of the simulation (disabled by default) */
+		FixedTimeStep fixed_time_step;
+		/** the frame pacer (disabled by default) */
+		FramePacer frame_pacer;
+
+		/** whether the linked GPU programs are cached on disk (opt-in) */
+		bool gpu_program_cache = false;
+		/** the max size of the GPU program cache on disk (in bytes) */
+		uintmax_t gpu_program_cache_max_size = GPUProgramGenerator::DEFAULT_BINARY_CACHE_MAX_SIZE;
 
 		/** the imgui menu mode */
 		bool imgui_menu_mode = false;
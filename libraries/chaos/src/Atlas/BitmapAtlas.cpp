@@ -252,6 +252,49 @@ namespace chaos
 			return animation_info->GetFrameDuration();
 		}
 
+		// ========================================================================
+		// CharacterTable functions
+		// ========================================================================
+
+		CharacterTable::CharacterTable()
+		{
+			dense_entries.fill(-1);
+		}
+
+		void CharacterTable::Clear()
+		{
+			valid = false;
+			dense_entries.fill(-1);
+			sparse_entries.clear();
+		}
+
+		void CharacterTable::Insert(uint32_t charcode, size_t index)
+		{
+			if (charcode < DENSE_CHARACTER_COUNT)
+			{
+				if (dense_entries[charcode] < 0)
+					dense_entries[charcode] = int32_t(index);
+			}
+			else
+			{
+				sparse_entries.insert({ charcode, index }); // does not replace an existing entry
+			}
+		}
+
+		std::optional<size_t> CharacterTable::Find(uint32_t charcode) const
+		{
+			if (charcode < DENSE_CHARACTER_COUNT)
+			{
+				if (dense_entries[charcode] < 0)
+					return {};
+				return size_t(dense_entries[charcode]);
+			}
+			auto it = sparse_entries.find(charcode);
+			if (it == sparse_entries.end())
+				return {};
+			return it->second;
+		}
+
 		// ========================================================================
 		// FolderInfo functions
 		// ========================================================================
@@ -316,6 +359,7 @@ namespace chaos
 			// reset members
 			atlas_count = 0;
 			dimension = glm::ivec2(0, 0);
+			++version;
 			// destroy the root folder
 			AtlasBaseTemplate<Object, BitmapInfo, FontInfo, FolderInfo>::Clear();
 		}
@@ -850,6 +894,14 @@ namespace chaos
 			JSONTools::SetAttribute(json, "descender", src.descender);
 			JSONTools::SetAttribute(json, "face_height", src.face_height);
 			JSONTools::SetAttribute(json, "elements", src.elements);
+			if (src.kerning_pairs.size() > 0)
+			{
+				// kerning is stored as a [left, right, value] list
+				nlohmann::json kerning_json = nlohmann::json::array();
+				for (auto const& [key, value] : src.kerning_pairs)
+					kerning_json.push_back({ uint32_t(key >> 32), uint32_t(key & 0xFFFFFFFF), value });
+				JSONTools::SetAttribute(json, "kerning", kerning_json);
+			}
 			return true;
 		}
 
@@ -862,7 +914,21 @@ namespace chaos
 			JSONTools::GetAttribute(config, "ascender", dst.ascender);
 			JSONTools::GetAttribute(config, "descender", dst.descender);
 			JSONTools::GetAttribute(config, "face_height", dst.face_height);
+			dst.InvalidateCharacterTable();
 			JSONTools::GetAttribute(config, "elements", dst.elements);
+			dst.UpdateCharacterTable();
+
+			dst.kerning_pairs.clear();
+			JSONTools::ForEachSource(config, [&dst](nlohmann::json const* json)
+			{
+				nlohmann::json const* kerning_json = JSONTools::GetElementArrayNode(json, "kerning");
+				if (kerning_json == nullptr)
+					return false;
+				for (nlohmann::json const& entry : *kerning_json)
+					if (entry.is_array() && entry.size() == 3)
+						dst.SetKerning(entry[0].get<uint32_t>(), entry[1].get<uint32_t>(), entry[2].get<int>());
+				return true;
+			});
 			return true;
 		}
 
@@ -886,6 +952,7 @@ namespace chaos
 			JSONTools::GetAttribute(config, "bitmaps", dst.bitmaps);
 			JSONTools::GetAttribute(config, "fonts", dst.fonts);
 			JSONTools::GetAttribute(config, "folders", dst.folders);
+			dst.InvalidateIndexes();
 			return true;
 		}
 
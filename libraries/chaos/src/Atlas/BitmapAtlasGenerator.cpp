@@ -10,6 +10,15 @@ namespace chaos
 		// Utility functions
 		// ========================================================================
 
+		static EnumTools::EnumMetaData<AtlasPackingStrategy> const AtlasPackingStrategy_metadata =
+		{
+			{ AtlasPackingStrategy::CORNERS, "CORNERS" },
+			{ AtlasPackingStrategy::MAXRECTS_BSSF, "MAXRECTS_BSSF" },
+			{ AtlasPackingStrategy::SKYLINE, "SKYLINE" }
+		};
+
+		CHAOS_IMPLEMENT_ENUM_METHOD(AtlasPackingStrategy, &AtlasPackingStrategy_metadata, CHAOS_API);
+
 		bool DoLoadFromJSON(JSONReadConfiguration config, AtlasGeneratorParams& dst)
 		{
 			JSONTools::GetAttribute(config, "force_power_of_2", dst.force_power_of_2);
@@ -20,6 +29,7 @@ namespace chaos
 			JSONTools::GetAttribute(config, "atlas_max_width", dst.atlas_max_width);
 			JSONTools::GetAttribute(config, "atlas_max_height", dst.atlas_max_height);
 			JSONTools::GetAttribute(config, "atlas_padding", dst.atlas_padding);
+			JSONTools::GetAttribute(config, "packing_strategy", dst.packing_strategy);
 			JSONTools::GetAttribute(config, "background_color", dst.background_color);
 			JSONTools::GetAttribute(config, "merge_params", dst.merge_params);
 			return true;
@@ -37,6 +47,7 @@ namespace chaos
 			JSONTools::SetAttribute(json, "atlas_max_width", src.atlas_max_width);
 			JSONTools::SetAttribute(json, "atlas_max_height", src.atlas_max_height);
 			JSONTools::SetAttribute(json, "atlas_padding", src.atlas_padding);
+			JSONTools::SetAttribute(json, "packing_strategy", src.packing_strategy);
 			JSONTools::SetAttribute(json, "background_color", src.background_color);
 			JSONTools::SetAttribute(json, "merge_params", src.merge_params);
 			return true;
@@ -442,6 +453,8 @@ namespace chaos
 
 					font_info_output.elements.push_back(std::move(character_info_output));
 				}
+				font_info_output.UpdateCharacterTable();
+				font_info_output.kerning_pairs = font_info_input->kerning_pairs;
 				folder_info_output->fonts.push_back(std::move(font_info_output));
 			}
 			// once we are sure that Folder.Fonts vector does not resize anymore, we can store pointers
@@ -457,6 +470,8 @@ namespace chaos
 					result.push_back(font_info_input->elements[j].get());
 				}
 			}
+			// the search indexes must be rebuilt
+			folder_info_output->InvalidateIndexes();
 		}
 
 		bool AtlasGenerator::ComputeResult(AtlasInput const & in_input, Atlas & in_output, AtlasGeneratorParams const & in_params)
@@ -569,9 +584,14 @@ namespace chaos
 				return false;
 			});
 
+			// keep the position of the entries that did not change since previous atlas
+			std::vector<bool> already_inserted = InsertPreviousLayouts(entries);
+
 			for (size_t i = 0; i < count; ++i)
 			{
 				size_t entry_index = textures_indirection_table[i];
+				if (already_inserted[entry_index])
+					continue;
 
 				BitmapInfoInput const * input_entry = entries[entry_index];
 
@@ -606,8 +626,7 @@ namespace chaos
 				if (best_atlas_index == -1) // not enough size in any existing atlas. create a new one
 				{
 					AtlasDefinition def;
-
-					def.potential_bottomleft_corners.push_back(glm::ivec2(0, 0));
+					InitializeAtlasDefinition(def);
 
 					best_atlas_index = int(atlas_definitions.size());
 					best_position = glm::ivec2(0, 0);
@@ -622,6 +641,167 @@ namespace chaos
 			return true;
 		}
 
+		void AtlasGenerator::CollectPreviousLayouts(FolderInfo const * folder_info, FolderInfo const * previous_folder_info, std::unordered_map<BitmapLayout const*, BitmapLayout const*> & result) const
+		{
+			auto IsSameLayout = [](auto const& info, auto const& previous_info)
+			{
+				return
+					(strcmp(info.GetName(), previous_info.GetName()) == 0) &&
+					(info.GetTag() == previous_info.GetTag()) &&
+					(info.width == previous_info.width) &&
+					(info.height == previous_info.height);
+			};
+
+			// the bitmaps : named bitmaps are searched by name. The unnamed child frames of an animation are stored just after their parent
+			std::unordered_map<std::string, size_t> previous_bitmap_indices;
+
+			size_t previous_count = previous_folder_info->bitmaps.size();
+			for (size_t i = 0; i < previous_count; ++i)
+				if (char const* name = previous_folder_info->bitmaps[i].GetName(); name[0] != 0)
+					previous_bitmap_indices.emplace(name, i);
+
+			size_t previous_index = previous_count;
+			for (BitmapInfo const& info : folder_info->bitmaps)
+			{
+				if (char const* name = info.GetName(); name[0] != 0)
+				{
+					auto it = previous_bitmap_indices.find(name);
+					previous_index = (it != previous_bitmap_indices.end()) ? it->second : previous_count;
+				}
+				else if (previous_index < previous_count)
+				{
+					++previous_index;
+				}
+
+				if (previous_index < previous_count && IsSameLayout(info, previous_folder_info->bitmaps[previous_index]))
+					result[&info] = &previous_folder_info->bitmaps[previous_index];
+			}
+
+			// the fonts : characters are searched by tag
+			for (FontInfo const& font_info : folder_info->fonts)
+			{
+				for (FontInfo const& previous_font_info : previous_folder_info->fonts)
+				{
+					if (strcmp(font_info.GetName(), previous_font_info.GetName()) != 0)
+						continue;
+
+					std::unordered_map<TagType, CharacterInfo const*> previous_characters;
+					for (CharacterInfo const& previous_info : previous_font_info.elements)
+						previous_characters.emplace(previous_info.GetTag(), &previous_info);
+
+					for (CharacterInfo const& info : font_info.elements)
+					{
+						auto it = previous_characters.find(info.GetTag());
+						if (it != previous_characters.end() && IsSameLayout(info, *it->second))
+							result[&info] = it->second;
+					}
+					break;
+				}
+			}
+
+			// the sub folders
+			for (auto const& child_folder_info : folder_info->folders)
+			{
+				for (auto const& previous_child_folder_info : previous_folder_info->folders)
+				{
+					if (strcmp(child_folder_info->GetName(), previous_child_folder_info->GetName()) == 0)
+					{
+						CollectPreviousLayouts(child_folder_info.get(), previous_child_folder_info.get(), result);
+						break;
+					}
+				}
+			}
+		}
+
+		std::vector<bool> AtlasGenerator::InsertPreviousLayouts(BitmapInfoInputVector const & entries)
+		{
+			std::vector<bool> result(entries.size(), false);
+
+			// the skyline cannot handle insertion at arbitrary positions
+			if (params.previous_atlas == nullptr || params.packing_strategy == AtlasPackingStrategy::SKYLINE)
+				return result;
+
+			std::unordered_map<BitmapLayout const*, BitmapLayout const*> previous_layouts;
+			CollectPreviousLayouts(&output->root_folder, &params.previous_atlas->root_folder, previous_layouts);
+
+			// the index of the page in the new atlas for each page of the previous atlas
+			std::vector<size_t> page_indices;
+
+			for (size_t i = 0; i < entries.size(); ++i)
+			{
+				BitmapLayout * layout = GetBitmapLayout(entries[i]);
+				if (layout == nullptr)
+					continue;
+
+				auto it = previous_layouts.find(layout);
+				if (it == previous_layouts.end() || it->second->bitmap_index < 0)
+					continue;
+
+				// the rectangle for given bitmap including the padding
+				Rectangle r = AddPadding(GetRectangle(*it->second));
+
+				// previous pages are created only when something is kept in them (they are renumbered so that there is no empty page)
+				size_t previous_bitmap_index = size_t(it->second->bitmap_index);
+				if (previous_bitmap_index >= page_indices.size())
+					page_indices.resize(previous_bitmap_index + 1, std::numeric_limits<size_t>::max());
+
+				if (page_indices[previous_bitmap_index] == std::numeric_limits<size_t>::max())
+				{
+					AtlasDefinition def;
+					InitializeAtlasDefinition(def);
+					if (!CanInsertRectangle(r, def)) // the padding or the atlas size may have changed
+						continue;
+					page_indices[previous_bitmap_index] = atlas_definitions.size();
+					atlas_definitions.push_back(std::move(def));
+				}
+
+				// the padding or the atlas size may have changed
+				AtlasDefinition & atlas_def = atlas_definitions[page_indices[previous_bitmap_index]];
+				if (!CanInsertRectangle(r, atlas_def))
+					continue;
+
+				InsertBitmapLayoutInAtlas(*layout, atlas_def, glm::ivec2(r.x, r.y));
+				result[i] = true;
+			}
+			return result;
+		}
+
+		bool AtlasGenerator::CanInsertRectangle(Rectangle const & r, AtlasDefinition const & atlas_def) const
+		{
+			if (!r.IsFullyInside(GetAtlasRectangle()))
+				return false;
+
+			if (params.packing_strategy == AtlasPackingStrategy::MAXRECTS_BSSF)
+			{
+				// a free rectangle must contains the whole rectangle
+				for (Rectangle const& free_rectangle : atlas_def.free_rectangles)
+					if (r.IsFullyInside(free_rectangle))
+						return true;
+				return false;
+			}
+			if (params.packing_strategy == AtlasPackingStrategy::CORNERS)
+				return !HasIntersectingInfo(r, atlas_def.collision_rectangles);
+			return false;
+		}
+
+		void AtlasGenerator::InitializeAtlasDefinition(AtlasDefinition& atlas_def) const
+		{
+			if (params.packing_strategy == AtlasPackingStrategy::MAXRECTS_BSSF)
+			{
+				atlas_def.free_rectangles.push_back(GetAtlasRectangle());
+			}
+			else if (params.packing_strategy == AtlasPackingStrategy::SKYLINE)
+			{
+				SkylineSegment segment;
+				segment.width = params.atlas_width;
+				atlas_def.skyline.push_back(segment);
+			}
+			else
+			{
+				atlas_def.potential_bottomleft_corners.push_back(glm::ivec2(0, 0));
+			}
+		}
+
 		float AtlasGenerator::FindBestPositionInAtlas(BitmapInfoInputVector const & entries, BitmapInfoInput const & info, AtlasDefinition const & atlas_def, glm::ivec2 & position) const
 		{
 			// not enought surface remaining. Early exit
@@ -638,24 +818,108 @@ namespace chaos
 			r.width  = info.description.width + 2 * params.atlas_padding;
 			r.height = info.description.height + 2 * params.atlas_padding;
 
+			// the best position inside the page is searched by the strategy. Pages are used with a first-fit policy
+			bool found = false;
+			if (params.packing_strategy == AtlasPackingStrategy::MAXRECTS_BSSF)
+				found = FindPositionWithMaxRects(r, atlas_def, position);
+			else if (params.packing_strategy == AtlasPackingStrategy::SKYLINE)
+				found = FindPositionWithSkyline(r, atlas_def, position);
+			else
+				found = FindPositionWithCorners(r, atlas_def, position);
+
+			return (found) ? 0.0f : -1.0f; // perfect fit or not found on this page
+		}
+
+		bool AtlasGenerator::FindPositionWithCorners(Rectangle const & r, AtlasDefinition const & atlas_def, glm::ivec2 & position) const
+		{
+			Rectangle other = r;
 			for (glm::ivec2 const& p : atlas_def.potential_bottomleft_corners)
 			{
 				// position of the rectangle (padding included)
-				r.x = p.x;
-				r.y = p.y;
+				other.x = p.x;
+				other.y = p.y;
 				// check whether the rectangle fully fill into to atlas page
-				if (r.x + r.width >= params.atlas_width)
+				if (other.x + other.width >= params.atlas_width)
 					continue;
-				if (r.y + r.height >= params.atlas_height)
+				if (other.y + other.height >= params.atlas_height)
 					continue;
 				// check for other rectangles in the same page
-				if (!HasIntersectingInfo(r, atlas_def.collision_rectangles))
+				if (!HasIntersectingInfo(other, atlas_def.collision_rectangles))
 				{
 					position = p;
-					return 0.0f; // perfect fit
+					return true;
 				}
 			}
-			return -1.0f; // not found on this page
+			return false;
+		}
+
+		bool AtlasGenerator::FindPositionWithMaxRects(Rectangle const & r, AtlasDefinition const & atlas_def, glm::ivec2 & position) const
+		{
+			int best_short_side = std::numeric_limits<int>::max();
+			int best_long_side = std::numeric_limits<int>::max();
+
+			for (Rectangle const& free_rectangle : atlas_def.free_rectangles)
+			{
+				if (r.width > free_rectangle.width || r.height > free_rectangle.height)
+					continue;
+
+				int leftover_x = free_rectangle.width - r.width;
+				int leftover_y = free_rectangle.height - r.height;
+				int short_side = std::min(leftover_x, leftover_y);
+				int long_side = std::max(leftover_x, leftover_y);
+
+				if (short_side < best_short_side || (short_side == best_short_side && long_side < best_long_side))
+				{
+					best_short_side = short_side;
+					best_long_side = long_side;
+					position = glm::ivec2(free_rectangle.x, free_rectangle.y);
+					if (long_side == 0) // exact match
+						break;
+				}
+			}
+			return (best_short_side != std::numeric_limits<int>::max());
+		}
+
+		int AtlasGenerator::GetSkylineTop(AtlasDefinition const & atlas_def, size_t segment_index, int width) const
+		{
+			int x = atlas_def.skyline[segment_index].x;
+			if (x + width > params.atlas_width)
+				return -1;
+
+			int result = 0;
+			int remaining = width;
+			for (size_t i = segment_index; i < atlas_def.skyline.size() && remaining > 0; ++i)
+			{
+				SkylineSegment const& segment = atlas_def.skyline[i];
+				result = std::max(result, segment.y);
+				remaining -= segment.width;
+			}
+			return result;
+		}
+
+		bool AtlasGenerator::FindPositionWithSkyline(Rectangle const & r, AtlasDefinition const & atlas_def, glm::ivec2 & position) const
+		{
+			int best_bottom = std::numeric_limits<int>::max();
+			int best_width = std::numeric_limits<int>::max();
+
+			for (size_t i = 0; i < atlas_def.skyline.size(); ++i)
+			{
+				int top = GetSkylineTop(atlas_def, i, r.width);
+				if (top < 0)
+					break; // segments are sorted along X : next segments are out of the atlas too
+				int bottom = top + r.height;
+				if (bottom > params.atlas_height)
+					continue;
+				// prefer the lowest position, then the narrowest segment (less waste under the bitmap)
+				int segment_width = atlas_def.skyline[i].width;
+				if (bottom < best_bottom || (bottom == best_bottom && segment_width < best_width))
+				{
+					best_bottom = bottom;
+					best_width = segment_width;
+					position = glm::ivec2(atlas_def.skyline[i].x, top);
+				}
+			}
+			return (best_bottom != std::numeric_limits<int>::max());
 		}
 
 		void AtlasGenerator::InsertBitmapLayoutInAtlas(BitmapLayout & layout, AtlasDefinition & atlas_def, glm::ivec2 const & position)
@@ -674,43 +938,169 @@ namespace chaos
 			layout.topright_texcoord.x = MathTools::CastAndDiv<float>(layout.x + layout.width, params.atlas_width);
 			layout.topright_texcoord.y = 1.0f - MathTools::CastAndDiv<float>(layout.y, params.atlas_height);
 
+			// the rectangle including the padding
+			Rectangle r;
+			r.x = position.x;
+			r.y = position.y;
+			r.width = layout.width + 2 * params.atlas_padding;
+			r.height = layout.height + 2 * params.atlas_padding;
+
+			if (params.packing_strategy == AtlasPackingStrategy::MAXRECTS_BSSF)
+				InsertRectangleWithMaxRects(r, atlas_def);
+			else if (params.packing_strategy == AtlasPackingStrategy::SKYLINE)
+				InsertRectangleWithSkyline(r, atlas_def);
+			else
+				InsertRectangleWithCorners(r, atlas_def);
+
+			// compute sum of all surfaces used in this atlas page
+			atlas_def.surface_sum += (unsigned int)(r.width * r.height);
+		}
+
+		void AtlasGenerator::InsertRectangleWithCorners(Rectangle const & r, AtlasDefinition & atlas_def) const
+		{
+			glm::ivec2 position = glm::ivec2(r.x, r.y);
+
 			// erase the point from potential entries
 			auto it = std::find(atlas_def.potential_bottomleft_corners.begin(), atlas_def.potential_bottomleft_corners.end(), position);
 			if (it != atlas_def.potential_bottomleft_corners.end())
 				atlas_def.potential_bottomleft_corners.erase(it);
 
 			// insert 3 new corners as entries (bottom-right / top-left / top-right)
-			int width  = layout.width + 2 * params.atlas_padding;
-			int height = layout.height + 2 * params.atlas_padding;
-
-			atlas_def.potential_bottomleft_corners.emplace_back(position.x + width, position.y);
-			atlas_def.potential_bottomleft_corners.emplace_back(position.x, position.y + height);
-			atlas_def.potential_bottomleft_corners.emplace_back(position.x + width, position.y + height);
+			atlas_def.potential_bottomleft_corners.emplace_back(position.x + r.width, position.y);
+			atlas_def.potential_bottomleft_corners.emplace_back(position.x, position.y + r.height);
+			atlas_def.potential_bottomleft_corners.emplace_back(position.x + r.width, position.y + r.height);
 
 			// insert new rectangle to test for collision
-			Rectangle r;
-			r.x = position.x;
-			r.y = position.y;
-			r.width = width;
-			r.height = height;
 			atlas_def.collision_rectangles.push_back(r);
+		}
 
-			// compute sum of all surfaces used in this atlas page
-			atlas_def.surface_sum += (unsigned int)
-				((layout.width + 2 * params.atlas_padding) *
-				(layout.height + 2 * params.atlas_padding));
+		void AtlasGenerator::InsertRectangleWithMaxRects(Rectangle const & r, AtlasDefinition & atlas_def) const
+		{
+			std::vector<Rectangle> & free_rectangles = atlas_def.free_rectangles;
+
+			// split the free rectangles that intersect the new one into (at most) 4 maximal rectangles
+			std::vector<Rectangle> new_rectangles;
+
+			size_t kept_count = 0;
+			for (size_t i = 0; i < free_rectangles.size(); ++i)
+			{
+				Rectangle const free_rectangle = free_rectangles[i];
+				if (!free_rectangle.IsIntersecting(r))
+				{
+					free_rectangles[kept_count++] = free_rectangle;
+					continue;
+				}
+
+				if (r.x > free_rectangle.x) // left part
+					new_rectangles.push_back({ free_rectangle.x, free_rectangle.y, r.x - free_rectangle.x, free_rectangle.height });
+				if (r.x + r.width < free_rectangle.x + free_rectangle.width) // right part
+					new_rectangles.push_back({ r.x + r.width, free_rectangle.y, free_rectangle.x + free_rectangle.width - (r.x + r.width), free_rectangle.height });
+				if (r.y > free_rectangle.y) // top part
+					new_rectangles.push_back({ free_rectangle.x, free_rectangle.y, free_rectangle.width, r.y - free_rectangle.y });
+				if (r.y + r.height < free_rectangle.y + free_rectangle.height) // bottom part
+					new_rectangles.push_back({ free_rectangle.x, r.y + r.height, free_rectangle.width, free_rectangle.y + free_rectangle.height - (r.y + r.height) });
+			}
+			free_rectangles.resize(kept_count);
+
+			// remove the new rectangles that are included into another one
+			// (kept rectangles were not contained into each other, and cannot be contained into a part of a split rectangle)
+			std::vector<bool> removed(new_rectangles.size(), false);
+			for (size_t i = 0; i < new_rectangles.size(); ++i)
+			{
+				if (removed[i])
+					continue;
+				for (size_t j = i + 1; j < new_rectangles.size() && !removed[i]; ++j)
+				{
+					if (removed[j])
+						continue;
+					if (new_rectangles[i].IsFullyInside(new_rectangles[j]))
+						removed[i] = true;
+					else if (new_rectangles[j].IsFullyInside(new_rectangles[i]))
+						removed[j] = true;
+				}
+				for (size_t j = 0; j < kept_count && !removed[i]; ++j)
+					if (new_rectangles[i].IsFullyInside(free_rectangles[j]))
+						removed[i] = true;
+			}
+
+			for (size_t i = 0; i < new_rectangles.size(); ++i)
+				if (!removed[i])
+					free_rectangles.push_back(new_rectangles[i]);
+		}
+
+		void AtlasGenerator::InsertRectangleWithSkyline(Rectangle const & r, AtlasDefinition & atlas_def) const
+		{
+			std::vector<SkylineSegment> & skyline = atlas_def.skyline;
+
+			// the rectangle is always inserted at the beginning of a segment
+			auto it = std::find_if(skyline.begin(), skyline.end(), [&r](SkylineSegment const& segment)
+			{
+				return (segment.x == r.x);
+			});
+			assert(it != skyline.end());
+
+			SkylineSegment new_segment;
+			new_segment.x = r.x;
+			new_segment.y = r.y + r.height;
+			new_segment.width = r.width;
+
+			size_t index = size_t(it - skyline.begin());
+			skyline.insert(skyline.begin() + index, new_segment);
+
+			// shrink or remove the segments covered by the new one
+			int right = r.x + r.width;
+			while (index + 1 < skyline.size())
+			{
+				SkylineSegment & next = skyline[index + 1];
+				if (next.x >= right)
+					break;
+				int covered = right - next.x;
+				if (covered < next.width)
+				{
+					next.x += covered;
+					next.width -= covered;
+					break;
+				}
+				skyline.erase(skyline.begin() + index + 1);
+			}
+
+			// merge neighbour segments with the same height
+			size_t dst = 0;
+			for (size_t i = 1; i < skyline.size(); ++i)
+			{
+				if (skyline[dst].y == skyline[i].y)
+					skyline[dst].width += skyline[i].width;
+				else
+					skyline[++dst] = skyline[i];
+			}
+			skyline.resize(dst + 1);
 		}
 
-		bool AtlasGenerator::CreateAtlasFromDirectory(FilePathParam const & bitmaps_dir, FilePathParam const & path, bool recursive, AtlasGeneratorParams const & in_params)
+		bool AtlasGenerator::CreateAtlasFromDirectory(FilePathParam const & bitmaps_dir, FilePathParam const & path, bool recursive, AtlasGeneratorParams const & in_params, bool incremental)
 		{
+			AtlasGeneratorParams params = in_params;
+
 			// fill the atlas
 			AtlasInput input;
+			Atlas      previous_atlas;
+			// the bitmap requests are independent from each other : decode them on the job system workers
+			input.SetParallelLoading(true);
+			if (incremental)
+			{
+				// the decoded bitmaps are cached besides the atlas
+				boost::filesystem::path cache_directory = path.GetResolvedPath();
+				cache_directory.replace_extension("cache");
+				input.SetCacheDirectory(cache_directory);
+				// reuse the layout of the previous atlas
+				if (params.previous_atlas == nullptr && boost::filesystem::exists(path.GetResolvedPath()) && previous_atlas.LoadAtlas(path))
+					params.previous_atlas = &previous_atlas;
+			}
 			FolderInfoInput * folder_info = input.AddFolder("files", 0);
 			folder_info->AddBitmapFilesFromDirectory(bitmaps_dir, recursive);
 			// create the atlas files
 			Atlas          atlas;
 			AtlasGenerator generator;
-			if (generator.ComputeResult(input, atlas, in_params))
+			if (generator.ComputeResult(input, atlas, params))
 				return atlas.SaveAtlas(path);
 			return false;
 		}
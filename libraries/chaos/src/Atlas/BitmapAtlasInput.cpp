@@ -45,6 +45,163 @@ namespace chaos
 			return true;
 		}
 
+		// ========================================================================
+		// Bitmap cache functions
+		// ========================================================================
+
+		// A cache entry contains the images of a bitmap after decoding and processing. The key is a hash of
+		// the source files and of the manifest, so that any change in one of them produces a new entry.
+		//
+		//   'CBMP' | version | header size | JSON header (animation + pages description) | pixels of each page (line by line)
+
+		static char const BITMAP_CACHE_MAGIC[4] = { 'C', 'B', 'M', 'P' };
+
+		static uint32_t const BITMAP_CACHE_VERSION = 1;
+
+		static uint64_t const CONTENT_HASH_SEED = 14695981039346656037ULL;
+
+		static uint64_t UpdateContentHash(uint64_t hash, void const* data, size_t size)
+		{
+			// FNV-1a
+			unsigned char const* bytes = (unsigned char const*)data;
+			for (size_t i = 0; i < size; ++i)
+			{
+				hash ^= uint64_t(bytes[i]);
+				hash *= 1099511628211ULL;
+			}
+			return hash;
+		}
+
+		static boost::filesystem::path GetBitmapCachePath(boost::filesystem::path const& cache_directory, uint64_t hash)
+		{
+			return cache_directory / StringTools::Printf("%016llx.bin", (unsigned long long)hash);
+		}
+
+		static bool LoadBitmapCache(boost::filesystem::path const& cache_path, std::vector<FIBITMAP*>& images, ImageAnimationDescription& animation_description)
+		{
+			Buffer<char> buffer = FileTools::LoadFile(cache_path, LoadFileFlag::NO_ERROR_TRACE);
+			if (buffer == nullptr)
+				return false;
+
+			// read and check the header
+			size_t fixed_size = sizeof(BITMAP_CACHE_MAGIC) + 2 * sizeof(uint32_t);
+			if (buffer.bufsize < fixed_size || memcmp(buffer.data, BITMAP_CACHE_MAGIC, sizeof(BITMAP_CACHE_MAGIC)) != 0)
+				return false;
+
+			uint32_t version = 0;
+			uint32_t header_size = 0;
+			memcpy(&version, buffer.data + sizeof(BITMAP_CACHE_MAGIC), sizeof(uint32_t));
+			memcpy(&header_size, buffer.data + sizeof(BITMAP_CACHE_MAGIC) + sizeof(uint32_t), sizeof(uint32_t));
+			if (version != BITMAP_CACHE_VERSION || buffer.bufsize < fixed_size + header_size)
+				return false;
+
+			nlohmann::json header;
+			if (!JSONTools::Parse(std::string(buffer.data + fixed_size, header_size).c_str(), header))
+				return false;
+
+			ImageAnimationDescription cached_animation_description;
+			JSONTools::GetAttribute(&header, "animation_description", cached_animation_description);
+
+			nlohmann::json const* pages = JSONTools::GetAttributeNode(&header, "pages");
+			if (pages == nullptr || !pages->is_array() || pages->size() == 0)
+				return false;
+
+			// read the pixels
+			std::vector<FIBITMAP*> result;
+
+			size_t position = fixed_size + header_size;
+			for (nlohmann::json const& page : *pages)
+			{
+				int width = 0;
+				int height = 0;
+				PixelFormat pixel_format;
+				JSONTools::GetAttribute(&page, "width", width);
+				JSONTools::GetAttribute(&page, "height", height);
+				JSONTools::GetAttribute(&page, "pixel_format", pixel_format);
+
+				FIBITMAP* image = (width > 0 && height > 0 && pixel_format.IsValid()) ? ImageTools::GenFreeImage(pixel_format, width, height) : nullptr;
+				if (image == nullptr)
+				{
+					ReleaseAllImages(&result);
+					return false;
+				}
+				result.push_back(image);
+
+				ImageDescription image_description = ImageTools::GetImageDescription(image);
+				if (position + size_t(image_description.line_size) * size_t(height) > buffer.bufsize)
+				{
+					ReleaseAllImages(&result);
+					return false;
+				}
+				for (int y = 0; y < height; ++y)
+				{
+					memcpy((char*)image_description.data + y * image_description.pitch_size, buffer.data + position, image_description.line_size);
+					position += image_description.line_size;
+				}
+			}
+			images = std::move(result);
+			animation_description = cached_animation_description;
+			return true;
+		}
+
+		static bool SaveBitmapCache(boost::filesystem::path const& cache_path, std::vector<FIBITMAP*> const& images, ImageAnimationDescription const& animation_description)
+		{
+			// describe the content
+			nlohmann::json header = nlohmann::json::object();
+			JSONTools::SetAttribute(&header, "animation_description", animation_description);
+
+			nlohmann::json pages = nlohmann::json::array();
+
+			std::vector<ImageDescription> image_descriptions;
+			for (FIBITMAP* image : images)
+			{
+				ImageDescription image_description = ImageTools::GetImageDescription(image);
+				if (!image_description.IsValid(false))
+					return false;
+				image_descriptions.push_back(image_description);
+
+				nlohmann::json page = nlohmann::json::object();
+				JSONTools::SetAttribute(&page, "width", image_description.width);
+				JSONTools::SetAttribute(&page, "height", image_description.height);
+				JSONTools::SetAttribute(&page, "pixel_format", image_description.pixel_format);
+				pages.push_back(std::move(page));
+			}
+			header["pages"] = std::move(pages);
+
+			std::string header_string = header.dump();
+			uint32_t header_size = uint32_t(header_string.size());
+
+			// several requests may have the same content (and so the same entry) : write into a temporary file first
+			boost::filesystem::path tmp_path = cache_path;
+			tmp_path += StringTools::Printf(".%llx.tmp", (unsigned long long)std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+			bool success = false;
+			{
+				std::ofstream stream(tmp_path.string().c_str(), std::ios::binary);
+				if (stream)
+				{
+					stream.write(BITMAP_CACHE_MAGIC, sizeof(BITMAP_CACHE_MAGIC));
+					stream.write((char const*)&BITMAP_CACHE_VERSION, sizeof(uint32_t));
+					stream.write((char const*)&header_size, sizeof(uint32_t));
+					stream.write(header_string.c_str(), header_size);
+					for (ImageDescription const& image_description : image_descriptions)
+						for (int y = 0; y < image_description.height; ++y)
+							stream.write((char const*)image_description.data + y * image_description.pitch_size, image_description.line_size);
+					success = !stream.fail();
+				}
+			}
+
+			boost::system::error_code error_code;
+			if (success)
+			{
+				boost::filesystem::rename(tmp_path, cache_path, error_code);
+				success = !error_code;
+			}
+			if (!success)
+				boost::filesystem::remove(tmp_path, error_code);
+			return success;
+		}
+
 		// ========================================================================
 		// FontInfoInputParams functions
 		// ========================================================================
@@ -193,6 +350,7 @@ namespace chaos
 					result->name = name;
 					result->tag = tag;
 					folders.push_back(std::move(std::unique_ptr<FolderInfoInput>(result)));
+					folder_index.Invalidate();
 				}
 			}
 			return result;
@@ -354,6 +512,10 @@ namespace chaos
 
 			std::map<uint32_t, FontTools::CharacterBitmapGlyph> glyph_cache = FontTools::GetGlyphCacheForString(face, characters);
 
+			// get the kerning between the characters of the font
+			for (FontTools::KerningPair const& kerning_pair : FontTools::GetKerningPairs(face, glyph_cache))
+				result->SetKerning(kerning_pair.left_charcode, kerning_pair.right_charcode, kerning_pair.x);
+
 			// transforms each info of the glyph map into a bitmap
 			for (auto & glyph : glyph_cache)
 			{
@@ -403,7 +565,9 @@ namespace chaos
 			for (auto & glyph : glyph_cache)
 				FT_Done_Glyph((FT_Glyph)glyph.second.bitmap_glyph);
 
+			result->UpdateCharacterTable();
 			fonts.push_back(std::move(std::unique_ptr<FontInfoInput>(result)));
+			font_index.Invalidate();
 
 			return result;
 		}
@@ -412,39 +576,6 @@ namespace chaos
 			// BITMAP
 			// ============================
 
-		bool FolderInfoInput::AddBitmapFilesFromDirectory(FilePathParam const & path, bool recursive)
-		{
-            AddFilesToFolderData add_data(path);
-            add_data.SearchEntriesInDirectory();
-
-			// step 1 : the files
-			for (boost::filesystem::path const & p : add_data.files)
-			{
-				// skip already handled path
-				if (std::find(add_data.ignore_files.begin(), add_data.ignore_files.end(), p) != add_data.ignore_files.end())
-					continue;
-				// add bitmap
-				AddBitmapFileImpl(p, nullptr, 0, add_data);
-			}
-
-			// step 2 : the directories
-			if (recursive)
-			{
-				for (boost::filesystem::path const& p : add_data.directories)
-				{
-					// skip already handled path
-					if (std::find(add_data.ignore_directories.begin(), add_data.ignore_directories.end(), p) != add_data.ignore_directories.end())
-						continue;
-					// recurse
-					FolderInfoInput* child_folder = AddFolder(PathTools::PathToName(p).c_str(), 0);
-					if (child_folder == nullptr)
-						continue;
-					child_folder->AddBitmapFilesFromDirectory(p, recursive);
-				}
-			}
-			return true;
-		}
-
         static std::vector<FIBITMAP*> LoadManifestImagesFromDirectory(boost::filesystem::path const& directory_path)
         {
             std::vector<FIBITMAP*> child_images;
@@ -489,7 +620,175 @@ namespace chaos
            return child_images;
         }
 
+        static bool LoadBitmapFileRequest(BitmapFileLoadRequest& request, boost::filesystem::path const& cache_directory)
+        {
+            // XXX : this function may be called from any thread. It must only work on the request
+
+			// search the content of the request
+			BitmapInfoInputManifest input_manifest;
+			if (!request.json_manifest.is_null())
+				LoadFromJSON(&request.json_manifest, input_manifest);
+
+			// compute the key of the request in the cache (source files and manifest)
+			uint64_t hash = CONTENT_HASH_SEED;
+			Buffer<char> buffer;
+
+			bool use_cache = !cache_directory.empty();
+			if (use_cache)
+			{
+				hash = UpdateContentHash(hash, &BITMAP_CACHE_VERSION, sizeof(BITMAP_CACHE_VERSION));
+				if (request.images_directory.empty())
+				{
+					buffer = FileTools::LoadFile(request.path, LoadFileFlag::NO_ERROR_TRACE);
+					if (buffer == nullptr)
+						use_cache = false;
+					else
+						hash = UpdateContentHash(hash, buffer.data, buffer.bufsize);
+				}
+				else
+				{
+					std::vector<boost::filesystem::path> child_paths;
+					FileTools::WithDirectoryContent(request.images_directory, [&child_paths](boost::filesystem::path const& p)
+					{
+						if (boost::filesystem::status(p).type() == boost::filesystem::file_type::regular_file)
+							child_paths.push_back(p);
+						return false; // don't stop
+					});
+					std::sort(child_paths.begin(), child_paths.end());
+
+					for (boost::filesystem::path const& p : child_paths)
+					{
+						std::string filename = p.filename().string();
+						hash = UpdateContentHash(hash, filename.c_str(), filename.length());
+						Buffer<char> child_buffer = FileTools::LoadFile(p, LoadFileFlag::NO_ERROR_TRACE);
+						if (child_buffer != nullptr)
+							hash = UpdateContentHash(hash, child_buffer.data, child_buffer.bufsize);
+					}
+				}
+				std::string manifest_string = request.json_manifest.dump();
+				hash = UpdateContentHash(hash, manifest_string.c_str(), manifest_string.length());
+
+				// the entry is in the cache : no decoding, no processing
+				boost::filesystem::path cache_path = GetBitmapCachePath(cache_directory, hash);
+				if (use_cache && LoadBitmapCache(cache_path, request.images, request.animation_description))
+				{
+					boost::system::error_code error_code;
+					boost::filesystem::last_write_time(cache_path, std::time(nullptr), error_code); // the entry is recently used (see TrimCache)
+					return true;
+				}
+			}
+
+			// load all pages for the bitmap
+			if (!request.images_directory.empty())
+				request.images = LoadManifestImagesFromDirectory(request.images_directory); // read in that directory all images and considere these as an animation (if several)
+			else if (buffer != nullptr)
+				request.images = ImageTools::LoadMultipleImagesFromBuffer(buffer, &request.animation_description); // extract frame_rate from META DATA
+			else
+				request.images = ImageTools::LoadMultipleImagesFromFile(request.path, &request.animation_description); // extract frame_rate from META DATA
+
+			// no image ?
+			size_t count = request.images.size();
+			if (count == 0)
+				return false;
+
+			ImageAnimationDescription & animation_description = request.animation_description;
+
+			// prefere JSON settings to name encoded values or GIF meta data for frame rate
+			if (input_manifest.anim_duration > 0.0f)
+			{
+				animation_description.frame_duration = -1; // XXX : erase data that can be found in the META data of the image, because this would lead to the 'anim_duration' being ignored at run time
+				animation_description.anim_duration = input_manifest.anim_duration;
+			}
+            if (input_manifest.frame_duration > 0.0f)
+                animation_description.frame_duration = input_manifest.frame_duration;
+
+            if (input_manifest.grid_data.GetFrameCount() > 0)
+                animation_description.grid_data = input_manifest.grid_data;
+
+			animation_description.default_wrap_mode = input_manifest.default_wrap_mode; // default_wrap_mode is nor encoded into file nor in metadata
+
+			// not clear what to do (we have both a grid and a per frame animation). Abord
+			if (count > 1 && input_manifest.grid_data.GetFrameCount() > 1)
+			{
+				request.error_message = StringTools::Printf("AddBitmapFileRequest[%s] : cannot have multiple images and GRID structure in the same time", request.path.string().c_str());
+				ReleaseAllImages(&request.images);
+				return false;
+			}
+
+			// apply filters on image => the number of images must be the same or error
+			if (!ApplyProcessors(request.images, input_manifest.image_processors, animation_description.grid_data))
+				return false;
+
+			// store the result for next time
+			if (use_cache)
+				SaveBitmapCache(GetBitmapCachePath(cache_directory, hash), request.images, animation_description);
+
+			return true;
+		}
+
+		bool FolderInfoInput::AddBitmapFilesFromDirectory(FilePathParam const & path, bool recursive)
+		{
+			// step 1 : search all files to load (this creates the folders)
+			std::vector<BitmapFileLoadRequest> requests;
+			PrepareBitmapFilesFromDirectory(path, recursive, requests);
+
+			// step 2 : decode and process the images (the expensive part)
+			if (atlas_input != nullptr)
+				atlas_input->LoadBitmapFileRequests(requests);
+			else
+				for (BitmapFileLoadRequest& request : requests)
+					LoadBitmapFileRequest(request, boost::filesystem::path());
+
+			// step 3 : insert the bitmaps in their folder (in the order of the requests)
+			for (BitmapFileLoadRequest& request : requests)
+				request.folder->AddBitmapFileRequest(request);
+			return true;
+		}
+
+		void FolderInfoInput::PrepareBitmapFilesFromDirectory(FilePathParam const & path, bool recursive, std::vector<BitmapFileLoadRequest> & requests)
+		{
+            AddFilesToFolderData add_data(path);
+            add_data.SearchEntriesInDirectory();
+
+			// step 1 : the files
+			for (boost::filesystem::path const & p : add_data.files)
+			{
+				// skip already handled path
+				if (std::find(add_data.ignore_files.begin(), add_data.ignore_files.end(), p) != add_data.ignore_files.end())
+					continue;
+				// prepare bitmap
+				BitmapFileLoadRequest request;
+				if (PrepareBitmapFileRequest(p, nullptr, 0, add_data, request))
+					requests.push_back(std::move(request));
+			}
+
+			// step 2 : the directories
+			if (recursive)
+			{
+				for (boost::filesystem::path const& p : add_data.directories)
+				{
+					// skip already handled path
+					if (std::find(add_data.ignore_directories.begin(), add_data.ignore_directories.end(), p) != add_data.ignore_directories.end())
+						continue;
+					// recurse
+					FolderInfoInput* child_folder = AddFolder(PathTools::PathToName(p).c_str(), 0);
+					if (child_folder == nullptr)
+						continue;
+					child_folder->PrepareBitmapFilesFromDirectory(p, recursive, requests);
+				}
+			}
+		}
+
         BitmapInfoInput* FolderInfoInput::AddBitmapFileImpl(FilePathParam const& path, char const* name, TagType tag, AddFilesToFolderData& add_data)
+        {
+			BitmapFileLoadRequest request;
+			if (!PrepareBitmapFileRequest(path, name, tag, add_data, request))
+				return nullptr;
+			LoadBitmapFileRequest(request, (atlas_input != nullptr) ? atlas_input->GetCacheDirectory() : boost::filesystem::path());
+			return AddBitmapFileRequest(request);
+		}
+
+        bool FolderInfoInput::PrepareBitmapFileRequest(FilePathParam const& path, char const* name, TagType tag, AddFilesToFolderData& add_data, BitmapFileLoadRequest& request)
         {
             // compute a name from the path if necessary
             boost::filesystem::path const& resolved_path = path.GetResolvedPath();
@@ -498,11 +797,10 @@ namespace chaos
             if (FileTools::IsTypedFile(path, "json"))
             {
                 // load the manifest
-                nlohmann::json json_manifest;
-				if (!JSONTools::LoadJSONFile(path, json_manifest))
+				if (!JSONTools::LoadJSONFile(path, request.json_manifest))
 				{
-					Log::Error("FolderInfoInput::AddBitmapFileImpl => failed to load json file [%s]", resolved_path.string().c_str());
-					return nullptr;
+					Log::Error("FolderInfoInput::PrepareBitmapFileRequest => failed to load json file [%s]", resolved_path.string().c_str());
+					return false;
 				}
 
                 // search whether a related file/directory exists
@@ -515,9 +813,8 @@ namespace chaos
                 {
                     add_data.ignore_directories.push_back(noext_path);
 
-                    std::vector<FIBITMAP*> child_images = LoadManifestImagesFromDirectory(noext_path); // read in that directory all images and considere these as an animation (if several)
-                    if (child_images.size() > 0)
-                        return AddBitmapFileWithManifestImpl(path, name, tag, &json_manifest, &child_images);
+					request.path = resolved_path;
+					request.images_directory = noext_path;
                 }
                 // search whether there is a corresponding file for the manifest
                 else
@@ -531,108 +828,73 @@ namespace chaos
                         if (other_path == noext_path) // other file has same name (without extension)
                         {
                             add_data.ignore_files.push_back(p);
-                            return AddBitmapFileWithManifestImpl(p, name, tag, &json_manifest, nullptr);
+							request.path = p;
+							break;
                         }
                     }
+					if (request.path.empty())
+						return false;
                 }
-                return nullptr;
             }
             // normal file
             else
             {
                 // search whether a manifest for the file exists
-                nlohmann::json json_manifest;
-
                 boost::filesystem::path json_path = resolved_path;
                 json_path.replace_extension("json");
-                JSONTools::LoadJSONFile(json_path, json_manifest, LoadFileFlag::NO_ERROR_TRACE);
+                JSONTools::LoadJSONFile(json_path, request.json_manifest, LoadFileFlag::NO_ERROR_TRACE);
+				if (request.json_manifest.empty())
+					request.json_manifest = nlohmann::json();
 
                 // do not individually load the manifest in recursive calls
                 add_data.ignore_files.push_back(json_path);
 
-                return AddBitmapFileWithManifestImpl(path, name, tag, json_manifest.empty() ? nullptr : &json_manifest, nullptr);
+				request.path = resolved_path;
             }
-        }
-
-        BitmapInfoInput* FolderInfoInput::AddBitmapFileWithManifestImpl(FilePathParam const& path, char const* name, TagType tag, nlohmann::json const * json_manifest, std::vector<FIBITMAP*>* images)
-        {
-			// compute a name from the path if necessary
-			boost::filesystem::path const & resolved_path = path.GetResolvedPath();
 
 			// test whether there is a grid describing the animation ... even if the grid_info is discarded due to manifest, we want to compute the final name with truncated suffixes
 			std::string animated_name;
-
-			ImageAnimationDescription animation_description;
-			BitmapGridAnimationInfo::ParseFromName(resolved_path.string().c_str(), animation_description.grid_data, &animated_name);
+			BitmapGridAnimationInfo::ParseFromName(request.path.string().c_str(), request.animation_description.grid_data, &animated_name);
 
 			// search the name if not provided
-			std::string generated_name;
-			if (name == nullptr)
-			{
-				if (!animated_name.empty())
-					generated_name = PathTools::PathToName(animated_name);
-				else
-					generated_name = PathTools::PathToName(resolved_path);
-				name = generated_name.c_str();
-			}
+			if (name != nullptr)
+				request.name = name;
+			else if (!animated_name.empty())
+				request.name = PathTools::PathToName(animated_name);
+			else
+				request.name = PathTools::PathToName(request.path);
 
-            // test whether the object already exists
-			if (GetBitmapInfo(name) != nullptr)
-			{
-				ReleaseAllImages(images);
-				return nullptr;
-			}
+			// test whether the object already exists (no need to load it)
+			if (GetBitmapInfo(request.name.c_str()) != nullptr)
+				return false;
 
-            // search if there is a JSON file to describe an animation
-            BitmapInfoInputManifest input_manifest;
-            if (json_manifest != nullptr)
-                LoadFromJSON(json_manifest, input_manifest);
+			request.folder = this;
+			request.tag = tag;
+			return true;
+		}
 
-			// load all pages for the bitmap
-            std::vector<FIBITMAP*> pages;
-            if (images == nullptr)
-            {
-                pages = ImageTools::LoadMultipleImagesFromFile(path, &animation_description); // extract frame_rate from META DATA
-                images = &pages;
-            }
+		BitmapInfoInput* FolderInfoInput::AddBitmapFileRequest(BitmapFileLoadRequest& request)
+		{
+			if (!request.error_message.empty())
+				Log::Error(request.error_message.c_str());
 
 			// no image ?
-			size_t count = images->size();
-			if (count == 0)
+			if (request.images.size() == 0)
 				return nullptr;
 
-			// prefere JSON settings to name encoded values or GIF meta data for frame rate
-			if (input_manifest.anim_duration > 0.0f)
-			{
-				animation_description.frame_duration = -1; // XXX : erase data that can be found in the META data of the image, because this would lead to the 'anim_duration' being ignored at run time
-				animation_description.anim_duration = input_manifest.anim_duration;
-			}
-            if (input_manifest.frame_duration > 0.0f)
-                animation_description.frame_duration = input_manifest.frame_duration;
-
-            if (input_manifest.grid_data.GetFrameCount() > 0)
-                animation_description.grid_data = input_manifest.grid_data;
-
-			animation_description.default_wrap_mode = input_manifest.default_wrap_mode; // default_wrap_mode is nor encoded into file nor in metadata
-
-			// not clear what to do (we have both a grid and a per frame animation). Abord
-			if (count > 1 && input_manifest.grid_data.GetFrameCount() > 1)
+			// test whether the object already exists (another request of the same name may have been inserted before)
+			if (GetBitmapInfo(request.name.c_str()) != nullptr)
 			{
-				Log::Error("AddBitmapFileWithManifestImpl[%s] : cannot have multiple images and GRID structure in the same time", resolved_path.string().c_str());
-				ReleaseAllImages(images);
+				ReleaseAllImages(&request.images);
 				return nullptr;
 			}
 
-			// apply filters on image => the number of images must be the same or error
-			if (!ApplyProcessors(*images, input_manifest.image_processors, animation_description.grid_data))
-				return nullptr;
-
             // register resources for destructions
-			for (size_t i = 0; i < count; ++i)
-				RegisterResource(images->operator[](i), true);
+			for (FIBITMAP* image : request.images)
+				RegisterResource(image, true);
 
 			// create the bitmap
-			return AddBitmapImpl(*images, name, tag, &animation_description); // in case of failure, the images have already been registered for destruction
+			return AddBitmapImpl(request.images, request.name.c_str(), request.tag, &request.animation_description); // in case of failure, the images have already been registered for destruction
 		}
 
 		BitmapInfoInput* FolderInfoInput::AddBitmap(FilePathParam const& path, char const* name, TagType tag)
@@ -694,6 +956,7 @@ namespace chaos
 
 			// insert result into the folder
 			bitmaps.push_back(std::move(std::unique_ptr<BitmapInfoInput>(result))); // move for std::string copy
+			bitmap_index.Invalidate();
 			result = bitmaps.back().get();
 
 			// insert child animation frames
@@ -720,6 +983,7 @@ namespace chaos
 							child_frame->atlas_input = atlas_input;
 							child_frame->description = ImageTools::GetImageDescription(pages[i]);
 							bitmaps.push_back(std::move(std::unique_ptr<BitmapInfoInput>(child_frame)));
+							bitmap_index.Invalidate();
 							// insert the child frame inside the animation block
 							animation_info->child_frames.push_back(child_frame);
 						}
@@ -747,6 +1011,97 @@ namespace chaos
 			super::Clear();
 		}
 
+		void AtlasInput::SetCacheDirectory(FilePathParam const& path)
+		{
+			cache_directory = path.GetResolvedPath();
+			if (!cache_directory.empty())
+			{
+				boost::system::error_code error_code;
+				boost::filesystem::create_directories(cache_directory, error_code);
+				if (error_code)
+				{
+					Log::Error("AtlasInput::SetCacheDirectory => failed to create directory [%s]", cache_directory.string().c_str());
+					cache_directory.clear();
+				}
+			}
+		}
+
+		void AtlasInput::LoadBitmapFileRequests(std::vector<BitmapFileLoadRequest>& requests) const
+		{
+			size_t count = requests.size();
+
+			JobSystem* job_system = Application::GetJobSystemInstance();
+			if (parallel_loading && job_system != nullptr && job_system->GetWorkerCount() > 0 && count > 1)
+			{
+				// requests are independent from each other
+				job_system->ParallelFor(count, 1, [this, &requests](size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+						LoadBitmapFileRequest(requests[i], cache_directory);
+				});
+			}
+			else
+			{
+				for (BitmapFileLoadRequest& request : requests)
+					LoadBitmapFileRequest(request, cache_directory);
+			}
+			// new entries may have been added
+			if (!cache_directory.empty())
+				TrimCache();
+		}
+
+		void AtlasInput::TrimCache() const
+		{
+			class CacheEntry
+			{
+			public:
+
+				boost::filesystem::path path;
+				uintmax_t size = 0;
+				std::time_t time = 0;
+			};
+
+			// collect the entries
+			std::vector<CacheEntry> entries;
+			uintmax_t cache_size = 0;
+
+			boost::system::error_code error_code;
+			for (boost::filesystem::directory_iterator it(cache_directory, error_code), end; !error_code && it != end; it.increment(error_code))
+			{
+				boost::filesystem::path const& entry_path = it->path();
+				if (entry_path.extension() != ".bin")
+					continue;
+
+				CacheEntry entry;
+				entry.path = entry_path;
+				entry.size = boost::filesystem::file_size(entry_path, error_code);
+				entry.time = boost::filesystem::last_write_time(entry_path, error_code);
+				if (error_code)
+				{
+					error_code.clear();
+					continue;
+				}
+				cache_size += entry.size;
+				entries.push_back(std::move(entry));
+			}
+			if (cache_size <= cache_max_size)
+				return;
+
+			// remove the least recently used entries (used entries are touched when loaded)
+			std::sort(entries.begin(), entries.end(), [](CacheEntry const& src1, CacheEntry const& src2)
+			{
+				return (src1.time < src2.time);
+			});
+			for (CacheEntry const& entry : entries)
+			{
+				if (cache_size <= cache_max_size)
+					break;
+				if (boost::filesystem::remove(entry.path, error_code))
+					cache_size -= entry.size;
+				error_code.clear();
+			}
+		}
+
 		void AtlasInput::RegisterResource(FIBITMAP * bitmap, bool release)
 		{
 			if (bitmap == nullptr || !release)
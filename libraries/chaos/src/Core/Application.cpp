@@ -105,6 +105,13 @@ namespace chaos
 			return false;
 		}
 
+		// configure the logger
+		if (!InitializeLoggerFromConfiguration())
+		{
+			Log::Error("InitializeLoggerFromConfiguration(...) failure");
+			return false;
+		}
+
 		// load the properties
 		if (!ReadConfigurableProperties(ReadConfigurablePropertiesContext::INITIALIZATION, false))
 		{
@@ -131,6 +138,9 @@ namespace chaos
 	void Application::Finalize()
 	{
 		FinalizeManagers();
+		// handle the pending lines while the listeners are still alive
+		if (Logger* logger = Logger::GetInstance())
+			logger->StopAsynchronousMode();
 	}
 
 	int Application::Main()
@@ -150,6 +160,33 @@ namespace chaos
 
 	}
 
+	bool Application::InitializeLoggerFromConfiguration()
+	{
+		Logger* logger = Logger::GetInstance();
+		if (logger == nullptr)
+			return true;
+
+		// "logger" : { "max_line_count" : 5000, "asynchronous" : false, "ring_capacity" : 1024, "overflow_policy" : "DropNewest" }
+		if (JSONReadConfiguration logger_config = JSONTools::GetAttributeObjectNode(GetJSONReadConfiguration(), "logger"))
+		{
+			size_t max_line_count = logger->GetMaxLineCount();
+			if (JSONTools::GetAttribute(logger_config, "max_line_count", max_line_count))
+				logger->SetMaxLineCount(max_line_count);
+
+			bool asynchronous = false;
+			JSONTools::GetAttribute(logger_config, "asynchronous", asynchronous);
+			if (asynchronous && !logger->IsAsynchronousMode())
+			{
+				size_t ring_capacity = 1024;
+				JSONTools::GetAttribute(logger_config, "ring_capacity", ring_capacity);
+				LogOverflowPolicy overflow_policy = LogOverflowPolicy::DropNewest;
+				JSONTools::GetAttribute(logger_config, "overflow_policy", overflow_policy);
+				logger->StartAsynchronousMode(ring_capacity, overflow_policy);
+			}
+		}
+		return true;
+	}
+
 	int Application::Run(int argc, char ** argv, char ** env)
 	{
 		bool result = false;
@@ -186,11 +223,34 @@ namespace chaos
 
 	bool Application::InitializeManagers()
 	{
+		// start the job system (0 for one worker per hardware thread except the main thread)
+		size_t job_worker_count = 0;
+		JSONTools::GetAttribute(GetJSONReadConfiguration(), "job_worker_count", job_worker_count);
+
+		job_system = new JobSystem;
+		if (job_system == nullptr)
+			return false;
+		if (!job_system->StartWorkers(job_worker_count))
+			return false;
 		return true;
 	}
 
 	void Application::FinalizeManagers()
 	{
+		// stop the job system
+		if (job_system != nullptr)
+		{
+			job_system->StopWorkers();
+			job_system = nullptr;
+		}
+	}
+
+	JobSystem* Application::GetJobSystemInstance()
+	{
+		Application* application = GetInstance();
+		if (application == nullptr)
+			return nullptr;
+		return application->GetJobSystem();
 	}
 
 	void Application::StoreParameters(int argc, char ** argv, char ** env)
@@ -10,6 +10,8 @@ namespace chaos
 	Class::Class(std::string in_name) :
 		name(std::move(in_name))
 	{
+		static std::atomic<size_t> next_class_index = 0;
+		class_index = next_class_index.fetch_add(1, std::memory_order_relaxed);
 	}
 
 	bool Class::CanCreateInstance() const
@@ -102,6 +104,13 @@ namespace chaos
 		// parent not registered, cannot known result
 		if (parent_class == nullptr || !parent_class->IsDeclared())
 			return InheritanceType::UNKNOWN;
+		// use the ancestors bitset whenever the whole hierarchy is known
+		if (UpdateAncestorsCache())
+		{
+			if (parent_class->class_index < ancestors.size() && ancestors[parent_class->class_index])
+				return InheritanceType::YES;
+			return InheritanceType::NO;
+		}
 		// from top to root in the hierarchy
 		for (Class const* p = parent; p != nullptr; p = p->parent)
 		{
@@ -115,6 +124,32 @@ namespace chaos
 		return InheritanceType::NO;
 	}
 
+	bool Class::UpdateAncestorsCache() const
+	{
+		if (ancestors_cached.load(std::memory_order_acquire))
+			return true;
+		// the parent chain must be fully declared (it cannot change anymore)
+		if (!IsDeclared())
+			return false;
+		size_t max_index = 0;
+		for (Class const* p = parent; p != nullptr; p = p->parent)
+		{
+			if (!p->IsDeclared())
+				return false;
+			max_index = std::max(max_index, p->class_index);
+		}
+		// fill the bitset (another thread may have done it meanwhile)
+		static std::mutex ancestors_mutex;
+		std::lock_guard<std::mutex> lock(ancestors_mutex);
+		if (ancestors_cached.load(std::memory_order_relaxed))
+			return true;
+		ancestors.assign(max_index + 1, false);
+		for (Class const* p = parent; p != nullptr; p = p->parent)
+			ancestors[p->class_index] = true;
+		ancestors_cached.store(true, std::memory_order_release);
+		return true;
+	}
+
 	void Class::SetShortName(std::string in_short_name)
 	{
 		assert(StringTools::IsEmpty(short_name));
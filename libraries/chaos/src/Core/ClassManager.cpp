@@ -60,6 +60,23 @@ namespace chaos
 		return { nullptr, classes.end(), ClassMatchType::MATCH_NAME }; // empty ClassFindResult result
 	}
 
+	Class* ClassManager::FindCPPClassInstance(std::type_info const& info, bool search_manager_hierarchy) const
+	{
+		std::type_index index(info);
+
+		ClassManager const* manager = this;
+		while (manager != nullptr)
+		{
+			auto it = manager->cpp_classes.find(index);
+			if (it != manager->cpp_classes.end())
+				return it->second;
+			if (!search_manager_hierarchy)
+				break;
+			manager = manager->parent_manager.get();
+		}
+		return nullptr;
+	}
+
 	void ClassManager::InsertClass(Class* cls)
 	{
 		assert(cls != nullptr);
@@ -282,15 +282,39 @@ namespace chaos
 
 		if (tick_events)
 		{
-			for (size_t i = 0; i < pending_events.size(); ++i)
+			// an event whose start time is beyond the time slice can neither be ticked nor be too late : it is left asleep
+			double max_time = std::max(time1, time2);
+			while (sleeping_events.size() > 0 && sleeping_events[0]->wakeup_time <= max_time)
 			{
-				ClockEventInfo const & event_info = pending_events[i]->GetEventInfo();
+				ClockEvent* clock_event = sleeping_events[0];
+				UnscheduleEvent(clock_event);
+				ScheduleEvent(clock_event, true);
+			}
+
+			// the awake events are processed in the order of pending_events (ClockEventTickSet keeps the first registration of equivalent start times)
+			scan_indices.clear();
+			for (ClockEvent* clock_event : awake_events)
+				scan_indices.push_back(clock_event->pending_index);
+			std::sort(scan_indices.begin(), scan_indices.end(), std::greater<size_t>()); // awake events are unique, so are their indices
+			scan_max_time = max_time;
+			scanning = true;
+
+			while (scan_indices.size() > 0)
+			{
+				scan_cursor = scan_indices.back();
+				scan_indices.pop_back();
 
-				if (event_info.IsTooLateFor(time1))
+				shared_ptr<ClockEvent> clock_event = pending_events[scan_cursor]; // XXX : important to keep a reference after RemoveFromClock(...)
+				ClockEventInfo const & event_info = clock_event->GetEventInfo();
+
+				if (event_info.start_time > max_time) // a repeated event waiting for its next execution
+				{
+					UnscheduleEvent(clock_event.get());
+					ScheduleEvent(clock_event.get(), false);
+				}
+				else if (event_info.IsTooLateFor(time1))
 				{
-					shared_ptr<ClockEvent> clock_event = pending_events[i]; // XXX : important to keep a reference after RemoveFromClock(...)
-					clock_event->RemoveFromClock(); // XXX : we know RemoveFromClock = "RemoveReplace" so --i
-					--i;
+					clock_event->RemoveFromClock(); // XXX : RemoveFromClock = "RemoveReplace". The event moved at scan_cursor is processed next
 				}
 				else
 				{
@@ -298,7 +322,7 @@ namespace chaos
 					if (execution_info.IsValid())
 					{
 						ClockEventTickRegistration registration;
-						registration.clock_event = pending_events[i];
+						registration.clock_event = clock_event;
 						registration.time_slice = execution_info.time_slice;
 						registration.execution_range = execution_info.execution_range;
 						registration.tick_range = execution_info.tick_range;
@@ -312,6 +336,7 @@ namespace chaos
 					}
 				}
 			}
+			scanning = false;
 		}
 		// recursive tick
 		size_t child_count = children_clocks.size();
@@ -379,8 +404,19 @@ namespace chaos
 		clock_event->event_info = event_info;
 		clock_event->tick_count = 0;
 		clock_event->execution_count = 0;
+		clock_event->pending_index = pending_events.size();
 		pending_events.push_back(clock_event);
 
+		// an event added during the scan is processed by the scan, as any event at the end of pending_events
+		if (scanning && clock_event->event_info.start_time <= scan_max_time)
+		{
+			ScheduleEvent(clock_event, true);
+			InsertScanIndex(clock_event->pending_index);
+		}
+		else
+		{
+			ScheduleEvent(clock_event, false);
+		}
 		return true;
 	}
 
@@ -407,27 +443,119 @@ namespace chaos
 		Clock * tmp = clock; // keep a trace of parent
 		if (tmp != nullptr)
 		{
-			size_t count = tmp->pending_events.size();
-			for (size_t i = 0; i < count; ++i)
-			{
-				if (tmp->pending_events[i].get() == this)
-				{
-					AddReference(); // because, we want to pop back the event, then call OnEventRemovedFromClock(...)
+			size_t index = pending_index;
+			size_t last_index = tmp->pending_events.size() - 1;
+			assert(index <= last_index && tmp->pending_events[index].get() == this);
 
-					if (i != count - 1)
-						std::swap(tmp->pending_events[i], tmp->pending_events.back());
-					clock = nullptr;
-					tmp->pending_events.pop_back();
+			AddReference(); // because, we want to pop back the event, then call OnEventRemovedFromClock(...)
 
-					OnEventRemovedFromClock();
-					SubReference();
-					return true;
-				}
+			tmp->UnscheduleEvent(this);
+			if (index != last_index)
+			{
+				std::swap(tmp->pending_events[index], tmp->pending_events.back());
+				tmp->pending_events[index]->pending_index = index;
 			}
+			// the scan does not reach the moved event if it has already passed its new index
+			if (tmp->scanning)
+			{
+				tmp->RemoveScanIndex(index);
+				if (tmp->RemoveScanIndex(last_index) && index >= tmp->scan_cursor)
+					tmp->InsertScanIndex(index);
+			}
+			clock = nullptr;
+			tmp->pending_events.pop_back();
+
+			OnEventRemovedFromClock();
+			SubReference();
+			return true;
 		}
 		return false;
 	}
 
+	void Clock::ScheduleEvent(ClockEvent * clock_event, bool awake)
+	{
+		if (awake)
+		{
+			clock_event->sleeping = false;
+			clock_event->schedule_index = awake_events.size();
+			awake_events.push_back(clock_event);
+		}
+		else
+		{
+			clock_event->sleeping = true;
+			clock_event->wakeup_time = clock_event->event_info.start_time;
+			clock_event->schedule_index = sleeping_events.size();
+			sleeping_events.push_back(clock_event);
+			SiftSleepingEvent(clock_event->schedule_index);
+		}
+	}
+
+	void Clock::UnscheduleEvent(ClockEvent * clock_event)
+	{
+		std::vector<ClockEvent*> & events = (clock_event->sleeping) ? sleeping_events : awake_events;
+
+		size_t index = clock_event->schedule_index;
+		assert(index < events.size() && events[index] == clock_event);
+
+		if (index != events.size() - 1) // remove swap
+		{
+			events[index] = events.back();
+			events[index]->schedule_index = index;
+			events.pop_back();
+			if (clock_event->sleeping)
+				SiftSleepingEvent(index);
+		}
+		else
+		{
+			events.pop_back();
+		}
+	}
+
+	void Clock::InsertScanIndex(size_t index)
+	{
+		auto it = std::lower_bound(scan_indices.begin(), scan_indices.end(), index, std::greater<size_t>());
+		if (it == scan_indices.end() || *it != index)
+			scan_indices.insert(it, index);
+	}
+
+	bool Clock::RemoveScanIndex(size_t index)
+	{
+		auto it = std::lower_bound(scan_indices.begin(), scan_indices.end(), index, std::greater<size_t>());
+		if (it == scan_indices.end() || *it != index)
+			return false;
+		scan_indices.erase(it);
+		return true;
+	}
+
+	void Clock::SiftSleepingEvent(size_t index)
+	{
+		ClockEvent * clock_event = sleeping_events[index];
+		// move up while earlier than the parent
+		while (index > 0)
+		{
+			size_t parent = (index - 1) / 2;
+			if (sleeping_events[parent]->wakeup_time <= clock_event->wakeup_time)
+				break;
+			sleeping_events[index] = sleeping_events[parent];
+			sleeping_events[index]->schedule_index = index;
+			index = parent;
+		}
+		// move down while later than a child
+		size_t count = sleeping_events.size();
+		while (2 * index + 1 < count)
+		{
+			size_t child = 2 * index + 1;
+			if (child + 1 < count && sleeping_events[child + 1]->wakeup_time < sleeping_events[child]->wakeup_time)
+				++child;
+			if (clock_event->wakeup_time <= sleeping_events[child]->wakeup_time)
+				break;
+			sleeping_events[index] = sleeping_events[child];
+			sleeping_events[index]->schedule_index = index;
+			index = child;
+		}
+		sleeping_events[index] = clock_event;
+		clock_event->schedule_index = index;
+	}
 
 	bool Clock::SerializeIntoJSON(nlohmann::json * json) const
 	{
@@ -0,0 +1,84 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// ============================================================
+	// FixedTimeStep functions
+	// ============================================================
+
+	void FixedTimeStep::SetStepDuration(double in_step_duration)
+	{
+		step_duration = std::max(in_step_duration, 0.0);
+		Reset();
+	}
+
+	void FixedTimeStep::SetMaxStepCount(int in_max_step_count)
+	{
+		max_step_count = std::max(in_max_step_count, 0);
+	}
+
+	void FixedTimeStep::Reset()
+	{
+		accumulated_time = 0.0;
+	}
+
+	int FixedTimeStep::AdvanceTime(double delta_time)
+	{
+		if (!IsEnabled())
+			return 0;
+
+		accumulated_time += std::max(delta_time, 0.0);
+
+		double step_count = std::floor(accumulated_time / step_duration);
+		// the simulation cannot keep up : drop the excess time (keep the fractional part)
+		if (max_step_count > 0 && step_count > (double)max_step_count)
+		{
+			dropped_step_count += uint64_t(step_count) - uint64_t(max_step_count);
+			accumulated_time -= (step_count - (double)max_step_count) * step_duration;
+			step_count = (double)max_step_count;
+		}
+		accumulated_time -= step_count * step_duration;
+		accumulated_time = std::clamp(accumulated_time, 0.0, step_duration); // precision errors
+
+		return int(step_count);
+	}
+
+	// ============================================================
+	// FramePacer functions
+	// ============================================================
+
+	void FramePacer::SetTargetFrameRate(float in_target_frame_rate)
+	{
+		target_frame_rate = std::max(in_target_frame_rate, 0.0f);
+		started = false;
+	}
+
+	void FramePacer::WaitNextFrame()
+	{
+		if (!IsEnabled())
+			return;
+
+		std::chrono::steady_clock::duration frame_duration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / (double)target_frame_rate));
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+		if (started && now < next_frame_time)
+		{
+			// the OS scheduler is not precise : sleep for most of the remaining time and yield for the rest
+			std::chrono::steady_clock::duration const SPIN_DURATION = std::chrono::milliseconds(2);
+			if (next_frame_time - now > SPIN_DURATION)
+				std::this_thread::sleep_for(next_frame_time - now - SPIN_DURATION);
+			while (std::chrono::steady_clock::now() < next_frame_time)
+				std::this_thread::yield();
+
+			next_frame_time += frame_duration;
+		}
+		else
+		{
+			// first frame or frame too late : do not try to catch up
+			next_frame_time = now + frame_duration;
+			started = true;
+		}
+	}
+
+}; // namespace chaos
@@ -0,0 +1,207 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	/** the job system the current thread is a worker of */
+	static thread_local JobSystem* current_job_system = nullptr;
+	/** the queue of the current worker thread */
+	static thread_local size_t current_queue_index = 0;
+
+	JobSystem::JobSystem()
+	{
+		queues.push_back(std::make_unique<JobQueue>()); // the shared queue
+	}
+
+	JobSystem::~JobSystem()
+	{
+		StopWorkers();
+	}
+
+	bool JobSystem::StartWorkers(size_t worker_count)
+	{
+		if (workers.size() > 0) // already started
+			return false;
+
+		if (worker_count == 0)
+		{
+			size_t hardware_count = (size_t)std::thread::hardware_concurrency();
+			worker_count = (hardware_count > 1) ? hardware_count - 1 : 0;
+		}
+		if (worker_count == 0)
+			return true; // jobs are executed by the waiting threads
+
+		stopping = false;
+		// the worker queues are inserted before the shared queue
+		for (size_t i = 0; i < worker_count; ++i)
+			queues.insert(queues.begin(), std::make_unique<JobQueue>());
+		for (size_t i = 0; i < worker_count; ++i)
+			workers.emplace_back([this, i]()
+			{
+				WorkerMain(i);
+			});
+		return true;
+	}
+
+	void JobSystem::StopWorkers()
+	{
+		if (workers.size() == 0)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(sleep_mutex);
+			stopping = true;
+		}
+		sleep_condition.notify_all();
+		for (std::thread& worker : workers)
+			worker.join();
+		workers.clear();
+
+		// the jobs that are still in the worker queues (dependent jobs unlocked by the last executed jobs) are moved into the shared queue
+		JobQueue& shared_queue = *queues.back();
+		for (size_t i = 0; i < queues.size() - 1; ++i)
+			for (Job& job : queues[i]->jobs)
+				shared_queue.jobs.push_back(std::move(job));
+		queues.erase(queues.begin(), queues.end() - 1);
+	}
+
+	void JobSystem::WorkerMain(size_t queue_index)
+	{
+		current_job_system = this;
+		current_queue_index = queue_index;
+
+		while (true)
+		{
+			if (ExecuteOneJob())
+				continue;
+
+			std::unique_lock<std::mutex> lock(sleep_mutex);
+			if (stopping && queued_job_count == 0)
+				break;
+			sleep_condition.wait(lock, [this]()
+			{
+				return stopping || queued_job_count > 0;
+			});
+		}
+		current_job_system = nullptr;
+	}
+
+	void JobSystem::Schedule(std::function<void()> func, JobCounter* counter, JobCounter* dependency)
+	{
+		assert(func);
+
+		Job job;
+		job.func = std::move(func);
+		job.counter = counter;
+
+		if (counter != nullptr)
+			++counter->pending_count;
+
+		// the job is started by the last job of its dependency
+		if (dependency != nullptr)
+		{
+			std::lock_guard<std::mutex> lock(dependency->mutex);
+			if (dependency->pending_count > 0)
+			{
+				dependency->dependent_jobs.push_back(std::move(job));
+				return;
+			}
+		}
+		PushJob(std::move(job));
+	}
+
+	void JobSystem::PushJob(Job job)
+	{
+		JobQueue& queue = (current_job_system == this) ? *queues[current_queue_index] : *queues.back();
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.jobs.push_back(std::move(job));
+			++queued_job_count; // under the lock, so that a thief cannot decrement the counter before it is incremented
+		}
+
+		// XXX : locking the mutex ensures a worker cannot miss the notification between its test and its wait
+		{
+			std::lock_guard<std::mutex> lock(sleep_mutex);
+		}
+		sleep_condition.notify_one();
+	}
+
+	bool JobSystem::PopJob(Job& result)
+	{
+		bool is_worker = (current_job_system == this);
+
+		// the most recent job of the own queue (its data are more likely to be in cache)
+		if (is_worker)
+		{
+			JobQueue& queue = *queues[current_queue_index];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (queue.jobs.size() > 0)
+			{
+				result = std::move(queue.jobs.back());
+				queue.jobs.pop_back();
+				--queued_job_count;
+				return true;
+			}
+		}
+
+		// steal the oldest job of another queue
+		size_t queue_count = queues.size();
+		size_t start_index = (is_worker) ? current_queue_index + 1 : queue_count - 1; // non workers start with the shared queue
+		for (size_t i = 0; i < queue_count; ++i)
+		{
+			size_t index = (start_index + i) % queue_count;
+			if (is_worker && index == current_queue_index)
+				continue;
+
+			JobQueue& queue = *queues[index];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (queue.jobs.size() > 0)
+			{
+				result = std::move(queue.jobs.front());
+				queue.jobs.pop_front();
+				--queued_job_count;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool JobSystem::ExecuteOneJob()
+	{
+		if (queued_job_count == 0)
+			return false;
+
+		Job job;
+		if (!PopJob(job))
+			return false;
+		job.func();
+		CompleteJob(job.counter);
+		return true;
+	}
+
+	void JobSystem::CompleteJob(JobCounter* counter)
+	{
+		if (counter == nullptr)
+			return;
+
+		std::vector<Job> ready_jobs;
+		{
+			std::lock_guard<std::mutex> lock(counter->mutex);
+			if (--counter->pending_count == 0)
+				ready_jobs.swap(counter->dependent_jobs);
+		}
+		for (Job& job : ready_jobs)
+			PushJob(std::move(job));
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		while (!counter.IsDone())
+			if (!ExecuteOneJob())
+				std::this_thread::yield();
+
+		// XXX : the last job may still hold the mutex of the counter. The counter must not be destroyed before it is released
+		std::lock_guard<std::mutex> lock(counter.mutex);
+	}
+
+}; // namespace chaos
@@ -16,6 +16,14 @@ namespace chaos
 
 	CHAOS_IMPLEMENT_ENUM_METHOD(LogSeverity, &LogSeverity_metadata, CHAOS_API);
 
+	static chaos::EnumTools::EnumMetaData<LogOverflowPolicy> const LogOverflowPolicy_metadata =
+	{
+		{ LogOverflowPolicy::DropNewest, "DropNewest" },
+		{ LogOverflowPolicy::OverwriteOldest, "OverwriteOldest" }
+	};
+
+	CHAOS_IMPLEMENT_ENUM_METHOD(LogOverflowPolicy, &LogOverflowPolicy_metadata, CHAOS_API);
+
 	std::string LogLine::ToString() const
 	{
 		return std::format("[{}] [{}] [{}]\n{}",
@@ -34,6 +42,83 @@ namespace chaos
 			(content == src.content);
 	}
 
+	// ================================================================
+	// LogRecordRing implementation
+	// ================================================================
+
+	// XXX : each record has a sequence number that tells whether it can be written (sequence == push position)
+	//       or read (sequence == pop position + 1). Producers and consumers only compete with a CAS on the positions
+
+	LogRecordRing::LogRecordRing(size_t in_capacity) :
+		capacity(std::bit_ceil(std::max(in_capacity, size_t(2)))),
+		records(new LogRecord[capacity])
+	{
+		for (size_t i = 0; i < capacity; ++i)
+			records[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	bool LogRecordRing::Push(char const* domain, LogSeverity severity, std::chrono::system_clock::time_point time, std::string_view content)
+	{
+		LogRecord* record = nullptr;
+
+		// reserve a record
+		size_t position = push_position.load(std::memory_order_relaxed);
+		while (true)
+		{
+			record = &records[position & (capacity - 1)];
+			size_t sequence = record->sequence.load(std::memory_order_acquire);
+			intptr_t difference = intptr_t(sequence) - intptr_t(position);
+			if (difference == 0)
+			{
+				if (push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0)
+				return false; // full
+			else
+				position = push_position.load(std::memory_order_relaxed);
+		}
+
+		// fill the record and publish it
+		record->time = time;
+		record->severity = severity;
+		record->domain = domain;
+		record->content.assign(content.data(), std::min(content.size(), LogRecord::MAX_CONTENT_SIZE));
+		record->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool LogRecordRing::Pop(LogLine& result)
+	{
+		LogRecord* record = nullptr;
+
+		// reserve a record
+		size_t position = pop_position.load(std::memory_order_relaxed);
+		while (true)
+		{
+			record = &records[position & (capacity - 1)];
+			size_t sequence = record->sequence.load(std::memory_order_acquire);
+			intptr_t difference = intptr_t(sequence) - intptr_t(position + 1);
+			if (difference == 0)
+			{
+				if (pop_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0)
+				return false; // empty
+			else
+				position = pop_position.load(std::memory_order_relaxed);
+		}
+
+		// read the record and release it for next round
+		result.time = record->time;
+		result.severity = record->severity;
+		result.domain = record->domain;
+		result.content.swap(record->content);
+		record->sequence.store(position + capacity, std::memory_order_release);
+		return true;
+	}
+
 	// ================================================================
 	// LoggerListener implementation
 	// ================================================================
@@ -86,8 +171,16 @@ namespace chaos
 		{
 			output_file.open(log_path.c_str(), std::ofstream::binary | std::ofstream::trunc);
 			if (output_file.is_open())
-				for (LogLine const& line : in_logger->GetLines())
-					OnNewLine(line);
+			{
+				in_logger->WithLines([this](std::deque<LogLine> const& lines)
+				{
+					for (LogLine const& line : lines)
+					{
+						output_file << line.ToString() << "\n\n";
+						last_line_index_handled = line.line_index;
+					}
+				});
+			}
 		}
 	}
 
@@ -98,14 +191,10 @@ namespace chaos
 
 	void FileLoggerListener::OnNewLine(LogLine const& line)
 	{
+		// lines from several threads may come in any order : only skip the ones that were written when attached
 		if (!last_line_index_handled.has_value() || line.line_index > last_line_index_handled.value())
-		{
 			if (output_file.is_open())
-			{
 				output_file << line.ToString() << "\n\n";
-				last_line_index_handled = std::max(last_line_index_handled.value_or(line.line_index), line.line_index);
-			}
-		}
 	}
 
 	void FileLoggerListener::DrawImGuiMenu()
@@ -127,6 +216,8 @@ namespace chaos
 
 	Logger::~Logger()
 	{
+		// handle pending records
+		StopAsynchronousMode();
 		// remove all listeners
 		while (listeners.size() > 0)
 		{
@@ -148,6 +239,9 @@ namespace chaos
 
 	void Logger::AddListener(LoggerListener* listener)
 	{
+		std::lock_guard<std::recursive_mutex> notification_lock(notification_mutex);
+		std::lock_guard<std::recursive_mutex> lock(lines_mutex);
+
 		assert(listener != nullptr);
 		assert(listener->logger == nullptr);
 		listener->logger = this;
@@ -157,6 +251,10 @@ namespace chaos
 
 	void Logger::RemoveListener(LoggerListener* listener)
 	{
+		// wait for the notification in progress (a listener is never notified once removed)
+		std::lock_guard<std::recursive_mutex> notification_lock(notification_mutex);
+		std::lock_guard<std::recursive_mutex> lock(lines_mutex);
+
 		assert(listener != nullptr);
 		assert(listener->logger == this);
 
@@ -220,18 +318,159 @@ namespace chaos
 
 	void Logger::DoOutput(char const * domain, LogSeverity severity, std::string_view buffer)
 	{
-		// register the new line
+		std::chrono::system_clock::time_point time = std::chrono::system_clock::now();
+
+		// asynchronous mode : the background thread handles the line
+		if (ring != nullptr)
+		{
+			if (!ring->Push(domain, severity, time, buffer))
+			{
+				if (overflow_policy == LogOverflowPolicy::DropNewest)
+				{
+					++dropped_line_count;
+					return;
+				}
+				// discard the oldest records until there is some room
+				LogLine discarded_line;
+				while (!ring->Push(domain, severity, time, buffer))
+				{
+					if (ring->Pop(discarded_line))
+					{
+						++overwritten_line_count;
+						++handled_record_count;
+					}
+				}
+			}
+			++pushed_record_count;
+			++wakeup_count;
+			wakeup_count.notify_one();
+			return;
+		}
+
+		// synchronous mode
 		LogLine new_line;
-		new_line.line_index = next_line_index++;
 		new_line.severity = severity;
 		new_line.content = buffer;
-		new_line.time = std::chrono::system_clock::now();
+		new_line.time = time;
 		new_line.domain = domain;
-		lines.push_back(new_line);
+		DoOutputLine(new_line);
+	}
+
+	void Logger::DoOutputLine(LogLine& new_line)
+	{
+		// register the new line
+		std::vector<shared_ptr<LoggerListener>> notified_listeners;
+		{
+			std::lock_guard<std::recursive_mutex> lock(lines_mutex);
+
+			new_line.line_index = next_line_index++;
+			lines.push_back(new_line);
+			if (max_line_count > 0)
+				while (lines.size() > max_line_count)
+					lines.pop_front();
+
+			// the listeners attached later are given the line when attached
+			if (listeners.size() == 0)
+				return;
+			notified_listeners = listeners;
+		}
+
+		// notify all listener for this new line (the lines can be read and written meanwhile)
+		std::lock_guard<std::recursive_mutex> notification_lock(notification_mutex);
+		for (auto& listener : notified_listeners)
+			if (listener->logger == this) // the listener may have been removed
+				listener->OnNewLine(new_line);
+	}
+
+	void Logger::SetMaxLineCount(size_t in_max_line_count)
+	{
+		std::lock_guard<std::recursive_mutex> lock(lines_mutex);
+
+		max_line_count = in_max_line_count;
+		if (max_line_count > 0)
+			while (lines.size() > max_line_count)
+				lines.pop_front();
+	}
 
-		// notify all listener for this new line
-		for (auto& listener : listeners)
-			listener->OnNewLine(new_line);
+	void Logger::StartAsynchronousMode(size_t ring_capacity, LogOverflowPolicy in_overflow_policy)
+	{
+		// XXX : no other thread should log while the mode changes
+		StopAsynchronousMode();
+
+		overflow_policy = in_overflow_policy;
+		ring = std::make_unique<LogRecordRing>(ring_capacity);
+		asynchronous_stop_requested = false;
+		asynchronous_thread = std::thread([this]()
+		{
+			AsynchronousThreadMain();
+		});
+	}
+
+	void Logger::StopAsynchronousMode()
+	{
+		// XXX : no other thread should log while the mode changes
+		if (ring == nullptr)
+			return;
+
+		asynchronous_stop_requested = true;
+		++wakeup_count;
+		wakeup_count.notify_one();
+		if (asynchronous_thread.joinable())
+			asynchronous_thread.join();
+		ring = nullptr;
+	}
+
+	void Logger::Flush()
+	{
+		if (ring == nullptr || std::this_thread::get_id() == asynchronous_thread.get_id())
+			return;
+		// wait until the background thread has handled every record pushed so far
+		size_t target = pushed_record_count;
+		while (true)
+		{
+			size_t handled = handled_record_count;
+			if (handled >= target)
+				break;
+			handled_record_count.wait(handled);
+		}
+	}
+
+	void Logger::AsynchronousThreadMain()
+	{
+		LogLine line;
+		while (true)
+		{
+			size_t wakeup = wakeup_count;
+			while (ring->Pop(line))
+			{
+				DoOutputLine(line);
+				++handled_record_count;
+			}
+			handled_record_count.notify_all();
+
+			if (asynchronous_stop_requested)
+				break;
+			wakeup_count.wait(wakeup);
+		}
+		// the records pushed just before the stop request
+		while (ring->Pop(line))
+		{
+			DoOutputLine(line);
+			++handled_record_count;
+		}
+		handled_record_count.notify_all();
+	}
+
+	size_t Logger::GetDomainCount() const
+	{
+		std::lock_guard<std::mutex> lock(domains_mutex);
+		return domains.size();
+	}
+
+	char const* Logger::GetDomain(size_t index) const
+	{
+		std::lock_guard<std::mutex> lock(domains_mutex);
+		return domains[index]->c_str();
 	}
 
 	char const* Logger::RegisterDomain(std::string_view domain)
@@ -244,6 +483,8 @@ namespace chaos
 		//                    instead of
 		//      std::vector<std:string>
 
+		std::lock_guard<std::mutex> lock(domains_mutex);
+
 		// search if domain is already registered
 		for (std::string const * d : domains)
 			if (*d == domain)
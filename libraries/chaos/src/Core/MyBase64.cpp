@@ -4,12 +4,25 @@
 namespace chaos
 {
 
-	bool MyBase64::IsBase64(unsigned char c)
+	char const * MyBase64::base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	int MyBase64::GetCharacterIndex(unsigned char c)
 	{
-		return (isalnum(c) || (c == '+') || (c == '/'));
+		static std::array<int8_t, 256> const table = []()
+		{
+			std::array<int8_t, 256> result;
+			result.fill(-1);
+			for (int i = 0; i < 64; ++i)
+				result[(unsigned char)base64_chars[i]] = (int8_t)i;
+			return result;
+		}();
+		return table[c];
 	}
 
-	char const * MyBase64::base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	bool MyBase64::IsBase64(unsigned char c)
+	{
+		return (GetCharacterIndex(c) >= 0);
+	}
 
 	// XXX : explanation
 	//       we split input into groups of 3 bytes [0-255]
@@ -93,7 +106,7 @@ namespace chaos
 				break;
 
 			// replace incomming byte by its index and pack it
-			char_array_4[tmp++] = (unsigned char)(strchr(base64_chars, c) - base64_chars);
+			char_array_4[tmp++] = (unsigned char)GetCharacterIndex(c);
 			if (tmp == 4)
 			{
 				DecodeBuffer(char_array_4, char_array_3);
@@ -119,4 +132,47 @@ namespace chaos
 		return result;
 	}
 
+	size_t MyBase64::DecodePart(char const *& src, unsigned char * dst, size_t dst_size)
+	{
+		assert(src != nullptr);
+		assert(dst_size >= 3);
+
+		size_t result = 0;
+		while (result + 3 <= dst_size)
+		{
+			// read a group of 4 characters
+			unsigned char char_array_4[4];
+			int count = 0;
+			while (count < 4)
+			{
+				int index = GetCharacterIndex((unsigned char)src[count]); // the terminal 0 is not a base64 character
+				if (index < 0)
+					break;
+				char_array_4[count++] = (unsigned char)index;
+			}
+			src += count;
+
+			if (count == 4)
+			{
+				DecodeBuffer(char_array_4, dst + result);
+				result += 3;
+			}
+			else // this is the end of the text
+			{
+				if (count > 1)
+				{
+					for (int j = count; j < 4; j++) // add additionnal 0 to clean the end of the array
+						char_array_4[j] = 0;
+
+					unsigned char char_array_3[3];
+					DecodeBuffer(char_array_4, char_array_3);
+					for (int j = 0; j < count - 1; j++)
+						dst[result++] = char_array_3[j];
+				}
+				break;
+			}
+		}
+		return result;
+	}
+
 }; // namespace chaos
@@ -3,12 +3,70 @@
 
 namespace chaos
 {
+	NamedInterface::NamedInterface(NamedInterface const& src) :
+		name(src.name),
+		tag(src.tag)
+	{
+	}
+
+	NamedInterface::NamedInterface(NamedInterface&& src) :
+		name(std::move(src.name)),
+		tag(src.tag)
+	{
+	}
+
+	void NamedInterface::AddNamingObserver(NamingObserver* observer) const
+	{
+		assert(observer != nullptr);
+		// remove the destroyed observers
+		naming_observers.erase(std::remove_if(naming_observers.begin(), naming_observers.end(), [](weak_ptr<NamingObserver> const& ptr)
+		{
+			return (ptr == nullptr);
+		}), naming_observers.end());
+		// already registered ?
+		for (weak_ptr<NamingObserver> const& ptr : naming_observers)
+			if (ptr.get() == observer)
+				return;
+		naming_observers.push_back(observer);
+	}
+
+	void NamedInterface::OnNamingChanged()
+	{
+		for (weak_ptr<NamingObserver> const& ptr : naming_observers)
+			if (ptr != nullptr)
+				ptr->naming_changed = true;
+		naming_observers.clear(); // the observers register again when they are updated
+	}
+
+	NamedInterface& NamedInterface::operator = (NamedInterface const& src)
+	{
+		name = src.name;
+		tag = src.tag;
+		OnNamingChanged();
+		return *this;
+	}
+
+	NamedInterface& NamedInterface::operator = (NamedInterface&& src)
+	{
+		name = std::move(src.name);
+		tag = src.tag;
+		OnNamingChanged();
+		return *this;
+	}
+
 	void NamedInterface::SetName(char const * in_name)
 	{
 		if (in_name == nullptr)
 			name.clear();
 		else
 			name = in_name;
+		OnNamingChanged();
+	}
+
+	void NamedInterface::SetTag(TagType in_tag)
+	{
+		tag = in_tag;
+		OnNamingChanged();
 	}
 
 	void NamedInterface::SetObjectNaming(ObjectRequest request)
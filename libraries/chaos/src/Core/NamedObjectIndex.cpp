@@ -0,0 +1,32 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	NamedObjectIndex& NamedObjectIndex::operator = (NamedObjectIndex const&)
+	{
+		Invalidate();
+		return *this;
+	}
+
+	void NamedObjectIndex::Invalidate()
+	{
+		dirty = true;
+	}
+
+	uint64_t NamedObjectIndex::GetNameHash(char const* name)
+	{
+		// FNV-1a on lower case characters
+		uint64_t result = 14695981039346656037ULL;
+		if (name != nullptr)
+		{
+			for (; *name != 0; ++name)
+			{
+				result ^= (uint64_t)(unsigned char)tolower((unsigned char)*name);
+				result *= 1099511628211ULL;
+			}
+		}
+		return result;
+	}
+
+}; // namespace chaos
@@ -189,6 +189,137 @@ namespace chaos
 		return result;
 	}
 
+	// XXX : for sfnt fonts, FT_Get_Kerning(...) only uses the horizontal format 0 subtables of the 'kern' table (Microsoft layout).
+	//       reading the pairs they declare avoids testing every pair of glyphs (the values still come from FT_Get_Kerning(...) so that scaling and rounding are unchanged)
+
+	static bool GetKerningTableGlyphPairs(FT_Face face, std::vector<std::pair<FT_UInt, FT_UInt>>& result)
+	{
+		if (!FT_IS_SFNT(face))
+			return false;
+
+		FT_ULong length = 0;
+		if (FT_Load_Sfnt_Table(face, TTAG_kern, 0, nullptr, &length) != 0 || length < 4)
+			return false;
+		std::vector<FT_Byte> table(length);
+		if (FT_Load_Sfnt_Table(face, TTAG_kern, 0, table.data(), &length) != 0)
+			return false;
+
+		auto ReadUInt16 = [&table](size_t offset)
+		{
+			return (uint32_t(table[offset]) << 8) | uint32_t(table[offset + 1]);
+		};
+
+		if (ReadUInt16(0) != 0) // the Apple layout is not used by FreeType
+			return false;
+
+		size_t table_count = ReadUInt16(2);
+		size_t offset = 4;
+		for (size_t i = 0; i < table_count && offset + 14 <= length; ++i)
+		{
+			size_t subtable_length = ReadUInt16(offset + 2);
+			uint32_t coverage = ReadUInt16(offset + 4);
+			size_t pair_count = ReadUInt16(offset + 6);
+
+			// format 0 : the 16 bits length overflows for more than 10920 pairs, the real length is given by the number of pairs
+			if ((coverage >> 8) == 0)
+				subtable_length = 14 + 6 * pair_count;
+
+			// format 0, horizontal, neither minimum nor cross-stream (the override bit is accepted)
+			if ((coverage & ~8U) == 0x0001)
+			{
+				size_t pairs_offset = offset + 14;
+				pair_count = std::min(pair_count, size_t(length - pairs_offset) / 6); // bounded by the size of the table
+				for (size_t j = 0; j < pair_count; ++j)
+					result.push_back({ FT_UInt(ReadUInt16(pairs_offset + 6 * j)), FT_UInt(ReadUInt16(pairs_offset + 6 * j + 2)) });
+			}
+			if (subtable_length <= 14)
+				break;
+			offset += subtable_length;
+		}
+		return true;
+	}
+
+	std::vector<FontTools::KerningPair> FontTools::GetKerningPairs(FT_Face face, std::map<uint32_t, CharacterBitmapGlyph> const& glyph_cache)
+	{
+		assert(face != nullptr);
+
+		std::vector<KerningPair> result;
+		if (!FT_HAS_KERNING(face))
+			return result;
+
+		// resolve the glyph indices once (sorted by glyph index, several characters may share the same glyph)
+		std::vector<std::pair<FT_UInt, uint32_t>> glyph_charcodes;
+		glyph_charcodes.reserve(glyph_cache.size());
+		for (auto const& glyph : glyph_cache)
+		{
+			if (glyph.first == 0) // the 'not found' glyph
+				continue;
+			FT_UInt glyph_index = FT_Get_Char_Index(face, glyph.first);
+			if (glyph_index != 0)
+				glyph_charcodes.push_back({ glyph_index, glyph.first });
+		}
+		std::sort(glyph_charcodes.begin(), glyph_charcodes.end());
+
+		auto AddKerning = [face, &result](FT_UInt left_glyph, FT_UInt right_glyph, auto left_charcodes, auto right_charcodes)
+		{
+			FT_Vector delta = { 0, 0 };
+			if (FT_Get_Kerning(face, left_glyph, right_glyph, FT_KERNING_DEFAULT, &delta) != 0)
+				return;
+			int x = int(delta.x >> 6); // 26.6 fixed point
+			if (x == 0)
+				return;
+			for (auto left = left_charcodes.first; left != left_charcodes.second; ++left)
+				for (auto right = right_charcodes.first; right != right_charcodes.second; ++right)
+					result.push_back({ left->second, right->second, x });
+		};
+
+		auto GetCharcodes = [&glyph_charcodes](FT_UInt glyph_index)
+		{
+			return std::equal_range(glyph_charcodes.begin(), glyph_charcodes.end(), std::pair<FT_UInt, uint32_t>(glyph_index, 0), [](auto const& a, auto const& b)
+			{
+				return a.first < b.first;
+			});
+		};
+
+		std::vector<std::pair<FT_UInt, FT_UInt>> table_pairs;
+		if (GetKerningTableGlyphPairs(face, table_pairs))
+		{
+			// only the pairs declared by the table (a pair may appear in several subtables)
+			std::sort(table_pairs.begin(), table_pairs.end());
+			table_pairs.erase(std::unique(table_pairs.begin(), table_pairs.end()), table_pairs.end());
+
+			for (auto const& [left_glyph, right_glyph] : table_pairs)
+			{
+				auto left_charcodes = GetCharcodes(left_glyph);
+				if (left_charcodes.first == left_charcodes.second)
+					continue;
+				auto right_charcodes = GetCharcodes(right_glyph);
+				if (right_charcodes.first == right_charcodes.second)
+					continue;
+				AddKerning(left_glyph, right_glyph, left_charcodes, right_charcodes);
+			}
+		}
+		else
+		{
+			// other font formats: test every pair of used glyphs
+			std::vector<FT_UInt> glyph_indices;
+			for (auto const& glyph : glyph_charcodes)
+				if (glyph_indices.size() == 0 || glyph_indices.back() != glyph.first)
+					glyph_indices.push_back(glyph.first);
+
+			for (FT_UInt left_glyph : glyph_indices)
+				for (FT_UInt right_glyph : glyph_indices)
+					AddKerning(left_glyph, right_glyph, GetCharcodes(left_glyph), GetCharcodes(right_glyph));
+		}
+
+		// same order whatever the method
+		std::sort(result.begin(), result.end(), [](KerningPair const& a, KerningPair const& b)
+		{
+			return (a.left_charcode < b.left_charcode) || (a.left_charcode == b.left_charcode && a.right_charcode < b.right_charcode);
+		});
+		return result;
+	}
+
 	FIBITMAP * FontTools::GenerateImage(FT_Face face, uint32_t charcode, PixelFormat const & pixel_format)
 	{
 		assert(face != nullptr);
@@ -300,12 +300,8 @@ namespace chaos
 		if (FileTools::IsTypedFile(resolved_path, "tmx"))
 		{
 			// create the tiledmap manager if necessary
-			if (tiled_map_manager == nullptr)
-			{
-				tiled_map_manager = new TiledMap::Manager;
-				if (tiled_map_manager == nullptr)
-					return nullptr;
-			}
+			if (GetOrCreateTiledMapManager() == nullptr)
+				return nullptr;
 			// load the resource
 			TiledMap::Map* tiled_map = tiled_map_manager->LoadMap(path, false); // XXX : false => dont keep it in manager => necessary for HOTRELOAD
 
@@ -349,6 +345,23 @@ namespace chaos
 		return {};
 	}
 
+	TiledMap::Manager* Game::GetOrCreateTiledMapManager()
+	{
+		if (tiled_map_manager == nullptr)
+		{
+			tiled_map_manager = new TiledMap::Manager;
+			if (tiled_map_manager == nullptr)
+				return nullptr;
+			if (!tiled_map_cache_directory.empty())
+			{
+				tiled_map_manager->SetCacheMaxSize(tiled_map_cache_max_size);
+				tiled_map_manager->SetCacheMaxAge(tiled_map_cache_max_age);
+				tiled_map_manager->SetCacheDirectory(tiled_map_cache_directory);
+			}
+		}
+		return tiled_map_manager.get();
+	}
+
 	bool Game::DoGenerateTiledMapEntity(
 		nlohmann::json const * config,
 		char const * property_name,
@@ -364,12 +377,8 @@ namespace chaos
 			if (FileTools::IsTypedFile(p, extension))
 			{
 				// create the tiledmap manager if necessary
-				if (tiled_map_manager == nullptr)
-				{
-					tiled_map_manager = new TiledMap::Manager;
-					if (tiled_map_manager == nullptr)
-						return true;
-				}
+				if (GetOrCreateTiledMapManager() == nullptr)
+					return true;
 				if (!func(tiled_map_manager.get(), p))
 					return true;
 			}
@@ -464,6 +473,23 @@ namespace chaos
 	}
 
 	bool Game::CreateBackgroundImage(ObjectRequest material_request, ObjectRequest texture_request)
+	{
+		GPUTexture* texture = nullptr;
+		if (!texture_request.IsNoneRequest())
+		{
+			// search the corresponding texture
+			GPUResourceManager* resource_manager = WindowApplication::GetGPUResourceManagerInstance();
+			if (resource_manager != nullptr)
+			{
+				texture = resource_manager->FindTexture(texture_request);
+				if (texture == nullptr)
+					return false;
+			}
+		}
+		return CreateBackgroundImageFromTexture(material_request, texture);
+	}
+
+	bool Game::CreateBackgroundImageFromTexture(ObjectRequest material_request, GPUTexture* texture)
 	{
 		if (material_request.IsNoneRequest())
 			material_request = "background";
@@ -475,12 +501,8 @@ namespace chaos
 			shared_ptr<GPURenderMaterial> background_material = resource_manager->FindRenderMaterial(material_request); // use shared_ptr because we may create a child material
 			if (background_material != nullptr)
 			{
-				if (!texture_request.IsNoneRequest())
+				if (texture != nullptr)
 				{
-					// search the corresponding texture
-					GPUTexture* texture = resource_manager->FindTexture(texture_request);
-					if (texture == nullptr)
-						return false;
 					// create a child material
 					GPURenderMaterial* child_material = new GPURenderMaterial();
 					if (child_material == nullptr)
@@ -565,6 +587,13 @@ namespace chaos
 		if (!ReadConfigurableProperties(ReadConfigurablePropertiesContext::INITIALIZATION, false))
 			return false;
 
+		// the binary cache for tiled map files is opt-in (a relative directory is in the user temp directory)
+		if (JSONTools::GetAttribute(config, "tiledmap_cache_directory", tiled_map_cache_directory) && tiled_map_cache_directory.is_relative())
+			if (WindowApplication* application = Application::GetInstance())
+				tiled_map_cache_directory = application->GetUserLocalTempPath() / tiled_map_cache_directory;
+		JSONTools::GetAttribute(config, "tiledmap_cache_max_size", tiled_map_cache_max_size);
+		JSONTools::GetAttribute(config, "tiledmap_cache_max_age", tiled_map_cache_max_age);
+
 		// shu49 c'est bizare d avoir le type sets ici
 
 
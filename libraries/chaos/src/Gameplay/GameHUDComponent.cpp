@@ -653,6 +653,11 @@ namespace chaos
 
 #if _DEBUG
 
+	namespace GlobalVariables
+	{
+		CHAOS_GLOBAL_VARIABLE(bool, ShowVertexArrayCache, false);
+	};
+
 	GameHUDDebugValuesComponent::GameHUDDebugValuesComponent()
 	{
 		generator_params.line_height = 30.0f;
@@ -671,6 +676,13 @@ namespace chaos
 	{
 		// XXX : do not apply delta_time to entries here because we want entries to be displayed at least once
 		last_delta_time = delta_time;
+		// display the efficiency of the vertex array caches
+		if (GlobalVariables::ShowVertexArrayCache.Get())
+		{
+			GPUVertexArrayCacheStatistics statistics = GPUVertexArrayCache::GetGlobalStatistics();
+			AddValue("vertex arrays", StringTools::Printf("%d", int(statistics.entry_count)).c_str());
+			AddValue("vertex array hits", StringTools::Printf("%.1f%%", 100.0f * statistics.GetHitRate()).c_str());
+		}
 		return true;
 	}
 
@@ -3,6 +3,12 @@
 
 namespace chaos
 {
+	namespace GlobalVariables
+	{
+		CHAOS_GLOBAL_VARIABLE(bool, SnapshotCheckpoints, false); // save the modified triggers into a binary snapshot instead of JSON
+		CHAOS_GLOBAL_VARIABLE(bool, BenchmarkCheckpoints, false); // log the cost of the level checkpoints each time a respawn checkpoint is created
+	};
+
 	CHAOS_IMPLEMENT_GAMEPLAY_GETTERS(GameInstance);
 
 	int GameInstance::GetBestPlayerScore() const
@@ -362,6 +368,8 @@ namespace chaos
 
 	bool GameInstance::CreateRespawnCheckpoint()
 	{
+		if (GlobalVariables::BenchmarkCheckpoints.Get())
+			BenchmarkLevelCheckpoints();
 		respawn_checkpoint = SaveIntoCheckpoint();
 		return (respawn_checkpoint != nullptr);
 	}
@@ -378,13 +386,57 @@ namespace chaos
 		return LoadFromCheckpoint(respawn_checkpoint.get());
 	}
 
+	void GameInstance::BenchmarkLevelCheckpoints()
+	{
+		LevelInstance* level_instance = GetLevelInstance();
+		if (level_instance == nullptr)
+			return;
+
+		int const REPEAT_COUNT = 100;
+
+		for (bool use_snapshot : { false, true })
+		{
+			shared_ptr<GameCheckpoint> checkpoint = new GameCheckpoint;
+
+			bool result = true;
+			double save_duration = 0.0;
+			double load_duration = 0.0;
+			for (int i = 0; i < REPEAT_COUNT && result; ++i)
+			{
+				checkpoint->level_save = nlohmann::json();
+
+				auto t0 = std::chrono::steady_clock::now();
+				result = level_instance->SaveIntoCheckpoint(checkpoint.get(), use_snapshot);
+				auto t1 = std::chrono::steady_clock::now();
+				result = result && level_instance->LoadFromCheckpoint(checkpoint.get()); // restoring the state just saved leaves the level unchanged
+				auto t2 = std::chrono::steady_clock::now();
+
+				save_duration += std::chrono::duration<double, std::milli>(t1 - t0).count();
+				load_duration += std::chrono::duration<double, std::milli>(t2 - t1).count();
+			}
+
+			if (!result)
+			{
+				Log::Error("GameInstance::BenchmarkLevelCheckpoints: %s checkpoint failure", use_snapshot ? "snapshot" : "JSON");
+				continue;
+			}
+
+			Log::Message("GameInstance::BenchmarkLevelCheckpoints: %s checkpoint: save %f ms, load %f ms, JSON %d bytes, snapshot %d bytes",
+				use_snapshot ? "snapshot" : "JSON",
+				save_duration / double(REPEAT_COUNT),
+				load_duration / double(REPEAT_COUNT),
+				int(checkpoint->level_save.dump().size()),
+				int(checkpoint->level_snapshot.size()));
+		}
+	}
+
 	bool GameInstance::DoSaveIntoCheckpoint(GameCheckpoint * checkpoint) const
 	{
 		// save level instance data
 		// XXX : this is important that it is first so we can test LEVEL INDEX correspond to the level
 		LevelInstance const* level_instance = GetLevelInstance();
 		if (level_instance != nullptr)
-			if (!SaveIntoJSON(&checkpoint->level_save, *level_instance))
+			if (!level_instance->SaveIntoCheckpoint(checkpoint, GlobalVariables::SnapshotCheckpoints.Get()))
 				return false;
 
 		//WinTools::CopyStringToClipboard(checkpoint->level_save.dump(2).c_str());
@@ -416,7 +468,7 @@ namespace chaos
 		// XXX : this is important that it is first so we can test LEVEL INDEX correspond to the level
 		LevelInstance * level_instance = GetLevelInstance();
 		if (level_instance != nullptr)
-			if (!LoadFromJSON(&checkpoint->level_save, *level_instance)) // XXX : indirection is important to avoid a reallocation the object
+			if (!level_instance->LoadFromCheckpoint(checkpoint))
 				return false;
 
 		// load player data
@@ -35,6 +35,26 @@ namespace chaos
 		return true;
 	}
 
+	bool GameWindow::EnumerateKnownImGuiObjects(EnumerateKnownImGuiObjectFunc func) const
+	{
+		// super call
+		if (Window::EnumerateKnownImGuiObjects(func))
+			return true;
+
+		if (game != nullptr && game->GetParticleManager() != nullptr)
+		{
+			if (func("Particle Buffer Pool", [this]()
+			{
+				ImGuiGPUBufferPoolObject* result = new ImGuiGPUBufferPoolObject;
+				if (result != nullptr)
+					result->SetBufferPool(&game->GetParticleManager()->GetBufferPool());
+				return result;
+			}))
+				return true;
+		}
+		return false;
+	}
+
 	// shuxxx GameViewportWidget test
 
 #if 0
@@ -429,6 +429,47 @@ namespace chaos
 		return true;
 	}
 
+	bool LevelInstance::SaveIntoSnapshot(std::vector<char>& snapshot) const
+	{
+		return false;
+	}
+
+	bool LevelInstance::LoadFromSnapshot(std::vector<char> const& snapshot)
+	{
+		return false;
+	}
+
+	bool LevelInstance::SaveIntoCheckpoint(GameCheckpoint* checkpoint, bool use_snapshot) const
+	{
+		assert(checkpoint != nullptr);
+
+		// the objects first, so that the JSON only contains what remains
+		checkpoint->level_snapshot.clear();
+		if (use_snapshot && !SaveIntoSnapshot(checkpoint->level_snapshot))
+		{
+			checkpoint->level_snapshot.clear();
+			use_snapshot = false;
+		}
+
+		objects_in_snapshot = use_snapshot;
+		bool result = SaveIntoJSON(&checkpoint->level_save, *this);
+		objects_in_snapshot = false;
+		return result;
+	}
+
+	bool LevelInstance::LoadFromCheckpoint(GameCheckpoint const* checkpoint)
+	{
+		assert(checkpoint != nullptr);
+
+		// XXX : the JSON first, so we can test LEVEL INDEX correspond to the level
+		if (!LoadFromJSON(&checkpoint->level_save, *this)) // XXX : indirection is important to avoid a reallocation the object
+			return false;
+		if (!checkpoint->level_snapshot.empty())
+			if (!LoadFromSnapshot(checkpoint->level_snapshot))
+				return false;
+		return true;
+	}
+
 	box2 LevelInstance::GetBoundingBox() const
 	{
 		if (game != nullptr)
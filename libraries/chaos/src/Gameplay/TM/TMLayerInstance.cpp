@@ -178,6 +178,16 @@ namespace chaos
 		std::string collision_mask = layer->GetPropertyValueString("COLLISION_MASK", "");
 		ComputeLayerCollisionMask(collision_mask.c_str());
 
+		spatial_index_enabled = layer->GetPropertyValueBool("SPATIAL_INDEX", spatial_index_enabled);
+		if (spatial_index_enabled)
+		{
+			TiledMap::Map const* tiled_map = level_instance->GetTiledMap();
+			float default_cell_size = (tiled_map != nullptr) ? 4.0f * (float)GLMTools::GetMaxComponent(tiled_map->tile_size) : spatial_index.GetCellSize();
+			float cell_size = layer->GetPropertyValueFloat("SPATIAL_INDEX_CELL_SIZE", default_cell_size);
+			if (cell_size > 0.0f)
+				spatial_index.SetCellSize(cell_size);
+		}
+
 		// copy the offset / name
 		offset = layer->offset;
 		name = layer->name;
@@ -228,7 +238,7 @@ namespace chaos
 		// in "Objects" array, read all objects, search the ID and apply the data to dedicated object
 		if (JSONReadConfiguration objects_config = JSONTools::GetElementArrayNode(config, attribute_name))
 		{
-			JSONTools::ForEachSource(config, [this](nlohmann::json const* json)
+			JSONTools::ForEachSource(objects_config, [this](nlohmann::json const* json)
 			{
 				for (size_t i = 0; i < json->size(); ++i)
 				{
@@ -237,15 +247,9 @@ namespace chaos
 						int object_id = 0;
 						if (JSONTools::GetAttribute(object_json, "OBJECT_ID", object_id))
 						{
-							TMTrigger* trigger = FindObjectByID<TMTrigger>(object_id);
+							TMTrigger* trigger = FindObjectByID<TMTrigger>(object_id); // only the triggers have a state to restore
 							if (trigger != nullptr)
-							{
-								LoadFromJSON(object_json, *trigger); // XXX : the indirection is important to avoid the creation of a new layer_instance
-							}
-							else
-							{
-
-							}
+								LoadFromJSON(object_json, *trigger); // XXX : the indirection is important to avoid the creation of a new object
 						}
 					}
 				}
@@ -269,7 +273,9 @@ namespace chaos
 		if (!JSONSerializableInterface::SerializeIntoJSON(json))
 			return false;
 		JSONTools::SetAttribute(json, "LAYER_ID", GetLayerID());
-		JSONTools::SetAttribute(json, "OBJECTS", objects);
+		// the triggers (the only restored objects) may be saved into a binary snapshot instead (see TMLevelInstance::SaveIntoSnapshot)
+		if (level_instance == nullptr || !level_instance->IsSavingIntoSnapshot())
+			JSONTools::SetAttribute(json, "OBJECTS", objects);
 		JSONTools::SetAttribute(json, "LAYERS", layer_instances);
 		return true;
 	}
@@ -397,7 +403,10 @@ namespace chaos
 		{
 			TMObject* result = factory(geometric_object, in_reference_solver);
 			if (result != nullptr)
+			{
 				objects.push_back(result);
+				InvalidateSpatialIndex();
+			}
 			return result;
 		};
 		return result;
@@ -868,6 +877,19 @@ namespace chaos
 		return result;
 	}
 
+	TMSpatialIndex const* TMLayerInstance::GetSpatialIndex() const
+	{
+		if (!spatial_index_enabled)
+			return nullptr;
+		spatial_index.Update(this);
+		return &spatial_index;
+	}
+
+	void TMLayerInstance::InvalidateSpatialIndex()
+	{
+		spatial_index.Invalidate();
+	}
+
 	size_t TMLayerInstance::GetObjectCount() const
 	{
 		return objects.size();
@@ -909,6 +931,81 @@ namespace chaos
 		size_t count = layer_instances.size();
 		for (size_t i = 0; i < count; ++i)
 			layer_instances[i]->OnLevelStarted();
+		// the state of the triggers once started
+		StartSnapshotTracking();
+	}
+
+	void TMLayerInstance::StartSnapshotTracking()
+	{
+		for (shared_ptr<TMObject> const& object : objects)
+		{
+			if (TMTrigger* trigger = auto_cast(object.get()))
+			{
+				trigger->snapshot_tracking = true;
+				trigger->snapshot_dirty = false;
+				trigger->snapshot_baseline.clear();
+				// the box of a particle master changes without the trigger being notified: capture its state at once
+				if (trigger->IsParticleMaster())
+					if (!trigger->EncodeSnapshotState(trigger->snapshot_baseline))
+						trigger->snapshot_baseline.clear();
+			}
+		}
+	}
+
+	void TMLayerInstance::SaveIntoSnapshot(TiledMap::BinaryWriter& writer) const
+	{
+		//  objects
+		std::vector<uint8_t> state;
+		for (shared_ptr<TMObject> const& object : objects)
+		{
+			if (TMTrigger const* trigger = auto_cast(object.get()))
+			{
+				if (!trigger->IsSnapshotDirty())
+					continue;
+				if (!trigger->EncodeSnapshotState(state) || state == trigger->snapshot_baseline) // nothing to record for triggers back to their level start state
+					continue;
+				writer.Write(int32_t(GetLayerID()));
+				writer.Write(int32_t(trigger->GetObjectID()));
+				writer.Write(uint32_t(state.size()));
+				writer.WriteData(state.data(), state.size());
+			}
+		}
+		// child layers
+		for (shared_ptr<TMLayerInstance> const& layer_instance : layer_instances)
+			layer_instance->SaveIntoSnapshot(writer);
+	}
+
+	bool TMLayerInstance::LoadFromSnapshot(TMSnapshotRecords const& records)
+	{
+		bool result = true;
+		//  objects
+		for (shared_ptr<TMObject> const& object : objects)
+		{
+			if (TMTrigger* trigger = auto_cast(object.get()))
+			{
+				// the trigger was modified at save time
+				auto it = records.find({ GetLayerID(), trigger->GetObjectID() });
+				if (it != records.end())
+				{
+					if (!trigger->DecodeSnapshotState(it->second))
+					{
+						Log::Error("TMLayerInstance::LoadFromSnapshot: cannot decode the state of object %d in layer %d", trigger->GetObjectID(), GetLayerID());
+						result = false; // restore the other objects anyway
+					}
+				}
+				// the trigger was in its level start state at save time
+				else if (trigger->IsSnapshotDirty() && !trigger->snapshot_baseline.empty())
+				{
+					if (trigger->DecodeSnapshotState(trigger->snapshot_baseline))
+						trigger->snapshot_dirty = false;
+				}
+			}
+		}
+		// child layers
+		for (shared_ptr<TMLayerInstance> const& layer_instance : layer_instances)
+			if (!layer_instance->LoadFromSnapshot(records))
+				result = false;
+		return result;
 	}
 
 }; // namespace chaos
@@ -116,6 +116,7 @@ namespace chaos
 					collision_type = CollisionType::AGAIN;
 
 			// trigger event
+			trigger->SetSnapshotDirty(); // the trigger may change its state on collision
 			if (trigger->OnCollisionEvent(delta_time, object, collision_type))
 			{
 				if (trigger->IsTriggerOnce() && !trigger->enter_event_triggered)
@@ -132,7 +133,10 @@ namespace chaos
 			for (size_t i = 0; i < previous_count; ++i)
 			{
 				if (std::find(new_collisions.triggers.begin(), new_collisions.triggers.end(), previous_collisions->triggers[i]) == new_collisions.triggers.end()) // no more colliding
+				{
+					previous_collisions->triggers[i]->SetSnapshotDirty();
 					previous_collisions->triggers[i]->OnCollisionEvent(delta_time, object, CollisionType::FINISHED);
+				}
 			}
 		}
 
@@ -474,12 +478,32 @@ namespace chaos
 	{
 		std::string const* background_material = nullptr;
 		std::string const* background_texture = nullptr;
+		std::string const* background_image = nullptr;
 
 		TMLevel const* level = GetLevel();
 		if (level != nullptr)
 		{
 			background_material = level->GetTiledMap()->FindPropertyString("BACKGROUND_MATERIAL");
 			background_texture = level->GetTiledMap()->FindPropertyString("BACKGROUND_TEXTURE");
+			background_image = level->GetTiledMap()->FindPropertyString("BACKGROUND_IMAGE"); // a file relative to the map
+		}
+
+		// an image file is loaded asynchronously so that the level starts at once (the background stays transparent until uploaded)
+		if (background_image != nullptr)
+		{
+			if (GPUResourceManager* resource_manager = WindowApplication::GetGPUResourceManagerInstance())
+			{
+				FilePathParam path(*background_image, level->GetTiledMap()->GetPath());
+
+				GPUTexture* texture = resource_manager->FindTextureByPath(path.GetResolvedPath());
+				if (texture == nullptr)
+					texture = resource_manager->LoadTextureAsync(path);
+				if (texture != nullptr)
+				{
+					game->CreateBackgroundImageFromTexture((background_material == nullptr) ? nullptr : background_material->c_str(), texture);
+					return;
+				}
+			}
 		}
 
 		game->CreateBackgroundImage(
@@ -551,4 +575,66 @@ namespace chaos
 		return true;
 	}
 
+	// XXX : the snapshot only contains the triggers whose state differs from level start. The other objects have no state to restore and are not saved at all
+	//       Only the triggers notified of a modification since level start are encoded (see TMTrigger::SetSnapshotDirty)
+	//
+	//   'CGCS' | version | { LAYER_ID | OBJECT_ID | size | state encoded in CBOR } until the end of the data
+	//
+
+	/** the magic number at the beginning of checkpoint snapshots */
+	static char const SNAPSHOT_MAGIC[4] = { 'C', 'G', 'C', 'S' };
+	/** the version of the snapshot format */
+	static uint32_t const SNAPSHOT_VERSION = 1;
+
+	bool TMLevelInstance::SaveIntoSnapshot(std::vector<char>& snapshot) const
+	{
+		TiledMap::BinaryWriter writer = TiledMap::BinaryWriter(boost::filesystem::path());
+		writer.WriteData(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+		writer.Write(SNAPSHOT_VERSION);
+		for (shared_ptr<TMLayerInstance> const& layer_instance : layer_instances)
+			layer_instance->SaveIntoSnapshot(writer);
+
+		snapshot = writer.GetData();
+		return true;
+	}
+
+	bool TMLevelInstance::LoadFromSnapshot(std::vector<char> const& snapshot)
+	{
+		TiledMap::BinaryReader reader(Buffer<char>(const_cast<char*>(snapshot.data()), snapshot.size()), boost::filesystem::path());
+
+		char magic[4];
+		uint32_t version = 0;
+		reader.ReadData(magic, sizeof(magic));
+		reader.Read(version);
+		if (!reader.IsValid() || memcmp(magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || version != SNAPSHOT_VERSION)
+		{
+			Log::Error("TMLevelInstance::LoadFromSnapshot: invalid snapshot");
+			return false;
+		}
+
+		// read all records before modifying any object
+		TMSnapshotRecords records;
+		while (!reader.IsEOF())
+		{
+			int32_t layer_id = 0;
+			int32_t object_id = 0;
+			uint32_t size = 0;
+			reader.Read(layer_id);
+			reader.Read(object_id);
+			if (!reader.ReadCount(size) || !reader.IsValid())
+			{
+				Log::Error("TMLevelInstance::LoadFromSnapshot: truncated snapshot");
+				return false;
+			}
+			records[{ int(layer_id), int(object_id) }] = std::span<uint8_t const>((uint8_t const*)reader.GetCurrentPosition(), size);
+			reader.Advance(size);
+		}
+
+		bool result = true;
+		for (shared_ptr<TMLayerInstance> const& layer_instance : layer_instances)
+			if (!layer_instance->LoadFromSnapshot(records))
+				result = false;
+		return result;
+	}
+
 }; // namespace chaos
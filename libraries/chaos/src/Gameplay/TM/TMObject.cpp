@@ -16,6 +16,20 @@ namespace chaos
 		return result;
 	}
 
+	void TMObject::SetPosition(glm::vec2 const& in_position)
+	{
+		GameEntity::SetPosition(in_position);
+		if (layer_instance != nullptr)
+			layer_instance->InvalidateSpatialIndex();
+	}
+
+	void TMObject::SetBoundingBox(box2 const& in_bounding_box)
+	{
+		GameEntity::SetBoundingBox(in_bounding_box);
+		if (layer_instance != nullptr)
+			layer_instance->InvalidateSpatialIndex();
+	}
+
 	bool TMObject::Initialize(TMLayerInstance* in_layer_instance, TiledMap::GeometricObject const* in_geometric_object, TMObjectReferenceSolver& reference_solver)
 	{
 		// ensure not already initialized
@@ -42,6 +56,8 @@ namespace chaos
 		JSONTools::GetAttribute(config, "NAME", name);
 		JSONTools::GetAttribute(config, "OBJECT_ID", id);
 		JSONTools::GetAttribute(config, "PARTICLE_OWNERSHIP", particle_ownership);
+		if (layer_instance != nullptr)
+			layer_instance->InvalidateSpatialIndex(); // the bounding box may have changed
 		return true;
 	}
 
@@ -94,6 +110,7 @@ namespace chaos
 
 	bool TMTrigger::SerializeFromJSON(JSONReadConfiguration config)
 	{
+		SetSnapshotDirty();
 		if (!TMObject::SerializeFromJSON(config))
 			return false;
 		JSONTools::GetAttribute(config, "ENABLED", enabled);
@@ -132,14 +149,62 @@ namespace chaos
 
 	void TMTrigger::SetEnabled(bool in_enabled)
 	{
+		SetSnapshotDirty();
 		enabled = in_enabled;
 	}
 
 	void TMTrigger::SetTriggerOnce(bool in_trigger_once)
 	{
+		SetSnapshotDirty();
 		trigger_once = in_trigger_once;
 	}
 
+	void TMTrigger::SetPosition(glm::vec2 const& in_position)
+	{
+		SetSnapshotDirty();
+		TMObject::SetPosition(in_position);
+	}
+
+	void TMTrigger::SetBoundingBox(box2 const& in_bounding_box)
+	{
+		SetSnapshotDirty();
+		TMObject::SetBoundingBox(in_bounding_box);
+	}
+
+	void TMTrigger::SetRotation(float in_rotation)
+	{
+		SetSnapshotDirty();
+		TMObject::SetRotation(in_rotation);
+	}
+
+	void TMTrigger::SetSnapshotDirty()
+	{
+		// the state before the very first modification is the state at level start
+		if (snapshot_tracking && snapshot_baseline.empty())
+			if (!EncodeSnapshotState(snapshot_baseline))
+				snapshot_baseline.clear();
+		snapshot_dirty = true;
+	}
+
+	bool TMTrigger::EncodeSnapshotState(std::vector<uint8_t>& result) const
+	{
+		result.clear();
+		// the JSON is the reference, so that the overrides of SerializeIntoJSON(...) are taken into account
+		nlohmann::json json;
+		if (!SaveIntoJSON(&json, *this))
+			return false;
+		nlohmann::json::to_cbor(json, result);
+		return true;
+	}
+
+	bool TMTrigger::DecodeSnapshotState(std::span<uint8_t const> data)
+	{
+		nlohmann::json json = nlohmann::json::from_cbor(data.begin(), data.end(), true, false); // no exception
+		if (json.is_discarded())
+			return false;
+		return LoadFromJSON(&json, *this); // XXX : the indirection is important to avoid the creation of a new object
+	}
+
 	// =============================================================
 	// TiledMapCheckPointTriggerObject implementation
 	// =============================================================
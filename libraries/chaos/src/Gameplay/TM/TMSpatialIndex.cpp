@@ -0,0 +1,184 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// =====================================
+	// TMSpatialGrid implementation
+	// =====================================
+
+	void TMSpatialGrid::Clear(float in_cell_size)
+	{
+		assert(in_cell_size > 0.0f);
+		cell_size = in_cell_size;
+		cells.clear();
+		oversized_keys.clear();
+	}
+
+	uint64_t TMSpatialGrid::GetCellKey(int x, int y)
+	{
+		return (uint64_t(uint32_t(x)) << 32) | uint64_t(uint32_t(y));
+	}
+
+	bool TMSpatialGrid::GetCellRange(box2 const& box, glm::ivec2& min_cell, glm::ivec2& max_cell) const
+	{
+		if (IsGeometryEmpty(box))
+			return false;
+		// the range is inclusive so that boxes touching on a cell border share at least one cell
+		std::pair<glm::vec2, glm::vec2> corners = GetBoxCorners(box);
+		glm::vec2 min_coord = glm::floor(corners.first / cell_size);
+		glm::vec2 max_coord = glm::floor(corners.second / cell_size);
+		if (!std::isfinite(min_coord.x) || !std::isfinite(min_coord.y) || !std::isfinite(max_coord.x) || !std::isfinite(max_coord.y))
+			return false;
+		// clamp before the conversion (out of range float to int conversion is undefined)
+		float const limit = float(MAX_CELL_COORDINATE);
+		min_cell = glm::ivec2(glm::clamp(min_coord, -limit, limit));
+		max_cell = glm::ivec2(glm::clamp(max_coord, -limit, limit));
+		return true;
+	}
+
+	void TMSpatialGrid::Insert(box2 const& box, uint64_t key)
+	{
+		glm::ivec2 min_cell;
+		glm::ivec2 max_cell;
+		if (!GetCellRange(box, min_cell, max_cell))
+			return;
+
+		uint64_t range_count = uint64_t(max_cell.x - min_cell.x + 1) * uint64_t(max_cell.y - min_cell.y + 1);
+		if (range_count > MAX_CELLS_PER_ELEMENT)
+		{
+			oversized_keys.push_back(key);
+			return;
+		}
+
+		for (int y = min_cell.y; y <= max_cell.y; ++y)
+			for (int x = min_cell.x; x <= max_cell.x; ++x)
+				cells[GetCellKey(x, y)].push_back(key);
+	}
+
+	void TMSpatialGrid::Query(box2 const& box, std::vector<uint64_t>& result) const
+	{
+		result.clear();
+
+		glm::ivec2 min_cell;
+		glm::ivec2 max_cell;
+		if (!GetCellRange(box, min_cell, max_cell))
+			return;
+
+		// the elements that are too big to be stored in the cells are always candidates
+		result.insert(result.end(), oversized_keys.begin(), oversized_keys.end());
+
+		// for huge requests, iterating over the non empty cells is cheaper
+		uint64_t range_count = uint64_t(max_cell.x - min_cell.x + 1) * uint64_t(max_cell.y - min_cell.y + 1);
+		if (range_count > cells.size())
+		{
+			for (auto const& [cell_key, keys] : cells)
+			{
+				int x = int(uint32_t(cell_key >> 32));
+				int y = int(uint32_t(cell_key & 0xFFFFFFFF));
+				if (x >= min_cell.x && x <= max_cell.x && y >= min_cell.y && y <= max_cell.y)
+					result.insert(result.end(), keys.begin(), keys.end());
+			}
+		}
+		else
+		{
+			for (int y = min_cell.y; y <= max_cell.y; ++y)
+			{
+				for (int x = min_cell.x; x <= max_cell.x; ++x)
+				{
+					auto it = cells.find(GetCellKey(x, y));
+					if (it != cells.end())
+						result.insert(result.end(), it->second.begin(), it->second.end());
+				}
+			}
+		}
+		// elements overlapping several cells are found several times. Keep the original iteration order
+		std::sort(result.begin(), result.end());
+		result.erase(std::unique(result.begin(), result.end()), result.end());
+	}
+
+	// =====================================
+	// TMSpatialIndex implementation
+	// =====================================
+
+	void TMSpatialIndex::SetCellSize(float in_cell_size)
+	{
+		assert(in_cell_size > 0.0f);
+		if (cell_size != in_cell_size)
+		{
+			cell_size = in_cell_size;
+			dirty = true;
+		}
+	}
+
+	bool TMSpatialIndex::IsUpToDate(TMLayerInstance const* layer_instance) const
+	{
+		if (dirty)
+			return false;
+		if (indexed_offset != layer_instance->GetLayerOffset())
+			return false;
+		// the objects set the dirty flag themselves. Only the particles are to be checked
+		ParticleLayerBase const* particle_layer = layer_instance->GetParticleLayer();
+		if (particle_layer != indexed_particle_layer)
+			return false;
+		if (particle_layer != nullptr && particle_layer->GetContentRevision() != indexed_particle_revision)
+			return false;
+		return true;
+	}
+
+	void TMSpatialIndex::Update(TMLayerInstance const* layer_instance)
+	{
+		assert(layer_instance != nullptr);
+		if (!IsUpToDate(layer_instance))
+			Build(layer_instance);
+	}
+
+	void TMSpatialIndex::Build(TMLayerInstance const* layer_instance)
+	{
+		particle_grid.Clear(cell_size);
+		object_grid.Clear(cell_size);
+		indexed_offset = layer_instance->GetLayerOffset();
+		indexed_particle_layer = layer_instance->GetParticleLayer();
+		indexed_particle_revision = 0;
+
+		// index the particles
+		if (ParticleLayerBase const* particle_layer = indexed_particle_layer)
+		{
+			indexed_particle_revision = particle_layer->GetContentRevision();
+
+			size_t allocation_count = particle_layer->GetAllocationCount();
+			for (size_t i = 0; i < allocation_count; ++i)
+			{
+				ParticleAllocationBase const* allocation = particle_layer->GetAllocation(i);
+				if (allocation == nullptr)
+					continue;
+
+				ParticleConstAccessor<TMParticle> accessor = allocation->GetParticleConstAccessor<TMParticle>();
+				size_t particle_count = accessor.GetDataCount();
+				for (size_t j = 0; j < particle_count; ++j)
+					particle_grid.Insert(accessor[j].bounding_box, MakeParticleKey(i, j));
+			}
+		}
+
+		// index the objects
+		size_t object_count = layer_instance->GetObjectCount();
+		for (size_t i = 0; i < object_count; ++i)
+			if (TMObject const* object = layer_instance->GetObject(i))
+				object_grid.Insert(object->GetBoundingBox(true), uint64_t(i));
+
+		dirty = false;
+	}
+
+	void TMSpatialIndex::QueryParticles(box2 const& box, std::vector<uint64_t>& result) const
+	{
+		assert(!dirty);
+		particle_grid.Query(box, result);
+	}
+
+	void TMSpatialIndex::QueryObjects(box2 const& box, std::vector<uint64_t>& result) const
+	{
+		assert(!dirty);
+		object_grid.Query(box, result);
+	}
+
+}; // namespace chaos
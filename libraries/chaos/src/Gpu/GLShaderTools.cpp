@@ -41,7 +41,10 @@ namespace chaos
 
 				glProgramBinary(result, binary_format, buffer.data + sizeof(GLenum), (GLsizei)buffer.bufsize - sizeof(GLenum));
 				if (CheckProgramStatus(result, GL_LINK_STATUS, "Program from binary failure") != GL_TRUE)
+				{
 					glDeleteProgram(result);
+					result = 0;
+				}
 			}
 			return result;
 		}
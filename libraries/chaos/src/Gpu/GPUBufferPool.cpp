@@ -4,27 +4,72 @@
 namespace chaos
 {
 
-    bool GPUBufferPoolEntries::GetBuffer(size_t required_size, size_t max_accepted_size, shared_ptr<GPUBuffer>& result) // use shared pointer to avoid the buffer destruction when removed from vector<>
+    shared_ptr<GPUBuffer> GPUBufferPoolEntries::GetBuffer(size_t size_class) // use shared pointer to avoid the buffer destruction when removed from container
+    {
+        if (size_class >= size_classes.size() || size_classes[size_class].size() == 0)
+            return nullptr;
+        // the most recently given buffer
+        shared_ptr<GPUBuffer> result = std::move(size_classes[size_class].back().first);
+        size_classes[size_class].pop_back();
+        --buffer_count;
+        return result;
+    }
+
+    void GPUBufferPoolEntries::InsertBuffer(GPUBuffer* buffer, uint64_t stamp)
+    {
+        size_t size_class = GPUBufferPool::GetBufferSizeClass(buffer->GetBufferSize());
+        if (size_class >= size_classes.size())
+            size_classes.resize(size_class + 1);
+        size_classes[size_class].push_back({ buffer, stamp });
+        ++buffer_count;
+    }
+
+    shared_ptr<GPUBuffer> GPUBufferPoolEntries::RemoveOldestBuffer()
+    {
+        // each size class is ordered by stamp, the oldest is the first of some class
+        std::deque<stamped_buffer>* oldest = nullptr;
+        for (std::deque<stamped_buffer>& size_class : size_classes)
+            if (size_class.size() > 0)
+                if (oldest == nullptr || size_class.front().second < oldest->front().second)
+                    oldest = &size_class;
+        if (oldest == nullptr)
+            return nullptr;
+
+        shared_ptr<GPUBuffer> result = std::move(oldest->front().first);
+        oldest->pop_front();
+        --buffer_count;
+        return result;
+    }
+
+    // XXX : the size class is made of the position of the leading one and the SIZE_CLASS_BITS bits below it
+    //       with SIZE_CLASS_BITS = 2 : 256, 320, 384, 448, 512, 640, 768, 896, 1024 ...
+
+    static constexpr size_t MIN_BUFFER_SIZE_BIT = std::bit_width(GPUBufferPool::MIN_BUFFER_SIZE) - 1;
+
+    size_t GPUBufferPool::GetBufferSizeClass(size_t buffer_size)
+    {
+        assert(buffer_size >= MIN_BUFFER_SIZE);
+        size_t leading_bit = std::bit_width(buffer_size) - 1;
+        size_t sub_class = (buffer_size >> (leading_bit - SIZE_CLASS_BITS)) & ((size_t(1) << SIZE_CLASS_BITS) - 1);
+        return ((leading_bit - MIN_BUFFER_SIZE_BIT) << SIZE_CLASS_BITS) + sub_class;
+    }
+
+    size_t GPUBufferPool::GetRequestSizeClass(size_t required_size)
     {
         assert(required_size > 0);
+        if (required_size <= MIN_BUFFER_SIZE)
+            return 0;
+        size_t result = GetBufferSizeClass(required_size);
+        if (GetSizeClassSize(result) < required_size)
+            ++result;
+        return result;
+    }
 
-        size_t count = buffers.size();
-        for (size_t i = 0; i < count; ++i)
-        {
-            GPUBuffer * buffer = buffers[i].get();
-            // buffer too small ?
-            size_t buffer_size = buffer->GetBufferSize();
-            if (buffer_size < required_size)
-                continue;
-            // or too big ?
-            if (max_accepted_size > 0 && buffer_size > max_accepted_size) // we do not want to waste to much memory => that why we use a max_accepted_size
-                continue;
-            // buffer found
-            result = buffer;
-            buffers.erase(buffers.begin() + i);
-            return true;
-        }
-        return false;
+    size_t GPUBufferPool::GetSizeClassSize(size_t size_class)
+    {
+        size_t leading_bit = MIN_BUFFER_SIZE_BIT + (size_class >> SIZE_CLASS_BITS);
+        size_t sub_class = size_class & ((size_t(1) << SIZE_CLASS_BITS) - 1);
+        return ((size_t(1) << SIZE_CLASS_BITS) + sub_class) << (leading_bit - SIZE_CLASS_BITS);
     }
 
     bool GPUBufferPool::GiveBuffer(GPUBuffer * buffer, GPUFence* fence)
@@ -34,13 +79,19 @@ namespace chaos
         assert(buffer->GetUsageCount() == 0);
 #if _DEBUG // ensure no duplication
         for (GPUBufferPoolEntries const& entry : entries)
-            for (auto const& entry_buffer : entry.buffers)
-                assert(entry_buffer != buffer);
+            for (auto const& size_class : entry.size_classes)
+                for (auto const& entry_buffer : size_class)
+                    assert(entry_buffer.first != buffer);
 #endif
+        if (buffer->GetBufferSize() < MIN_BUFFER_SIZE) // too small to serve any request
+            return false;
         GPUBufferPoolEntries* cache_entry = GetCacheEntryForFence(fence);
         if (cache_entry == nullptr)
             return false;
-        cache_entry->buffers.push_back(buffer);
+        cache_entry->InsertBuffer(buffer, next_stamp++);
+        stats.cached_bytes += buffer->GetBufferSize();
+        // the budget may be exceeded
+        EnforceMemoryBudget();
         return true;
     }
 
@@ -48,10 +99,7 @@ namespace chaos
     {
         assert(required_size > 0);
 
-        // compute the maximum size we want
-        size_t max_accepted_size = 0;
-        if (rejected_size_percentage > 0)
-            max_accepted_size = ((100 + rejected_size_percentage) * required_size) / 100;
+        size_t size_class = GetRequestSizeClass(required_size);
 
         // the buffer is ordered from older FENCE to youngest FENCE
         for (size_t i = 0; i < entries.size(); ++i)
@@ -67,18 +115,77 @@ namespace chaos
                     break;
             }
             // search a buffer valid for given fence
-            entry.GetBuffer(required_size, max_accepted_size, result);
+            result = entry.GetBuffer(size_class);
             // remove empty entries
-            if (entry.buffers.size() == 0)
+            if (entry.buffer_count == 0)
             {
                 entries.erase(entries.begin() + i);
                 --i;
             }
             // return the buffer if OK
             if (result != nullptr)
+            {
+                size_t buffer_size = result->GetBufferSize();
+                stats.cached_bytes -= buffer_size;
+                stats.wasted_bytes += buffer_size - required_size;
+                ++stats.hit_count;
                 return true;
+            }
+        }
+        // create a buffer with the size of the class so that it can be reused for any request of the same size class
+        if (!CreateBuffer(GetSizeClassSize(size_class), result))
+            return false;
+        stats.allocated_bytes += result->GetBufferSize();
+        stats.wasted_bytes += result->GetBufferSize() - required_size;
+        ++stats.miss_count;
+        return true;
+    }
+
+    void GPUBufferPool::SetMemoryBudget(size_t in_memory_budget)
+    {
+        memory_budget = in_memory_budget;
+        EnforceMemoryBudget();
+    }
+
+    void GPUBufferPool::ResetStats()
+    {
+        size_t cached_bytes = stats.cached_bytes;
+        stats = {};
+        stats.cached_bytes = cached_bytes;
+    }
+
+    void GPUBufferPool::EnforceMemoryBudget()
+    {
+        if (memory_budget == 0)
+            return;
+
+        while (stats.cached_bytes > memory_budget)
+        {
+            // search the least recently given buffer among all entries
+            GPUBufferPoolEntries* oldest_entry = nullptr;
+            uint64_t oldest_stamp = std::numeric_limits<uint64_t>::max();
+            for (GPUBufferPoolEntries& entry : entries)
+                for (auto const& size_class : entry.size_classes)
+                    if (size_class.size() > 0 && size_class.front().second < oldest_stamp)
+                    {
+                        oldest_stamp = size_class.front().second;
+                        oldest_entry = &entry;
+                    }
+            if (oldest_entry == nullptr)
+                break;
+
+            // destroy the buffer (the GL object is released once the GPU is done with it)
+            shared_ptr<GPUBuffer> buffer = oldest_entry->RemoveOldestBuffer();
+            stats.cached_bytes -= buffer->GetBufferSize();
+            ++stats.evicted_count;
         }
-        return CreateBuffer(required_size, result);
+
+        // remove empty entries
+        auto it = std::remove_if(entries.begin(), entries.end(), [](GPUBufferPoolEntries const& entry)
+        {
+            return (entry.buffer_count == 0);
+        });
+        entries.erase(it, entries.end());
     }
 
     GPUBufferPoolEntries* GPUBufferPool::GetCacheEntryForFence(GPUFence* fence)
@@ -105,4 +212,3 @@ namespace chaos
     }
 
 }; // namespace chaos
-
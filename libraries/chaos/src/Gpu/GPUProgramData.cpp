@@ -5,17 +5,57 @@ namespace chaos
 {
 	// utility
 
+	/** a transparent hash so that names can be searched without constructing a std::string */
+	class GPUVariableNameHash
+	{
+	public:
+
+		using is_transparent = void;
+
+		size_t operator ()(std::string_view name) const
+		{
+			return std::hash<std::string_view>()(name);
+		}
+	};
+
+	int GetGPUVariableNameID(char const* name)
+	{
+		if (StringTools::IsEmpty(name))
+			return -1;
+
+		static std::shared_mutex mutex;
+		static std::unordered_map<std::string, int, GPUVariableNameHash, std::equal_to<>> name_ids;
+
+		std::string_view name_view = name;
+		// the names are registered once. Next requests only need a shared lock
+		{
+			std::shared_lock<std::shared_mutex> lock(mutex);
+			auto it = name_ids.find(name_view);
+			if (it != name_ids.end())
+				return it->second;
+		}
+		std::unique_lock<std::shared_mutex> lock(mutex);
+		return name_ids.try_emplace(std::string(name_view), int(name_ids.size())).first->second; // another thread may have registered the name in between
+	}
+
+	template<typename UNIFORM_TYPE>
+	static void SetUniformIfChanged(GLUniformInfo const& uniform, UNIFORM_TYPE const& value)
+	{
+		if (!uniform.CheckAndCacheValue(&value, sizeof(value))) // skip the GL call whenever the program already has this value
+			GLTools::SetUniform(uniform.location, value);
+	}
+
 	template<typename UNIFORM_COMPONENT_TYPE, typename T>
 	static bool SetUniformVectorImplHelper(GLUniformInfo const& uniform, T const& value, int arity)
 	{
 		if (arity == 1)
-			GLTools::SetUniform(uniform.location, RecastVector<glm::tvec1<UNIFORM_COMPONENT_TYPE>>(GLMTools::ConvertIntoVector(value))); // when the arity is 1, we force the usage of vec1 because it is simpler than a scalar value
+			SetUniformIfChanged(uniform, RecastVector<glm::tvec1<UNIFORM_COMPONENT_TYPE>>(GLMTools::ConvertIntoVector(value))); // when the arity is 1, we force the usage of vec1 because it is simpler than a scalar value
 		else if (arity == 2)
-			GLTools::SetUniform(uniform.location, RecastVector<glm::tvec2<UNIFORM_COMPONENT_TYPE>>(GLMTools::ConvertIntoVector(value)));
+			SetUniformIfChanged(uniform, RecastVector<glm::tvec2<UNIFORM_COMPONENT_TYPE>>(GLMTools::ConvertIntoVector(value)));
 		else if (arity == 3)
-			GLTools::SetUniform(uniform.location, RecastVector<glm::tvec3<UNIFORM_COMPONENT_TYPE>>(GLMTools::ConvertIntoVector(value)));
+			SetUniformIfChanged(uniform, RecastVector<glm::tvec3<UNIFORM_COMPONENT_TYPE>>(GLMTools::ConvertIntoVector(value)));
 		else if (arity == 4)
-			GLTools::SetUniform(uniform.location, RecastVector<glm::tvec4<UNIFORM_COMPONENT_TYPE>>(GLMTools::ConvertIntoVector(value)));
+			SetUniformIfChanged(uniform, RecastVector<glm::tvec4<UNIFORM_COMPONENT_TYPE>>(GLMTools::ConvertIntoVector(value)));
 		return true;
 	}
 
@@ -48,7 +88,7 @@ namespace chaos
 			return false;
 
 		MATRIX_TYPE mat(value);
-		GLTools::SetUniform(uniform.location, mat);
+		SetUniformIfChanged(uniform, mat);
 
 		return true;
 	}
@@ -97,6 +137,16 @@ namespace chaos
 		return false;
 	}
 
+	bool GLUniformInfo::CheckAndCacheValue(void const* value, size_t size) const
+	{
+		assert(size <= cached_value.size());
+		if (cached_value_size == size && memcmp(cached_value.data(), value, size) == 0)
+			return true;
+		memcpy(cached_value.data(), value, size);
+		cached_value_size = size;
+		return false;
+	}
+
 	// matrix
 
 	bool GLUniformInfo::SetUniform(glm::mat2x3 const & value) const
@@ -283,7 +333,9 @@ namespace chaos
 			return false;
 
 		glBindTextureUnit(sampler_index, texture->GetResourceID()); // shuxxx missing unbind     glGetTextureHandleARB / glMakeTextureHandleResidentARB / glProgramUniformHandleui64ARB !!!!
-		glUniform1i(location, sampler_index);
+		GLint texture_unit = GLint(sampler_index);
+		if (!CheckAndCacheValue(&texture_unit, sizeof(texture_unit))) // the texture binding itself is a context state and cannot be skipped
+			glUniform1i(location, texture_unit);
 
 		return true;
 	}
@@ -440,6 +492,7 @@ namespace chaos
 
 				GLAttributeInfo attribute;
 				attribute.name = ExtractSemanticDataAndName(name, semantic_data, is_array); // try to find a semantic and an index according to the attribute name
+				attribute.name_id = GetGPUVariableNameID(attribute.name.c_str());
 				attribute.array_size = is_array ? array_size : -1;
 				attribute.type = type;
 				attribute.location = location;
@@ -481,6 +534,7 @@ namespace chaos
 
 				GLUniformInfo uniform;
 				uniform.name = ExtractVariableName(name, is_array);
+				uniform.name_id = GetGPUVariableNameID(uniform.name.c_str());
 				uniform.array_size = is_array ? array_size : -1;
 				uniform.type = type;
 				uniform.location = location;
@@ -96,10 +96,8 @@ namespace chaos
 		return 0;
 	}
 
-	GLuint GPUProgramGenerator::DoGenerateShader(ShaderType shader_type, GeneratorSet const & generators, DefinitionSet const & definitions, std::string const & definitions_string) const
+	void GPUProgramGenerator::GatherShaderSources(ShaderType shader_type, GeneratorSet const & generators, DefinitionSet const & definitions, std::string const & definitions_string, std::vector<char const *> & sources, std::vector<Buffer<char>> & buffers) const
 	{
-		bool success = false;
-
 		// shared generators
 		GeneratorSet const * global_generators = nullptr;
 
@@ -107,14 +105,6 @@ namespace chaos
 		if (global_generators_it != shaders.cend())
 			global_generators = &global_generators_it->second;
 
-		// store the 'strings' in one array
-		// store the 'buffers' in a second one
-		//  => we do not want the generated strings to becomes invalid due to buffer destruction
-		//     the second buffer helps us keep the string valid.
-
-		std::vector<char const *> sources;
-		std::vector<Buffer<char>> buffers; // this is important !!!! the GenerateSource(...) function returns Buffer<> whose lifetime is assured because of that
-
 		// extra sources
 		AddFrameworkSources(shader_type, sources, buffers);
 
@@ -152,7 +142,19 @@ namespace chaos
 
 
 		}
+	}
+
+	GLuint GPUProgramGenerator::DoGenerateShader(ShaderType shader_type, GeneratorSet const & generators, DefinitionSet const & definitions, std::string const & definitions_string) const
+	{
+		// store the 'strings' in one array
+		// store the 'buffers' in a second one
+		//  => we do not want the generated strings to becomes invalid due to buffer destruction
+		//     the second buffer helps us keep the string valid.
 
+		std::vector<char const *> sources;
+		std::vector<Buffer<char>> buffers; // this is important !!!! the GenerateSource(...) function returns Buffer<> whose lifetime is assured because of that
+
+		GatherShaderSources(shader_type, generators, definitions, definitions_string, sources, buffers);
 		return DoGenerateShader(shader_type, sources);
 	}
 
@@ -168,6 +170,13 @@ namespace chaos
 		return result;
 	}
 
+	bool GPUProgramGenerator::GetPreLinkProgramCacheKey(std::string& result) const
+	{
+		// derived classes may override PreLinkProgram(...)
+		result = typeid(*this).name();
+		return true;
+	}
+
 	bool GPUProgramGenerator::PreLinkProgram(GLuint program) const
 	{
 		// frag data location (not valid for compute program)
@@ -211,6 +220,234 @@ namespace chaos
 		return result;
 	}
 
+	// ================================================================
+	// Binary cache
+	// ================================================================
+	//
+	//   'CGPB' | version | key | binary format | program binary
+	//
+
+	static char const PROGRAM_BINARY_MAGIC[4] = { 'C', 'G', 'P', 'B' };
+
+	static uint32_t const PROGRAM_BINARY_VERSION = 1;
+
+	boost::filesystem::path GPUProgramGenerator::binary_cache_directory;
+
+	uintmax_t GPUProgramGenerator::binary_cache_max_size = GPUProgramGenerator::DEFAULT_BINARY_CACHE_MAX_SIZE;
+
+	uintmax_t GPUProgramGenerator::binary_cache_size = 0;
+
+	void GPUProgramGenerator::SetBinaryCacheDirectory(FilePathParam const & path)
+	{
+		binary_cache_directory = path.GetResolvedPath();
+		if (!binary_cache_directory.empty())
+		{
+			boost::system::error_code error_code;
+			boost::filesystem::create_directories(binary_cache_directory, error_code);
+			if (error_code)
+			{
+				Log::Error("GPUProgramGenerator::SetBinaryCacheDirectory => failed to create directory [%s]", binary_cache_directory.string().c_str());
+				binary_cache_directory.clear();
+				return;
+			}
+			TrimBinaryCache();
+		}
+	}
+
+	void GPUProgramGenerator::SetBinaryCacheMaxSize(uintmax_t in_max_size)
+	{
+		binary_cache_max_size = in_max_size;
+		if (!binary_cache_directory.empty())
+			TrimBinaryCache();
+	}
+
+	void GPUProgramGenerator::TrimBinaryCache()
+	{
+		class CacheEntry
+		{
+		public:
+
+			boost::filesystem::path path;
+			uintmax_t size = 0;
+			std::time_t time = 0;
+		};
+
+		// collect the entries (temporary files are remains of interrupted writes)
+		std::vector<CacheEntry> entries;
+		binary_cache_size = 0;
+
+		boost::system::error_code error_code;
+		for (boost::filesystem::directory_iterator it(binary_cache_directory, error_code), end; !error_code && it != end; it.increment(error_code))
+		{
+			boost::filesystem::path const & entry_path = it->path();
+			if (entry_path.extension() == ".tmp")
+			{
+				boost::filesystem::remove(entry_path, error_code);
+				error_code.clear();
+				continue;
+			}
+			if (entry_path.extension() != ".bin")
+				continue;
+
+			CacheEntry entry;
+			entry.path = entry_path;
+			entry.size = boost::filesystem::file_size(entry_path, error_code);
+			entry.time = boost::filesystem::last_write_time(entry_path, error_code);
+			if (error_code)
+			{
+				error_code.clear();
+				continue;
+			}
+			binary_cache_size += entry.size;
+			entries.push_back(std::move(entry));
+		}
+		if (binary_cache_size <= binary_cache_max_size)
+			return;
+
+		// remove the least recently used entries (used entries are touched when loaded)
+		std::sort(entries.begin(), entries.end(), [](CacheEntry const & src1, CacheEntry const & src2)
+		{
+			return (src1.time < src2.time);
+		});
+		for (CacheEntry const & entry : entries)
+		{
+			if (binary_cache_size <= binary_cache_max_size)
+				break;
+			if (boost::filesystem::remove(entry.path, error_code))
+				binary_cache_size -= entry.size;
+			error_code.clear();
+		}
+	}
+
+	uint64_t GPUProgramGenerator::GetBinaryCacheKey(std::vector<ShaderSources> const & shader_sources, bool use_default_vertex_shader, std::string const & prelink_key)
+	{
+		// FNV-1a
+		auto update_hash = [](uint64_t hash, void const * data, size_t size)
+		{
+			unsigned char const * bytes = (unsigned char const *)data;
+			for (size_t i = 0; i < size; ++i)
+			{
+				hash ^= uint64_t(bytes[i]);
+				hash *= 1099511628211ULL;
+			}
+			return hash;
+		};
+		// strings are hashed with their terminating zero so that concatenations cannot collide
+		auto update_hash_string = [&update_hash](uint64_t hash, char const * str)
+		{
+			return update_hash(hash, (str != nullptr) ? str : "", (str != nullptr) ? strlen(str) + 1 : 1);
+		};
+
+		uint64_t result = 14695981039346656037ULL;
+		result = update_hash(result, &PROGRAM_BINARY_VERSION, sizeof(PROGRAM_BINARY_VERSION));
+		// a binary is only valid for the driver that produced it
+		result = update_hash_string(result, (char const *)glGetString(GL_VENDOR));
+		result = update_hash_string(result, (char const *)glGetString(GL_RENDERER));
+		result = update_hash_string(result, (char const *)glGetString(GL_VERSION));
+		// the sources (framework sources and definitions included)
+		for (ShaderSources const & sources : shader_sources)
+		{
+			result = update_hash(result, &sources.shader_type, sizeof(sources.shader_type));
+			for (char const * src : sources.sources)
+				result = update_hash_string(result, src);
+		}
+		// the default vertex shader completes the program in GenProgram(...) (its sources must be hashed here as well)
+		result = update_hash(result, &use_default_vertex_shader, sizeof(use_default_vertex_shader));
+		// what is done before the link (bindings ...)
+		result = update_hash_string(result, prelink_key.c_str());
+		return result;
+	}
+
+	boost::filesystem::path GPUProgramGenerator::GetBinaryCachePath(uint64_t key)
+	{
+		return binary_cache_directory / StringTools::Printf("%016llx.bin", (unsigned long long)key);
+	}
+
+	GLuint GPUProgramGenerator::LoadProgramBinary(uint64_t key)
+	{
+		boost::filesystem::path cache_path = GetBinaryCachePath(key);
+		if (!boost::filesystem::exists(cache_path))
+			return 0;
+
+		Buffer<char> buffer = FileTools::LoadFile(cache_path, LoadFileFlag::NO_ERROR_TRACE);
+
+		size_t header_size = sizeof(PROGRAM_BINARY_MAGIC) + sizeof(uint32_t) + sizeof(uint64_t);
+		if (buffer == nullptr || buffer.bufsize <= header_size)
+			return 0;
+
+		uint32_t version = 0;
+		uint64_t file_key = 0;
+		memcpy(&version, buffer.data + sizeof(PROGRAM_BINARY_MAGIC), sizeof(uint32_t));
+		memcpy(&file_key, buffer.data + sizeof(PROGRAM_BINARY_MAGIC) + sizeof(uint32_t), sizeof(uint64_t));
+		if (memcmp(buffer.data, PROGRAM_BINARY_MAGIC, sizeof(PROGRAM_BINARY_MAGIC)) != 0 || version != PROGRAM_BINARY_VERSION || file_key != key)
+			return 0;
+
+		// the driver may reject the binary (driver update with the same version string ...) : the program is compiled again then
+		Buffer<char> program_binary = SharedBufferPolicy<char>::NewBuffer(buffer.bufsize - header_size);
+		if (program_binary == nullptr)
+			return 0;
+		memcpy(program_binary.data, buffer.data + header_size, program_binary.bufsize);
+
+		GLuint result = GLShaderTools::GetProgramFromBinary(program_binary);
+		if (result != 0)
+		{
+			// the eviction removes the least recently used entries first
+			boost::system::error_code error_code;
+			boost::filesystem::last_write_time(cache_path, std::time(nullptr), error_code);
+		}
+		return result;
+	}
+
+	bool GPUProgramGenerator::SaveProgramBinary(GLuint program, uint64_t key)
+	{
+		// some drivers do not support any binary format
+		GLint format_count = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+		if (format_count <= 0)
+			return false;
+
+		Buffer<char> program_binary = GLShaderTools::GetProgramBinary(program);
+		if (program_binary == nullptr || program_binary.bufsize <= sizeof(GLenum))
+			return false;
+
+		// several processes may compile the same program : write into a temporary file first
+		boost::filesystem::path cache_path = GetBinaryCachePath(key);
+		boost::filesystem::path tmp_path = cache_path;
+		tmp_path += StringTools::Printf(".%llx.tmp", (unsigned long long)std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+		bool success = false;
+		{
+			std::ofstream stream(tmp_path.string().c_str(), std::ios::binary);
+			if (stream)
+			{
+				stream.write(PROGRAM_BINARY_MAGIC, sizeof(PROGRAM_BINARY_MAGIC));
+				stream.write((char const *)&PROGRAM_BINARY_VERSION, sizeof(uint32_t));
+				stream.write((char const *)&key, sizeof(uint64_t));
+				stream.write(program_binary.data, program_binary.bufsize);
+				success = !stream.fail();
+			}
+		}
+
+		boost::system::error_code error_code;
+		if (success)
+		{
+			boost::filesystem::rename(tmp_path, cache_path, error_code);
+			success = !error_code;
+		}
+		if (!success)
+		{
+			boost::filesystem::remove(tmp_path, error_code);
+			Log::Error("GPUProgramGenerator::SaveProgramBinary => fail to write [%s]", cache_path.string().c_str());
+			return false;
+		}
+
+		// keep the cache into its budget
+		binary_cache_size += sizeof(PROGRAM_BINARY_MAGIC) + sizeof(uint32_t) + sizeof(uint64_t) + program_binary.bufsize;
+		if (binary_cache_size > binary_cache_max_size)
+			TrimBinaryCache();
+		return true;
+	}
+
 	GLuint GPUProgramGenerator::GenProgram(DefinitionSet const & definitions) const
 	{
 		// early exit
@@ -224,18 +461,12 @@ namespace chaos
 			Log::Error("GPUProgramGenerator::GenProgram(...) cannot create a program with both COMPUTE shader and both RENDER shader");
 			return 0;
 		}
-		// create openGL program
-		GLuint result = glCreateProgram();
-		if (result == 0)
-		{
-			Log::Error("glCreateProgram failed");
-			return 0;
-		}
 		// create a string to contains all definitions
 		std::string definitions_string = DefinitionsToString(definitions);
 
-		// create all shaders
-		bool success = true;
+		// generate the sources of all shaders (the buffers keep the generated sources alive)
+		std::vector<ShaderSources> shader_sources;
+		std::vector<Buffer<char>> buffers;
 
 		bool has_vertex_shader = false;
 		for (auto const & shader_generators : shaders)
@@ -247,19 +478,58 @@ namespace chaos
 			// keep trace whether a vertex shader is provided
 			if (shader_type == ShaderType::VERTEX)
 				has_vertex_shader = true;
-			// generate the shader for this TYPE
-			GLuint shader_id = GenerateShader(result, shader_type, shader_generators.second, definitions, definitions_string);
+
+			ShaderSources & sources = shader_sources.emplace_back();
+			sources.shader_type = shader_type;
+			GatherShaderSources(shader_type, shader_generators.second, definitions, definitions_string, sources.sources, buffers);
+		}
+
+		// a rendering program without vertex shader is completed with the default one
+		bool use_default_vertex_shader = !has_vertex_shader && !has_compute_shader;
+
+		// search the program in the binary cache
+		std::string prelink_key;
+		bool use_binary_cache = !binary_cache_directory.empty() && GetPreLinkProgramCacheKey(prelink_key);
+
+		uint64_t cache_key = 0;
+		if (use_binary_cache)
+		{
+			cache_key = GetBinaryCacheKey(shader_sources, use_default_vertex_shader, prelink_key);
+			if (GLuint result = LoadProgramBinary(cache_key))
+				return result;
+		}
+
+		// create openGL program
+		GLuint result = glCreateProgram();
+		if (result == 0)
+		{
+			Log::Error("glCreateProgram failed");
+			return 0;
+		}
+		if (use_binary_cache)
+			glProgramParameteri(result, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+		// create all shaders
+		bool success = true;
+
+		for (ShaderSources const & sources : shader_sources)
+		{
+			GLuint shader_id = DoGenerateShader(sources.shader_type, sources.sources);
 			if (shader_id == 0)
 			{
 				success = false;
 				break;
 			}
+			// give program the responsability of shader lifetime
+			glAttachShader(result, shader_id);
+			glDeleteShader(shader_id);
 		}
 
 		// complete the program with default vertex shader if not provided
 		// a rendering program requires at least a vertex shader (for Transform & Feedback)
-		if (success && !has_vertex_shader && !has_compute_shader)
+		if (success && use_default_vertex_shader)
 		{
+			// XXX : whatever is attached here must be part of the key computed by GetBinaryCacheKey(...)
 
 
 
@@ -286,6 +556,11 @@ namespace chaos
 			glDeleteProgram(result);
 			result = 0;
 		}
+		// store the program for next executions
+		else if (use_binary_cache)
+		{
+			SaveProgramBinary(result, cache_key);
+		}
 		return result;
 	}
 
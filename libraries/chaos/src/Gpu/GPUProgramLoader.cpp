@@ -12,6 +12,7 @@ namespace chaos
 		[this](GPUProgram* program)
 		{
 			manager->programs.push_back(program);
+			manager->program_index.Invalidate();
 		});
 	}
 
@@ -24,6 +25,7 @@ namespace chaos
 		[this](GPUProgram * program)
 		{
 			manager->programs.push_back(program);
+			manager->program_index.Invalidate();
 		});
 	}
 
@@ -9,7 +9,12 @@ namespace chaos
 
 	bool GPUProgramProviderInterface::ProcessAction(char const* name, GPUProgramAction& action) const
 	{
-		GPUProgramProviderExecutionData execution_data(name, action);
+		return ProcessAction(name, GPUProgramProviderExecutionData::UNRESOLVED_NAME_ID, action); // a single search does not deserve a lookup in the name registry
+	}
+
+	bool GPUProgramProviderInterface::ProcessAction(char const* name, int name_id, GPUProgramAction& action) const
+	{
+		GPUProgramProviderExecutionData execution_data(name, name_id, action);
 		execution_data.top_provider = this;
 
 		// search for explict first ...
@@ -30,13 +35,13 @@ namespace chaos
 	bool GPUProgramProviderInterface::BindUniform(GLUniformInfo const& uniform) const
 	{
 		GPUProgramSetUniformAction action(uniform);
-		return ProcessAction(uniform.name.c_str(), action);
+		return ProcessAction(uniform.name.c_str(), uniform.name_id, action);
 	}
 
 	bool GPUProgramProviderInterface::BindAttribute(GLAttributeInfo const& attribute) const
 	{
 		GPUProgramSetAttributeAction action(attribute);
-		return ProcessAction(attribute.name.c_str(), action);
+		return ProcessAction(attribute.name.c_str(), attribute.name_id, action);
 	}
 
 	bool GPUProgramProviderInterface::DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const
@@ -50,7 +55,7 @@ namespace chaos
 
 	bool GPUProgramProviderTexture::DoProcessAction(GPUProgramProviderExecutionData const & execution_data) const
 	{
-		if (execution_data.Match(handled_name.c_str(), pass_type))
+		if (execution_data.Match(handled_name.c_str(), handled_name_id, pass_type))
 			return execution_data.Process(value.get(), this); // This is the only place where the provider is required (for texture replacement)
 		return false;
 	}
@@ -42,7 +42,13 @@ namespace chaos
 	//
 
 	GPUProgramProviderExecutionData::GPUProgramProviderExecutionData(char const* in_searched_name, GPUProgramAction& in_action, GPUProgramProviderExecutionData const* base_execution) :
+		GPUProgramProviderExecutionData(in_searched_name, UNRESOLVED_NAME_ID, in_action, base_execution)
+	{
+	}
+
+	GPUProgramProviderExecutionData::GPUProgramProviderExecutionData(char const* in_searched_name, int in_searched_name_id, GPUProgramAction& in_action, GPUProgramProviderExecutionData const* base_execution) :
 		searched_name(in_searched_name),
+		searched_name_id(in_searched_name_id),
 		action(in_action)
 	{
 		if (base_execution == nullptr)
@@ -65,6 +71,17 @@ namespace chaos
 		return (StringTools::Strcmp(other_name, searched_name) == 0);
 	}
 
+	bool GPUProgramProviderExecutionData::Match(char const* other_name, int other_name_id, GPUProgramProviderPassType in_pass_type) const
+	{
+		if (searched_name_id == UNRESOLVED_NAME_ID)
+			return Match(other_name, in_pass_type);
+		if (in_pass_type != GetPassType())
+			return false;
+		if (searched_name_id < 0) // empty name
+			return true;
+		return (other_name_id == searched_name_id);
+	}
+
 	bool GPUProgramProviderExecutionData::Process(GPUTexture const* value, GPUProgramProviderInterface const* provider) const
 	{
 		return action.Process(searched_name, value, provider);
@@ -389,7 +389,10 @@ namespace chaos
 		ApplyPathToLoadedResource(result);
 		if (manager != nullptr)
 			if (!StringTools::IsEmpty(result->GetName()))
+			{
 				manager->render_materials.push_back(result);
+				manager->render_material_index.Invalidate();
+			}
 
 		return result;
 	}
@@ -19,9 +19,14 @@ namespace chaos
 
 	void GPUResourceManager::Release()
 	{
+		if (texture_upload_queue != nullptr)
+			texture_upload_queue->CancelRequests();
 		textures.clear();
 		programs.clear();
 		render_materials.clear();
+		texture_index.Invalidate();
+		program_index.Invalidate();
+		render_material_index.Invalidate();
 	}
 
 	size_t GPUResourceManager::GetTextureCount() const
@@ -41,12 +46,12 @@ namespace chaos
 
 	GPUTexture * GPUResourceManager::FindTexture(ObjectRequest request)
 	{
-		return request.FindObject(textures);
+		return request.FindObject(textures, texture_index);
 	}
 
 	GPUTexture const * GPUResourceManager::FindTexture(ObjectRequest request) const
 	{
-		return request.FindObject(textures);
+		return request.FindObject(textures, texture_index);
 	}
 
 	GPUTexture * GPUResourceManager::FindTextureByPath(FilePathParam const & path)
@@ -76,12 +81,12 @@ namespace chaos
 
 	GPUProgram * GPUResourceManager::FindProgram(ObjectRequest request)
 	{
-		return request.FindObject(programs);
+		return request.FindObject(programs, program_index);
 	}
 
 	GPUProgram const * GPUResourceManager::FindProgram(ObjectRequest request) const
 	{
-		return request.FindObject(programs);
+		return request.FindObject(programs, program_index);
 	}
 
 	GPUProgram * GPUResourceManager::FindProgramByPath(FilePathParam const & path)
@@ -111,18 +116,18 @@ namespace chaos
 
 	GPURenderMaterial * GPUResourceManager::FindRenderMaterial(ObjectRequest request)
 	{
-		if (GPURenderMaterial* result = request.FindObject(render_materials))
+		if (GPURenderMaterial* result = request.FindObject(render_materials, render_material_index))
 			return result;
-		if (GPUProgram* program = request.FindObject(programs))
+		if (GPUProgram* program = request.FindObject(programs, program_index))
 			return program->GetDefaultMaterial();
 		return nullptr;
 	}
 
 	GPURenderMaterial const * GPUResourceManager::FindRenderMaterial(ObjectRequest request) const
 	{
-		if (GPURenderMaterial const* result = request.FindObject(render_materials))
+		if (GPURenderMaterial const* result = request.FindObject(render_materials, render_material_index))
 			return result;
-		if (GPUProgram const* program = request.FindObject(programs))
+		if (GPUProgram const* program = request.FindObject(programs, program_index))
 			return program->GetDefaultMaterial();
 		return nullptr;
 	}
@@ -142,6 +147,11 @@ namespace chaos
 		return GPUTextureLoader(this).LoadObject(path, name, texture_parameters);
 	}
 
+	GPUTexture * GPUResourceManager::LoadTextureAsync(FilePathParam const & path, char const * name, GenTextureParameters const & texture_parameters, GPUTextureLoadedFunc callback)
+	{
+		return GPUTextureLoader(this).LoadObjectAsync(path, name, texture_parameters, std::move(callback));
+	}
+
 	GPUProgram * GPUResourceManager::LoadProgram(FilePathParam const & path, char const * name)
 	{
 		return GPUProgramLoader(this).LoadObject(path, name);
@@ -471,6 +481,10 @@ namespace chaos
 
 	bool GPUResourceManager::OnReadConfigurableProperties(JSONReadConfiguration config, ReadConfigurablePropertiesContext context)
 	{
+		size_t texture_upload_budget = 0;
+		if (JSONTools::GetAttribute(config, "texture_upload_budget", texture_upload_budget))
+			if (texture_upload_queue != nullptr)
+				texture_upload_queue->SetFrameByteBudget(texture_upload_budget);
 		return true;
 	}
 
@@ -479,6 +493,10 @@ namespace chaos
 		// super method
 		if (!ResourceManager::DoStartManager())
 			return false;
+		// the queue for asynchronous texture loading
+		texture_upload_queue = new GPUTextureUploadQueue;
+		if (texture_upload_queue == nullptr)
+			return false;
 		// read the properties
 		if (!ReadConfigurableProperties(ReadConfigurablePropertiesContext::INITIALIZATION, false))
 			return false;
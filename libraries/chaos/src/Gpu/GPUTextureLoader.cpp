@@ -14,6 +14,7 @@ namespace chaos
 		[this](GPUTexture* texture)
 		{
 			manager->textures.push_back(texture);
+			manager->texture_index.Invalidate();
 		});
 	}
 
@@ -26,6 +27,20 @@ namespace chaos
 		[this](GPUTexture* texture)
 		{
 			manager->textures.push_back(texture);
+			manager->texture_index.Invalidate();
+		});
+	}
+
+	GPUTexture * GPUTextureLoader::LoadObjectAsync(FilePathParam const & path, char const * name, GenTextureParameters const & parameters, GPUTextureLoadedFunc callback) const
+	{
+		return LoadObjectHelper(path, name, [this, &parameters, &callback](FilePathParam const& path)
+		{
+			return GenTextureObjectAsync(path, parameters, std::move(callback));
+		},
+		[this](GPUTexture* texture)
+		{
+			manager->textures.push_back(texture);
+			manager->texture_index.Invalidate();
 		});
 	}
 
@@ -145,6 +160,22 @@ namespace chaos
 		return result;
 	}
 
+	GPUTexture * GPUTextureLoader::GenTextureObjectAsync(FilePathParam const & path, GenTextureParameters const & parameters, GPUTextureLoadedFunc callback) const
+	{
+		// check for path
+		if (!CheckResourcePath(path))
+			return nullptr;
+		// use the queue of the manager (the one of the application is processed by the main loop)
+		if (manager != nullptr)
+			if (GPUTextureUploadQueue * texture_upload_queue = manager->GetTextureUploadQueue())
+				return texture_upload_queue->AddRequest(path, parameters, std::move(callback));
+		// no queue : synchronous loading
+		GPUTexture * result = GenTextureObject(path, parameters);
+		if (callback)
+			callback(result, result != nullptr);
+		return result;
+	}
+
 	// There are lots of very uncleared referenced for faces orientation
 	// Most of pictures found one GoogleImage do not correspond to OpenGL but DirectX
 	// There are differences between OpenGL & DirectX implementation
@@ -0,0 +1,306 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	//
+	// GPUTextureDecodedImage implementation
+	//
+
+	GPUTextureDecodedImage::GPUTextureDecodedImage(GPUTextureDecodedImage&& src) :
+		bitmap(src.bitmap),
+		image(src.image)
+	{
+		src.bitmap = nullptr;
+		src.image = ImageDescription();
+	}
+
+	GPUTextureDecodedImage::~GPUTextureDecodedImage()
+	{
+		Release();
+	}
+
+	GPUTextureDecodedImage& GPUTextureDecodedImage::operator = (GPUTextureDecodedImage&& src)
+	{
+		if (this != &src)
+		{
+			Release();
+			std::swap(bitmap, src.bitmap);
+			std::swap(image, src.image);
+		}
+		return *this;
+	}
+
+	bool GPUTextureDecodedImage::Decode(Buffer<char> buffer)
+	{
+		Release();
+
+		bitmap = ImageTools::LoadImageFromBuffer(buffer);
+		if (bitmap == nullptr)
+			return false;
+
+		image = ImageTools::GetImageDescription(bitmap);
+		if (!image.IsValid(true) || image.IsEmpty(true) || !GLTextureTools::GetGLPixelFormat(image.pixel_format).IsValid())
+		{
+			Release();
+			return false;
+		}
+		return true;
+	}
+
+	void GPUTextureDecodedImage::Release()
+	{
+		if (bitmap != nullptr)
+		{
+			FreeImage_Unload(bitmap);
+			bitmap = nullptr;
+		}
+		image = ImageDescription();
+	}
+
+	//
+	// GPUTextureUploadRequest implementation
+	//
+
+	void GPUTextureUploadRequest::Decode()
+	{
+		GPUTextureUploadState new_state = GPUTextureUploadState::FAILED;
+		if (GetState() == GPUTextureUploadState::DECODING) // do not work for a canceled request
+		{
+			Buffer<char> buffer = FileTools::LoadFile(path, LoadFileFlag::NO_ERROR_TRACE);
+			if (buffer == nullptr)
+				Log::Error("GPUTextureUploadRequest::Decode: fail to load [%s]", path.string().c_str());
+			else if (decoded_image.Decode(buffer))
+				new_state = GPUTextureUploadState::DECODED;
+			else
+				new_state = GPUTextureUploadState::NOT_AN_IMAGE;
+		}
+		// the request may have been canceled in the meantime
+		GPUTextureUploadState expected_state = GPUTextureUploadState::DECODING;
+		state.compare_exchange_strong(expected_state, new_state, std::memory_order_acq_rel);
+	}
+
+	//
+	// GPUTextureUploadQueue implementation
+	//
+
+	GPUTextureUploadQueue::~GPUTextureUploadQueue()
+	{
+		CancelRequests();
+	}
+
+	GPUTexture* GPUTextureUploadQueue::AddRequest(FilePathParam const& path, GenTextureParameters const& parameters, GPUTextureLoadedFunc callback)
+	{
+		// the placeholder is given to the user at once
+		shared_ptr<GPUTexture> placeholder = GPUTextureLoader().GenTextureObject<PixelBGRA>(1, 1, [](ImageDescription& desc)
+		{
+			ImageTools::FillImageBackground(desc, glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
+		});
+		if (placeholder == nullptr)
+			return nullptr;
+
+		shared_ptr<GPUTextureUploadRequest> request = new GPUTextureUploadRequest;
+		if (request == nullptr)
+			return nullptr;
+		request->path = path.GetResolvedPath();
+		request->parameters = parameters;
+		request->callback = std::move(callback);
+		request->texture = placeholder;
+		requests.push_back(request);
+
+		// decode the file on a worker whenever possible
+		if (JobSystem* job_system = Application::GetJobSystemInstance())
+		{
+			job_system->Schedule([request]()
+			{
+				request->Decode();
+			});
+		}
+		else
+		{
+			request->Decode();
+		}
+		return placeholder.get();
+	}
+
+	void GPUTextureUploadQueue::ProcessUploads()
+	{
+		std::vector<std::pair<shared_ptr<GPUTextureUploadRequest>, bool>> over_requests;
+
+		size_t byte_budget = std::max(frame_byte_budget, size_t(1)); // a null budget still uploads one row per frame
+		for (size_t i = 0; i < requests.size();)
+		{
+			bool success = false;
+			if (ProcessRequest(requests[i].get(), byte_budget, success))
+			{
+				over_requests.emplace_back(std::move(requests[i]), success);
+				requests.erase(requests.begin() + i); // keep the order of the requests
+			}
+			else
+			{
+				++i;
+			}
+		}
+		// the callbacks are called at the very end because they may add new requests
+		NotifyRequests(over_requests);
+	}
+
+	void GPUTextureUploadQueue::CancelRequests()
+	{
+		std::vector<std::pair<shared_ptr<GPUTextureUploadRequest>, bool>> over_requests;
+
+		for (shared_ptr<GPUTextureUploadRequest>& request : requests)
+		{
+			request->state.store(GPUTextureUploadState::CANCELED, std::memory_order_release);
+			if (request->texture_id != 0)
+			{
+				glDeleteTextures(1, &request->texture_id);
+				request->texture_id = 0;
+			}
+			over_requests.emplace_back(std::move(request), false);
+		}
+		requests.clear();
+
+		NotifyRequests(over_requests);
+	}
+
+	bool GPUTextureUploadQueue::ProcessRequest(GPUTextureUploadRequest* request, size_t& byte_budget, bool& success)
+	{
+		GPUTextureUploadState state = request->GetState();
+
+		// still on a worker
+		if (state == GPUTextureUploadState::DECODING)
+			return false;
+
+		// JSON descriptions (skyboxes ...) are loaded the synchronous way
+		if (state == GPUTextureUploadState::NOT_AN_IMAGE)
+		{
+			shared_ptr<GPUTexture> texture = GPUTextureLoader().GenTextureObject(FilePathParam(request->path), request->parameters);
+			if (texture != nullptr)
+				SwapTextures(request->texture.get(), texture.get()); // the destruction of the temporary texture releases the placeholder resource
+			success = (texture != nullptr);
+			return true;
+		}
+
+		// upload some rows
+		if (state == GPUTextureUploadState::DECODED)
+		{
+			if (byte_budget == 0) // the budget is exhausted by previous requests
+				return false;
+			if (UploadRows(request, byte_budget))
+			{
+				if (request->uploaded_row_count < request->decoded_image.GetImageDescription().height)
+					return false;
+				success = FinalizeUpload(request);
+			}
+			else
+			{
+				success = false;
+			}
+			if (request->texture_id != 0)
+			{
+				glDeleteTextures(1, &request->texture_id);
+				request->texture_id = 0;
+			}
+			request->decoded_image.Release();
+			return true;
+		}
+
+		// failure
+		success = false;
+		return true;
+	}
+
+	bool GPUTextureUploadQueue::UploadRows(GPUTextureUploadRequest* request, size_t& byte_budget)
+	{
+		ImageDescription const& image = request->decoded_image.GetImageDescription();
+
+		GLPixelFormat gl_formats = GLTextureTools::GetGLPixelFormat(image.pixel_format);
+		GLenum type = (image.pixel_format.component_type == PixelComponentType::UNSIGNED_CHAR) ?
+			GL_UNSIGNED_BYTE :
+			GL_FLOAT;
+
+		// create the texture storage on first upload
+		if (request->texture_id == 0)
+		{
+			request->target = GLTextureTools::GetTextureTargetFromSize(image.width, image.height, request->parameters.rectangle_texture);
+			glCreateTextures(request->target, 1, &request->texture_id);
+			if (request->texture_id == 0)
+				return false;
+
+			if (request->target == GL_TEXTURE_1D)
+			{
+				int level_count = (request->parameters.reserve_mipmaps) ?
+					GLTextureTools::GetMipmapLevelCount(image.width) :
+					1;
+				glTextureStorage1D(request->texture_id, level_count, gl_formats.internal_format, image.width);
+			}
+			else
+			{
+				int level_count = (request->parameters.reserve_mipmaps) ?
+					GLTextureTools::GetMipmapLevelCount(image.width, image.height) :
+					1;
+				glTextureStorage2D(request->texture_id, level_count, gl_formats.internal_format, image.width, image.height);
+			}
+		}
+
+		// the number of rows that fit the budget (at least one, so that a huge image always progresses)
+		size_t row_size = size_t(image.line_size);
+		int remaining_row_count = image.height - request->uploaded_row_count;
+		int row_count = std::clamp(int(byte_budget / std::max(row_size, size_t(1))), 1, remaining_row_count);
+		byte_budget -= std::min(byte_budget, size_t(row_count) * row_size);
+
+		// the rows of the decoded image are DWORD aligned, so are the first pixels of any row
+		ImageDescription rows = image.GetSubImageDescription(0, request->uploaded_row_count, image.width, row_count);
+
+		char* texture_buffer = GLTextureTools::PrepareGLTextureTransfert(rows);
+		if (texture_buffer == nullptr)
+			return false;
+
+		if (request->target == GL_TEXTURE_1D)
+			glTextureSubImage1D(request->texture_id, 0, 0, image.width, gl_formats.format, type, texture_buffer);
+		else
+			glTextureSubImage2D(request->texture_id, 0, 0, request->uploaded_row_count, image.width, row_count, gl_formats.format, type, texture_buffer);
+
+		request->uploaded_row_count += row_count;
+		return true;
+	}
+
+	bool GPUTextureUploadQueue::FinalizeUpload(GPUTextureUploadRequest* request)
+	{
+		ImageDescription const& image = request->decoded_image.GetImageDescription();
+
+		TextureDescription texture_description;
+		texture_description.type = request->target;
+		texture_description.pixel_format = image.pixel_format;
+		texture_description.width = image.width;
+		texture_description.height = image.height;
+		texture_description.depth = 1;
+
+		// apply parameters (mipmaps are generated once all rows are there)
+		GLTextureTools::GenTextureApplyParameters(request->texture_id, texture_description, request->parameters);
+
+		shared_ptr<GPUTexture> texture = new GPUTexture(request->texture_id, texture_description);
+		if (texture == nullptr)
+			return false;
+		request->texture_id = 0; // now owned by the texture
+
+		SwapTextures(request->texture.get(), texture.get()); // the destruction of the temporary texture releases the placeholder resource
+		return true;
+	}
+
+	void GPUTextureUploadQueue::NotifyRequests(std::vector<std::pair<shared_ptr<GPUTextureUploadRequest>, bool>> const& over_requests)
+	{
+		for (auto const& [request, success] : over_requests)
+			if (request->callback)
+				request->callback(request->texture.get(), success);
+	}
+
+	void GPUTextureUploadQueue::SwapTextures(GPUTexture* texture1, GPUTexture* texture2)
+	{
+		assert(texture1 != nullptr && texture2 != nullptr);
+		std::swap(texture1->texture_id, texture2->texture_id);
+		std::swap(texture1->texture_description, texture2->texture_description);
+	}
+
+}; // namespace chaos
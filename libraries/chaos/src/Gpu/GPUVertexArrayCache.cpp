@@ -4,6 +4,27 @@
 
 namespace chaos
 {
+	// ==================================================================
+	// GPUVertexArrayCacheKeyHash
+	// ==================================================================
+
+	size_t GPUVertexArrayCacheKeyHash::operator ()(GPUVertexArrayCacheKey const& key) const
+	{
+		size_t result = std::hash<GLFWwindow*>()(key.context);
+		auto hash_combine = [&result](size_t value)
+		{
+			result ^= value + 0x9e3779b9 + (result << 6) + (result >> 2);
+		};
+		hash_combine(std::hash<GLuint>()(key.program_id));
+		hash_combine(std::hash<GLuint>()(key.vertex_buffer_id));
+		hash_combine(std::hash<GLuint>()(key.index_buffer_id));
+		hash_combine(std::hash<GLintptr>()(key.vertex_buffer_offset));
+		return result;
+	}
+
+	// ==================================================================
+	// GPUVertexArrayCacheEntry
+	// ==================================================================
 
 	bool GPUVertexArrayCacheEntry::IsValid() const
 	{
@@ -36,6 +57,83 @@ namespace chaos
 		// OK
 		return true;
 	}
+	GPUVertexArrayCacheKey GPUVertexArrayCacheEntry::GetKey() const
+	{
+		GPUVertexArrayCacheKey result;
+		result.context = context;
+		result.program_id = program_id;
+		result.vertex_buffer_id = vertex_buffer_id;
+		result.index_buffer_id = index_buffer_id;
+		result.vertex_buffer_offset = vertex_buffer_offset;
+		return result;
+	}
+
+	// ==================================================================
+	// GPUVertexArrayCacheStatistics
+	// ==================================================================
+
+	float GPUVertexArrayCacheStatistics::GetHitRate() const
+	{
+		uint64_t search_count = hit_count + miss_count;
+		if (search_count == 0)
+			return 0.0f;
+		return float(double(hit_count) / double(search_count));
+	}
+
+	// ==================================================================
+	// GPUVertexArrayCache
+	// ==================================================================
+
+	GPUVertexArrayCacheStatistics GPUVertexArrayCache::global_statistics;
+
+	GPUVertexArrayCache::~GPUVertexArrayCache()
+	{
+		global_statistics.entry_count -= entries.size();
+	}
+
+	GPUVertexArrayCacheStatistics GPUVertexArrayCache::GetStatistics() const
+	{
+		GPUVertexArrayCacheStatistics result;
+		result.entry_count = entries.size();
+		result.hit_count = hit_count;
+		result.miss_count = miss_count;
+		return result;
+	}
+
+	void GPUVertexArrayCache::AddEntry(GPUVertexArrayCacheEntry&& entry)
+	{
+		entry_indices[entry.GetKey()] = entries.size();
+		entries.push_back(std::move(entry));
+		++global_statistics.entry_count;
+	}
+
+	void GPUVertexArrayCache::RemoveEntry(size_t index) const
+	{
+		assert(index < entries.size());
+
+		entry_indices.erase(entries[index].GetKey());
+		if (index != entries.size() - 1)
+		{
+			std::swap(entries[index], entries.back());
+			entry_indices[entries[index].GetKey()] = index;
+		}
+		entries.pop_back();
+		--global_statistics.entry_count;
+	}
+
+	void GPUVertexArrayCache::SweepEntries(size_t count) const
+	{
+		for (size_t i = 0; i < count && entries.size() > 0; ++i)
+		{
+			if (sweep_index >= entries.size())
+				sweep_index = 0;
+			if (!entries[sweep_index].IsValid())
+				RemoveEntry(sweep_index); // the entry moved at this index is checked next
+			else
+				++sweep_index;
+		}
+	}
+
 	GPUVertexArray const* GPUVertexArrayCache::FindVertexArray(GPURenderer* renderer, GPUProgram const* program, GPUBuffer const* vertex_buffer, GPUBuffer const* index_buffer, GLintptr offset) const
 	{
 		GLFWwindow* current_context = glfwGetCurrentContext();
@@ -48,47 +146,37 @@ namespace chaos
 		if (program == nullptr)
 			return nullptr;
 
-		// whether to purge during this pass or not
-		bool purge = false;
-
-		double t = glfwGetTime();
-		if (t - last_purge_time > 10.0)
-		{
-			last_purge_time = t;
-			purge = true;
-		}
+		// remove some invalid entries
+		SweepEntries(4);
 
 		// search matching entry
-		GPUVertexArray const * result = nullptr;
-		for (size_t i = entries.size() ; i > 0 ; --i)
+		GPUVertexArrayCacheKey key;
+		key.context = renderer->GetWindow()->GetGLFWHandler();
+		key.program_id = program->GetResourceID();
+		key.vertex_buffer_id = (vertex_buffer != nullptr) ? vertex_buffer->GetResourceID() : 0;
+		key.index_buffer_id = (index_buffer != nullptr) ? index_buffer->GetResourceID() : 0;
+		key.vertex_buffer_offset = offset;
+
+		auto it = entry_indices.find(key);
+		if (it != entry_indices.end())
 		{
-			size_t index = i - 1;
-
-			// check whether entry is still valid (else swap/pop with last)
-			GPUVertexArrayCacheEntry & entry = entries[index];
-			if (!entry.IsValid())
+			GPUVertexArrayCacheEntry const& entry = entries[it->second];
+			// the OpenGL resources may have been recycled for other objects
+			if (entry.IsValid() &&
+				entry.program == program &&
+				entry.vertex_buffer == vertex_buffer &&
+				entry.index_buffer == index_buffer &&
+				entry.context_window == renderer->GetWindow())
 			{
-				// remove the entry
-				if (index != entries.size() - 1)
-					std::swap(entry, entries[entries.size() - 1]);
-				entries.pop_back();
-			}
-			else if (result == nullptr)
-			{
-				// check whether this is expected entry
-				if (entry.program == program &&
-					entry.vertex_buffer == vertex_buffer &&
-					entry.index_buffer == index_buffer &&
-					entry.context_window == renderer->GetWindow() &&
-					entry.vertex_buffer_offset == offset)
-				{
-					result = entry.vertex_array.get();
-					if (!purge && result != nullptr)
-						return result;
-				}
+				++hit_count;
+				++global_statistics.hit_count;
+				return entry.vertex_array.get();
 			}
+			RemoveEntry(it->second);
 		}
-		return result;
+		++miss_count;
+		++global_statistics.miss_count;
+		return nullptr;
 	}
 
 	GPUVertexArray const * GPUVertexArrayCache::FindOrCreateVertexArray(GPURenderer * renderer, GPUProgram const * program, GPUBuffer const * vertex_buffer, GPUBuffer const * index_buffer, GPUVertexDeclaration const * declaration, GLintptr offset)
@@ -149,14 +237,17 @@ namespace chaos
 			new_entry.vertex_buffer_offset = offset;
 			new_entry.context = renderer->GetWindow()->GetGLFWHandler();
 
-			entries.push_back(std::move(new_entry));
+			AddEntry(std::move(new_entry));
 		});
 		return new_vertex_array.get();
 	}
 
 	void GPUVertexArrayCache::Clear()
 	{
+		global_statistics.entry_count -= entries.size();
 		entries.clear();
+		entry_indices.clear();
+		sweep_index = 0;
 	}
 
 }; // namespace chaos
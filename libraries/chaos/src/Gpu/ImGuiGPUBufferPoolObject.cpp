@@ -0,0 +1,44 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	void ImGuiGPUBufferPoolObject::SetBufferPool(GPUBufferPool* in_buffer_pool)
+	{
+		buffer_pool = in_buffer_pool;
+	}
+
+	int ImGuiGPUBufferPoolObject::GetImGuiWindowFlags() const
+	{
+		return ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_AlwaysAutoResize;
+	}
+
+	void ImGuiGPUBufferPoolObject::OnDrawImGuiContent()
+	{
+		if (buffer_pool != nullptr)
+		{
+			GPUBufferPoolStats const& stats = buffer_pool->GetStats();
+
+			size_t request_count = stats.hit_count + stats.miss_count;
+			float hit_ratio = (request_count > 0) ? 100.0f * float(stats.hit_count) / float(request_count) : 0.0f;
+
+			ImGui::Text("hits            : %d", int(stats.hit_count));
+			ImGui::Text("misses          : %d", int(stats.miss_count));
+			ImGui::Text("hit ratio       : %.1f %%", hit_ratio);
+			ImGui::Text("evicted         : %d", int(stats.evicted_count));
+			ImGui::Separator();
+			ImGui::Text("allocated bytes : %d", int(stats.allocated_bytes));
+			ImGui::Text("cached bytes    : %d", int(stats.cached_bytes));
+			ImGui::Text("wasted bytes    : %d", int(stats.wasted_bytes));
+			ImGui::Text("memory budget   : %d", int(buffer_pool->GetMemoryBudget()));
+			ImGui::Separator();
+			if (ImGui::Button("Reset"))
+				buffer_pool->ResetStats();
+		}
+		else
+		{
+			ImGui::Text("missing call to SetBufferPool(..)");
+		}
+	}
+
+}; // namespace chaos
\ No newline at end of file
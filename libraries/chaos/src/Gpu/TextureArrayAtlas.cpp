@@ -90,7 +90,7 @@ namespace chaos
 			assert(src_folder_info != nullptr);
 
 			// copy name
-			dst_folder_info->SetName(dst_folder_info->GetName());
+			dst_folder_info->SetName(src_folder_info->GetName());
 			dst_folder_info->SetTag(src_folder_info->GetTag());
 			// copy bitmaps and characters
 			dst_folder_info->bitmaps = src_folder_info->bitmaps;
@@ -110,6 +110,8 @@ namespace chaos
 				dst_folder_info->folders.push_back(std::move(std::unique_ptr<FolderInfo>(dst_child_folder)));
 				DoCopyFolder(dst_child_folder, src_child_folder);
 			}
+			// the vectors have been replaced
+			dst_folder_info->InvalidateIndexes();
 			return true;
 		}
 
@@ -109,6 +109,135 @@ namespace chaos
 		return nullptr;
 	}
 
+	// ================================================================
+	// Distance functions
+	// ================================================================
+
+	/** call func(start, end) on ranges of [0, count), in parallel when requested */
+	template<typename FUNC>
+	static void ForEachRange(int count, bool parallel, FUNC func)
+	{
+		int const chunk_size = 32;
+
+		JobSystem* job_system = (parallel) ? Application::GetJobSystemInstance() : nullptr;
+		if (job_system != nullptr)
+		{
+			// ranges are independent from each other
+			job_system->ParallelFor(size_t(count), size_t(chunk_size), [&func](size_t start, size_t end)
+			{
+				func(int(start), int(end));
+			});
+		}
+		else if (count > 0)
+		{
+			func(0, count);
+		}
+	}
+
+	/** integer division rounded toward minus infinity */
+	static int64_t FloorDivision(int64_t a, int64_t b)
+	{
+		assert(b > 0);
+		return (a >= 0) ? a / b : -((-a + b - 1) / b);
+	}
+
+	/** replace a mask by the mask of all pixels whose euclidean distance to an initial pixel is lower or equal to distance */
+	static void ComputeDistanceMask(std::vector<uint8_t>& mask, int width, int height, int distance)
+	{
+		assert(mask.size() == size_t(width) * size_t(height));
+
+		if (distance < 0)
+		{
+			std::fill(mask.begin(), mask.end(), 0);
+			return;
+		}
+		if (distance == 0 || width <= 0 || height <= 0)
+			return;
+
+		// this is an exact euclidean distance transform (Meijster et al.) in O(width * height)
+		// distances greater than distance are clamped : they do not matter and this avoids overflows
+		int const far_distance = distance + 1;
+		int64_t const d2 = int64_t(distance) * int64_t(distance);
+
+		bool parallel = (size_t(width) * size_t(height) >= 256 * 256);
+
+		// step 1 : vertical distance to the nearest initial pixel of the column
+		std::vector<int> g(mask.size());
+		ForEachRange(width, parallel, [&mask, &g, width, height, far_distance](int start, int end)
+		{
+			for (int x = start; x < end; ++x)
+				g[x] = (mask[x] != 0) ? 0 : far_distance;
+			for (int y = 1; y < height; ++y)
+			{
+				int const* previous = &g[size_t(y - 1) * width];
+				int* current = &g[size_t(y) * width];
+				uint8_t const* m = &mask[size_t(y) * width];
+				for (int x = start; x < end; ++x)
+					current[x] = (m[x] != 0) ? 0 : std::min(previous[x] + 1, far_distance);
+			}
+			for (int y = height - 2; y >= 0; --y)
+			{
+				int const* next = &g[size_t(y + 1) * width];
+				int* current = &g[size_t(y) * width];
+				for (int x = start; x < end; ++x)
+					current[x] = std::min(current[x], next[x] + 1);
+			}
+		});
+
+		// step 2 : for each row, the lower envelope of the parabolas (x - i)^2 + g(i)^2
+		ForEachRange(height, parallel, [&mask, &g, width, d2](int start, int end)
+		{
+			std::vector<int> s(width); // the abscissa of the parabolas of the envelope
+			std::vector<int> t(width); // the position where each parabola of the envelope begins
+
+			for (int y = start; y < end; ++y)
+			{
+				int const* row = &g[size_t(y) * width];
+
+				auto f = [row](int64_t x, int64_t i)
+				{
+					return (x - i) * (x - i) + int64_t(row[i]) * int64_t(row[i]);
+				};
+				auto sep = [row](int64_t i, int64_t u)
+				{
+					return FloorDivision(u * u - i * i + int64_t(row[u]) * int64_t(row[u]) - int64_t(row[i]) * int64_t(row[i]), 2 * (u - i));
+				};
+
+				int q = 0;
+				s[0] = 0;
+				t[0] = 0;
+				for (int u = 1; u < width; ++u)
+				{
+					while (q >= 0 && f(t[q], s[q]) > f(t[q], u))
+						--q;
+					if (q < 0)
+					{
+						q = 0;
+						s[0] = u;
+					}
+					else
+					{
+						int64_t w = 1 + sep(s[q], u);
+						if (w < width)
+						{
+							++q;
+							s[q] = u;
+							t[q] = int(w);
+						}
+					}
+				}
+
+				uint8_t* m = &mask[size_t(y) * width];
+				for (int u = width - 1; u >= 0; --u)
+				{
+					m[u] = (f(u, s[q]) <= d2) ? 1 : 0;
+					if (u == t[q])
+						--q;
+				}
+			}
+		});
+	}
+
 	// ================================================================
 	// ImageProcessorOutline functions
 	// ================================================================
@@ -151,44 +280,34 @@ namespace chaos
 				PixelConverter::Convert(outline, o);
 				PixelConverter::Convert(empty, e);
 
-				int d2 = distance * distance;
+				// the pixels to keep (in destination coordinates). A negative distance gives an empty image
+				std::vector<uint8_t> inside(size_t(dest_width) * size_t(dest_height), 0);
+				if (distance >= 0)
+					for (int y = 0; y < src_desc.height; ++y)
+						for (int x = 0; x < src_desc.width; ++x)
+							inside[size_t(y + distance) * dest_width + size_t(x + distance)] = color_filter.Filter(src_accessor(x, y)) ? 1 : 0;
+
+				// the pixels whose distance to a pixel to keep is lower or equal to distance
+				std::vector<uint8_t> mask = inside;
+				ComputeDistanceMask(mask, dest_width, dest_height, distance);
 
 				// all pixels on destination images
-				for (int y = 0; y < dest_height; ++y)
+				ForEachRange(dest_height, (size_t(dest_width) * size_t(dest_height) >= 256 * 256), [&](int start, int end)
 				{
-					for (int x = 0; x < dest_width; ++x)
+					for (int y = start; y < end; ++y)
 					{
-						int src_x = x - distance;
-						int src_y = y - distance;
-
-						// search whether we must add an outline
-						int min_src_x = std::max(0, src_x - distance);
-						int max_src_x = std::min(src_x + distance, src_desc.width - 1);
-
-						int min_src_y = std::max(0, src_y - distance);
-						int max_src_y = std::min(src_y + distance, src_desc.height - 1);
-
-						bool all_neighboor_empty = true;
-						for (int sy = min_src_y; (sy <= max_src_y) && all_neighboor_empty; ++sy)
+						for (int x = 0; x < dest_width; ++x)
 						{
-							for (int sx = min_src_x; (sx <= max_src_x) && all_neighboor_empty; ++sx)
-							{
-								int dx = src_x - sx;
-								int dy = src_y - sy;
-								if (dx * dx + dy * dy <= d2)
-									all_neighboor_empty = !color_filter.Filter(src_accessor(sx, sy));
-							}
+							size_t index = size_t(y) * dest_width + size_t(x);
+							if (mask[index] == 0)
+								dst_accessor(x, y) = empty;
+							else if (inside[index] != 0)
+								dst_accessor(x, y) = src_accessor(x - distance, y - distance);
+							else
+								dst_accessor(x, y) = outline;
 						}
-
-						// put the pixel on destination
-						if (all_neighboor_empty)
-							dst_accessor(x, y) = empty;
-						else if (src_x >= 0 && src_x < src_desc.width && src_y >= 0 && src_y < src_desc.height && color_filter.Filter(src_accessor(src_x, src_y)))
-							dst_accessor(x, y) = src_accessor(src_x, src_y);
-						else
-							dst_accessor(x, y) = outline;
 					}
-				}
+				});
 			}
 			return result;
 		});
@@ -303,9 +422,6 @@ namespace chaos
 			return nullptr;
 		}
 
-		return nullptr;
-#if 0
-
 		return DoImageProcessing(src_desc, [this, src_desc](auto src_accessor) -> FIBITMAP*
 		{
 			if (!src_accessor.IsValid())
@@ -313,8 +429,16 @@ namespace chaos
 
 			using accessor_type = decltype(src_accessor);
 
-			int dest_width = src_desc.width + 2 * distance;
-			int dest_height = src_desc.height + 2 * distance;
+			int shadow_distance = std::max(distance, 0);
+			int offset_x = int(std::round(offset.x));
+			int offset_y = int(std::round(offset.y));
+
+			// the destination contains both the image and its shadow
+			int src_origin_x = shadow_distance + std::max(-offset_x, 0);
+			int src_origin_y = shadow_distance + std::max(-offset_y, 0);
+
+			int dest_width = src_desc.width + std::abs(offset_x) + 2 * shadow_distance;
+			int dest_height = src_desc.height + std::abs(offset_y) + 2 * shadow_distance;
 
 			// generate the image
 			FIBITMAP* result = ImageTools::GenFreeImage(src_desc.pixel_format, dest_width, dest_height);
@@ -332,52 +456,48 @@ namespace chaos
 				PixelRGBAFloat o = color;
 				PixelRGBAFloat e = empty_color;
 
-				pixel_type outline, empty;
-				PixelConverter::Convert(outline, o);
+				pixel_type shadow, empty;
+				PixelConverter::Convert(shadow, o);
 				PixelConverter::Convert(empty, e);
 
-				int d2 = distance * distance;
-
-				// all pixels on destination images
-				for (int y = 0; y < dest_height; ++y)
+				// the pixels to keep and their displaced copy (in destination coordinates)
+				std::vector<uint8_t> inside(size_t(dest_width) * size_t(dest_height), 0);
+				std::vector<uint8_t> mask(size_t(dest_width) * size_t(dest_height), 0);
+				for (int y = 0; y < src_desc.height; ++y)
 				{
-					for (int x = 0; x < dest_width; ++x)
+					for (int x = 0; x < src_desc.width; ++x)
 					{
-						int src_x = x - distance;
-						int src_y = y - distance;
-
-						// search whether we must add an outline
-						int min_src_x = std::max(0, src_x - distance);
-						int max_src_x = std::min(src_x + distance, src_desc.width - 1);
+						if (color_filter.Filter(src_accessor(x, y)))
+						{
+							inside[size_t(y + src_origin_y) * dest_width + size_t(x + src_origin_x)] = 1;
+							mask[size_t(y + src_origin_y + offset_y) * dest_width + size_t(x + src_origin_x + offset_x)] = 1;
+						}
+					}
+				}
 
-						int min_src_y = std::max(0, src_y - distance);
-						int max_src_y = std::min(src_y + distance, src_desc.height - 1);
+				// the shadow spreads around the displaced pixels
+				ComputeDistanceMask(mask, dest_width, dest_height, shadow_distance);
 
-						bool all_neighboor_empty = true;
-						for (int sy = min_src_y; (sy <= max_src_y) && all_neighboor_empty; ++sy)
+				// all pixels on destination images
+				ForEachRange(dest_height, (size_t(dest_width) * size_t(dest_height) >= 256 * 256), [&](int start, int end)
+				{
+					for (int y = start; y < end; ++y)
+					{
+						for (int x = 0; x < dest_width; ++x)
 						{
-							for (int sx = min_src_x; (sx <= max_src_x) && all_neighboor_empty; ++sx)
-							{
-								int dx = src_x - sx;
-								int dy = src_y - sy;
-								if (dx * dx + dy * dy <= d2)
-									all_neighboor_empty = !color_filter.Filter(src_accessor(sx, sy));
-							}
+							size_t index = size_t(y) * dest_width + size_t(x);
+							if (inside[index] != 0)
+								dst_accessor(x, y) = src_accessor(x - src_origin_x, y - src_origin_y);
+							else if (mask[index] != 0)
+								dst_accessor(x, y) = shadow;
+							else
+								dst_accessor(x, y) = empty;
 						}
-
-						// put the pixel on destination
-						if (all_neighboor_empty)
-							dst_accessor(x, y) = empty;
-						else if (src_x >= 0 && src_x < src_desc.width && src_y >= 0 && src_y < src_desc.height && color_filter.Filter(src_accessor(src_x, src_y)))
-							dst_accessor(x, y) = src_accessor(src_x, src_y);
-						else
-							dst_accessor(x, y) = outline;
 					}
-				}
+				});
 			}
 			return result;
 		});
-#endif
 	}
 
 	bool ImageProcessorShadow::SerializeIntoJSON(nlohmann::json * json) const
@@ -385,6 +505,7 @@ namespace chaos
 		if (!ImageProcessor::SerializeIntoJSON(json))
 			return false;
 		JSONTools::SetAttribute(json, "offset", offset);
+		JSONTools::SetAttribute(json, "distance", distance);
 		JSONTools::SetAttribute(json, "color_filter", color_filter);
 		JSONTools::SetAttribute(json, "color", color);
 		JSONTools::SetAttribute(json, "empty_color", empty_color);
@@ -396,6 +517,7 @@ namespace chaos
 		if (!ImageProcessor::SerializeFromJSON(config))
 			return false;
 		JSONTools::GetAttribute(config, "offset", offset);
+		JSONTools::GetAttribute(config, "distance", distance);
 		JSONTools::GetAttribute(config, "color_filter", color_filter);
 		JSONTools::GetAttribute(config, "color", color);
 		JSONTools::GetAttribute(config, "empty_color", empty_color);
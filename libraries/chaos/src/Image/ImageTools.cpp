@@ -274,6 +274,39 @@ namespace chaos
 		return ImageDescription();
 	}
 
+	/** copy a row of pixels (with conversion and reversal), using the optimized kernels when possible */
+	template<typename DST_PIXEL, typename SRC_PIXEL>
+	static void CopyPixelRow(DST_PIXEL* dst, SRC_PIXEL const* src, int count, bool reverse)
+	{
+		if (!reverse)
+		{
+			if constexpr (std::is_same_v<DST_PIXEL, SRC_PIXEL>)
+				memcpy(dst, src, count * sizeof(SRC_PIXEL)); // no conversion to do
+			else if constexpr (HasPixelRowKernel<DST_PIXEL, SRC_PIXEL>)
+				PixelKernels::ConvertRow(dst, src, count);
+			else
+				for (int c = 0; c < count; ++c)
+					PixelConverter::Convert(dst[c], src[c]);
+		}
+		else
+		{
+			if constexpr (std::is_same_v<DST_PIXEL, PixelBGRA> && std::is_same_v<SRC_PIXEL, PixelBGRA>)
+			{
+				PixelKernels::ReverseCopyRow(dst, src, count);
+			}
+			else if constexpr (std::is_same_v<DST_PIXEL, PixelBGRA> && HasPixelRowKernel<DST_PIXEL, SRC_PIXEL>)
+			{
+				PixelKernels::ConvertRow(dst, src, count);
+				PixelKernels::ReverseRow(dst, count);
+			}
+			else
+			{
+				for (int c = 0; c < count; ++c)
+					PixelConverter::Convert(dst[count - 1 - c], src[c]);
+			}
+		}
+	}
+
 	//
 	// To copy pixels and make conversions, we have to
 	//
@@ -306,36 +339,21 @@ namespace chaos
 				// normal copy
 				if (image_transform == ImageTransform::NO_TRANSFORM)
 				{
-					if (boost::is_same<dst_pixel_type, src_pixel_type>::value)
-					{
-						for (int l = 0; l < height; ++l) // optimized version using memcopy, if there is no conversion to do
-						{
-							src_pixel_type const* src_line = &src_acc(src_x, src_y + l);
-							dst_pixel_type		* dst_line = &dst_acc(dst_x, dst_y + l);
-							memcpy(dst_line, src_line, width * sizeof(src_pixel_type));
-						}
-					}
-					else
+					for (int l = 0; l < height; ++l)
 					{
-						for (int l = 0; l < height; ++l)
-						{
-							src_pixel_type const* src_line = &src_acc(src_x, src_y + l);
-							dst_pixel_type		* dst_line = &dst_acc(dst_x, dst_y + l);
-							for (int c = 0; c < width; ++c)
-								PixelConverter::Convert(dst_line[c], src_line[c]);
-						}
+						src_pixel_type const* src_line = &src_acc(src_x, src_y + l);
+						dst_pixel_type		* dst_line = &dst_acc(dst_x, dst_y + l);
+						CopyPixelRow(dst_line, src_line, width, false);
 					}
 				}
 				// copy with central symetry
-				//   no interest to test if source type and dest types are identical because we cannot use memcpy(...) due to symetry
 				else if (image_transform == ImageTransform::CENTRAL_SYMETRY)
 				{
 					for (int l = 0; l < height; ++l)
 					{
 						src_pixel_type const* src_line = &src_acc(src_x, src_y + l);
 						dst_pixel_type		* dst_line = &dst_acc(dst_x, dst_y + height - 1 - l);
-						for (int c = 0; c < width; ++c)
-							PixelConverter::Convert(dst_line[width - 1 - c], src_line[c]);
+						CopyPixelRow(dst_line, src_line, width, true);
 					}
 				}
 				else
@@ -0,0 +1,411 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+// SSE2 is always available on x64. AVX2 is detected at runtime
+#if defined _M_X64 || defined __x86_64__
+#  define CHAOS_PIXEL_KERNELS_X64 1
+#  if defined _MSC_VER
+#    define CHAOS_TARGET_AVX2
+#  else
+#    define CHAOS_TARGET_AVX2 __attribute__((target("avx2")))
+#  endif
+#else
+#  define CHAOS_PIXEL_KERNELS_X64 0
+#endif
+
+namespace chaos
+{
+	// ================================================================
+	// Scalar kernels (the reference implementation)
+	// ================================================================
+
+	template<typename DST_PIXEL, typename SRC_PIXEL>
+	static void ConvertRowScalar(DST_PIXEL* dst, SRC_PIXEL const* src, int count)
+	{
+		for (int i = 0; i < count; ++i)
+			PixelConverter::Convert(dst[i], src[i]);
+	}
+
+	static void ReverseCopyRowScalar(uint32_t* dst, uint32_t const* src, int count)
+	{
+		for (int i = 0; i < count; ++i)
+			dst[i] = src[count - 1 - i];
+	}
+
+	static void ReverseRowScalar(uint32_t* row, int count)
+	{
+		std::reverse(row, row + count);
+	}
+
+#if CHAOS_PIXEL_KERNELS_X64
+
+	// ================================================================
+	// SSE2 kernels
+	// ================================================================
+
+	// BGR to BGRA reading a whole 32 bits word per pixel (the last pixel is handled separately not to read outside the row)
+	static void ConvertRowWord(PixelBGRA* dst, PixelBGR const* src, int count)
+	{
+		if (count <= 0)
+			return;
+		unsigned char const* s = (unsigned char const*)src;
+		uint32_t* d = (uint32_t*)dst;
+		for (int i = 0; i < count - 1; ++i)
+		{
+			uint32_t word;
+			memcpy(&word, s + 3 * i, sizeof(word));
+			d[i] = word | 0xFF000000;
+		}
+		ConvertRowScalar(dst + count - 1, src + count - 1, 1);
+	}
+
+	/** convert 4 floats into 4 integers in [0, 255] the same way than PixelComponentConverter */
+	static inline __m128i FloatToByteSSE2(__m128 value)
+	{
+		__m128 v = _mm_mul_ps(value, _mm_set1_ps(255.0f));
+		v = _mm_min_ps(v, _mm_set1_ps(255.0f)); // same as std::min(255.0f, v) even for NaN
+		v = _mm_max_ps(v, _mm_setzero_ps());
+		return _mm_cvttps_epi32(v);
+	}
+
+	static void ConvertRowSSE2(PixelBGRA* dst, PixelGray const* src, int count)
+	{
+		__m128i alpha = _mm_set1_epi32(0xFF000000);
+
+		int i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i gray = _mm_loadu_si128((__m128i const*)(src + i));
+			__m128i lo = _mm_unpacklo_epi8(gray, gray);
+			__m128i hi = _mm_unpackhi_epi8(gray, gray);
+			_mm_storeu_si128((__m128i*)(dst + i + 0), _mm_or_si128(_mm_unpacklo_epi16(lo, lo), alpha));
+			_mm_storeu_si128((__m128i*)(dst + i + 4), _mm_or_si128(_mm_unpackhi_epi16(lo, lo), alpha));
+			_mm_storeu_si128((__m128i*)(dst + i + 8), _mm_or_si128(_mm_unpacklo_epi16(hi, hi), alpha));
+			_mm_storeu_si128((__m128i*)(dst + i + 12), _mm_or_si128(_mm_unpackhi_epi16(hi, hi), alpha));
+		}
+		ConvertRowScalar(dst + i, src + i, count - i);
+	}
+
+	static void ConvertRowSSE2(PixelBGRA* dst, PixelRGBAFloat const* src, int count)
+	{
+		int i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			float const* s = &src[i].R;
+			// RGBA -> BGRA
+			__m128i p0 = _mm_shuffle_epi32(FloatToByteSSE2(_mm_loadu_ps(s + 0)), _MM_SHUFFLE(3, 0, 1, 2));
+			__m128i p1 = _mm_shuffle_epi32(FloatToByteSSE2(_mm_loadu_ps(s + 4)), _MM_SHUFFLE(3, 0, 1, 2));
+			__m128i p2 = _mm_shuffle_epi32(FloatToByteSSE2(_mm_loadu_ps(s + 8)), _MM_SHUFFLE(3, 0, 1, 2));
+			__m128i p3 = _mm_shuffle_epi32(FloatToByteSSE2(_mm_loadu_ps(s + 12)), _MM_SHUFFLE(3, 0, 1, 2));
+			__m128i bytes = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+			_mm_storeu_si128((__m128i*)(dst + i), bytes);
+		}
+		ConvertRowScalar(dst + i, src + i, count - i);
+	}
+
+	static void ConvertRowSSE2(PixelGray* dst, PixelGrayFloat const* src, int count)
+	{
+		int i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i a = FloatToByteSSE2(_mm_loadu_ps(src + i + 0));
+			__m128i b = FloatToByteSSE2(_mm_loadu_ps(src + i + 4));
+			__m128i c = FloatToByteSSE2(_mm_loadu_ps(src + i + 8));
+			__m128i d = FloatToByteSSE2(_mm_loadu_ps(src + i + 12));
+			__m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+			_mm_storeu_si128((__m128i*)(dst + i), bytes);
+		}
+		ConvertRowScalar(dst + i, src + i, count - i);
+	}
+
+	static void ReverseCopyRowSSE2(uint32_t* dst, uint32_t const* src, int count)
+	{
+		int i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i v = _mm_loadu_si128((__m128i const*)(src + count - i - 4));
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)));
+		}
+		for (; i < count; ++i)
+			dst[i] = src[count - 1 - i];
+	}
+
+	static void ReverseRowSSE2(uint32_t* row, int count)
+	{
+		int left = 0;
+		int right = count;
+		while (right - left >= 8)
+		{
+			__m128i l = _mm_loadu_si128((__m128i const*)(row + left));
+			__m128i r = _mm_loadu_si128((__m128i const*)(row + right - 4));
+			_mm_storeu_si128((__m128i*)(row + left), _mm_shuffle_epi32(r, _MM_SHUFFLE(0, 1, 2, 3)));
+			_mm_storeu_si128((__m128i*)(row + right - 4), _mm_shuffle_epi32(l, _MM_SHUFFLE(0, 1, 2, 3)));
+			left += 4;
+			right -= 4;
+		}
+		std::reverse(row + left, row + right);
+	}
+
+	// ================================================================
+	// AVX2 kernels
+	// ================================================================
+
+	/** convert 8 floats into 8 integers in [0, 255] the same way than PixelComponentConverter */
+	CHAOS_TARGET_AVX2 static inline __m256i FloatToByteAVX2(__m256 value)
+	{
+		__m256 v = _mm256_mul_ps(value, _mm256_set1_ps(255.0f));
+		v = _mm256_min_ps(v, _mm256_set1_ps(255.0f)); // same as std::min(255.0f, v) even for NaN
+		v = _mm256_max_ps(v, _mm256_setzero_ps());
+		return _mm256_cvttps_epi32(v);
+	}
+
+	CHAOS_TARGET_AVX2 static void ConvertRowAVX2(PixelBGRA* dst, PixelBGR const* src, int count)
+	{
+		unsigned char const* s = (unsigned char const*)src;
+
+		__m256i shuffle = _mm256_setr_epi8(
+			0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+			0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+		__m256i alpha = _mm256_set1_epi32(0xFF000000);
+
+		// each lane reads 16 bytes for 4 pixels : keep 2 pixels of margin not to read outside the row
+		int i = 0;
+		for (; i + 10 <= count; i += 8)
+		{
+			__m128i lo = _mm_loadu_si128((__m128i const*)(s + 3 * i));
+			__m128i hi = _mm_loadu_si128((__m128i const*)(s + 3 * i + 12));
+			__m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_or_si256(_mm256_shuffle_epi8(v, shuffle), alpha));
+		}
+		ConvertRowWord(dst + i, src + i, count - i);
+	}
+
+	CHAOS_TARGET_AVX2 static void ConvertRowAVX2(PixelBGR* dst, PixelBGRA const* src, int count)
+	{
+		unsigned char* d = (unsigned char*)dst;
+
+		__m256i shuffle = _mm256_setr_epi8(
+			0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+			0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+		__m256i pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256i v = _mm256_loadu_si256((__m256i const*)(src + i));
+			v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, shuffle), pack); // the 24 first bytes are the 8 pixels
+			_mm_storeu_si128((__m128i*)(d + 3 * i), _mm256_castsi256_si128(v));
+			_mm_storel_epi64((__m128i*)(d + 3 * i + 16), _mm256_extracti128_si256(v, 1));
+		}
+		ConvertRowScalar(dst + i, src + i, count - i);
+	}
+
+	CHAOS_TARGET_AVX2 static void ConvertRowAVX2(PixelBGRA* dst, PixelGray const* src, int count)
+	{
+		__m256i spread = _mm256_set1_epi32(0x00010101);
+		__m256i alpha = _mm256_set1_epi32(0xFF000000);
+
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256i gray = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const*)(src + i)));
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_or_si256(_mm256_mullo_epi32(gray, spread), alpha));
+		}
+		ConvertRowScalar(dst + i, src + i, count - i);
+	}
+
+	CHAOS_TARGET_AVX2 static void ConvertRowAVX2(PixelBGRA* dst, PixelRGBAFloat const* src, int count)
+	{
+		__m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7); // packs work inside each lane
+
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			float const* s = &src[i].R;
+			// RGBA -> BGRA
+			__m256i p01 = _mm256_shuffle_epi32(FloatToByteAVX2(_mm256_loadu_ps(s + 0)), _MM_SHUFFLE(3, 0, 1, 2));
+			__m256i p23 = _mm256_shuffle_epi32(FloatToByteAVX2(_mm256_loadu_ps(s + 8)), _MM_SHUFFLE(3, 0, 1, 2));
+			__m256i p45 = _mm256_shuffle_epi32(FloatToByteAVX2(_mm256_loadu_ps(s + 16)), _MM_SHUFFLE(3, 0, 1, 2));
+			__m256i p67 = _mm256_shuffle_epi32(FloatToByteAVX2(_mm256_loadu_ps(s + 24)), _MM_SHUFFLE(3, 0, 1, 2));
+			__m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(p01, p23), _mm256_packs_epi32(p45, p67));
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_permutevar8x32_epi32(bytes, order));
+		}
+		ConvertRowScalar(dst + i, src + i, count - i);
+	}
+
+	CHAOS_TARGET_AVX2 static void ConvertRowAVX2(PixelGray* dst, PixelGrayFloat const* src, int count)
+	{
+		__m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7); // packs work inside each lane
+
+		int i = 0;
+		for (; i + 32 <= count; i += 32)
+		{
+			__m256i a = FloatToByteAVX2(_mm256_loadu_ps(src + i + 0));
+			__m256i b = FloatToByteAVX2(_mm256_loadu_ps(src + i + 8));
+			__m256i c = FloatToByteAVX2(_mm256_loadu_ps(src + i + 16));
+			__m256i d = FloatToByteAVX2(_mm256_loadu_ps(src + i + 24));
+			__m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_permutevar8x32_epi32(bytes, order));
+		}
+		ConvertRowSSE2(dst + i, src + i, count - i);
+	}
+
+	CHAOS_TARGET_AVX2 static void ReverseCopyRowAVX2(uint32_t* dst, uint32_t const* src, int count)
+	{
+		__m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256i v = _mm256_loadu_si256((__m256i const*)(src + count - i - 8));
+			_mm256_storeu_si256((__m256i*)(dst + i), _mm256_permutevar8x32_epi32(v, reverse));
+		}
+		for (; i < count; ++i)
+			dst[i] = src[count - 1 - i];
+	}
+
+	CHAOS_TARGET_AVX2 static void ReverseRowAVX2(uint32_t* row, int count)
+	{
+		__m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+		int left = 0;
+		int right = count;
+		while (right - left >= 16)
+		{
+			__m256i l = _mm256_loadu_si256((__m256i const*)(row + left));
+			__m256i r = _mm256_loadu_si256((__m256i const*)(row + right - 8));
+			_mm256_storeu_si256((__m256i*)(row + left), _mm256_permutevar8x32_epi32(r, reverse));
+			_mm256_storeu_si256((__m256i*)(row + right - 8), _mm256_permutevar8x32_epi32(l, reverse));
+			left += 8;
+			right -= 8;
+		}
+		std::reverse(row + left, row + right);
+	}
+
+#endif // CHAOS_PIXEL_KERNELS_X64
+
+	// ================================================================
+	// PixelKernels
+	// ================================================================
+
+	static std::atomic<PixelKernelInstructionSet> instruction_set_in_use = PixelKernels::GetBestInstructionSet();
+
+	PixelKernelInstructionSet PixelKernels::GetBestInstructionSet()
+	{
+#if CHAOS_PIXEL_KERNELS_X64
+		static PixelKernelInstructionSet const result = []()
+		{
+#if defined _MSC_VER
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] >= 7)
+			{
+				__cpuid(info, 1);
+				bool os_saves_avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+				if (os_saves_avx)
+				{
+					__cpuidex(info, 7, 0);
+					if ((info[1] & (1 << 5)) != 0)
+						return PixelKernelInstructionSet::AVX2;
+				}
+			}
+			return PixelKernelInstructionSet::SSE2;
+#else
+			__builtin_cpu_init();
+			return (__builtin_cpu_supports("avx2")) ? PixelKernelInstructionSet::AVX2 : PixelKernelInstructionSet::SSE2;
+#endif
+		}();
+		return result;
+#else
+		return PixelKernelInstructionSet::SCALAR;
+#endif
+	}
+
+	PixelKernelInstructionSet PixelKernels::GetInstructionSet()
+	{
+		return instruction_set_in_use;
+	}
+
+	void PixelKernels::SetInstructionSet(PixelKernelInstructionSet instruction_set)
+	{
+		instruction_set_in_use = (PixelKernelInstructionSet)std::min((int)instruction_set, (int)GetBestInstructionSet());
+	}
+
+#if CHAOS_PIXEL_KERNELS_X64
+#  define CHAOS_PIXEL_KERNEL_DISPATCH(SCALAR_CALL, SSE2_CALL, AVX2_CALL)\
+	switch (instruction_set_in_use.load(std::memory_order_relaxed))\
+	{\
+	case PixelKernelInstructionSet::AVX2: AVX2_CALL; return;\
+	case PixelKernelInstructionSet::SSE2: SSE2_CALL; return;\
+	default: SCALAR_CALL; return;\
+	}
+#else
+#  define CHAOS_PIXEL_KERNEL_DISPATCH(SCALAR_CALL, SSE2_CALL, AVX2_CALL) SCALAR_CALL;
+#endif
+
+	void PixelKernels::ConvertRow(PixelBGRA* dst, PixelBGR const* src, int count)
+	{
+		CHAOS_PIXEL_KERNEL_DISPATCH(
+			ConvertRowScalar(dst, src, count),
+			ConvertRowWord(dst, src, count),
+			ConvertRowAVX2(dst, src, count));
+	}
+
+	void PixelKernels::ConvertRow(PixelBGR* dst, PixelBGRA const* src, int count)
+	{
+		CHAOS_PIXEL_KERNEL_DISPATCH(
+			ConvertRowScalar(dst, src, count),
+			ConvertRowScalar(dst, src, count),
+			ConvertRowAVX2(dst, src, count));
+	}
+
+	void PixelKernels::ConvertRow(PixelBGRA* dst, PixelGray const* src, int count)
+	{
+		CHAOS_PIXEL_KERNEL_DISPATCH(
+			ConvertRowScalar(dst, src, count),
+			ConvertRowSSE2(dst, src, count),
+			ConvertRowAVX2(dst, src, count));
+	}
+
+	void PixelKernels::ConvertRow(PixelBGRA* dst, PixelRGBAFloat const* src, int count)
+	{
+		CHAOS_PIXEL_KERNEL_DISPATCH(
+			ConvertRowScalar(dst, src, count),
+			ConvertRowSSE2(dst, src, count),
+			ConvertRowAVX2(dst, src, count));
+	}
+
+	void PixelKernels::ConvertRow(PixelGray* dst, PixelGrayFloat const* src, int count)
+	{
+		CHAOS_PIXEL_KERNEL_DISPATCH(
+			ConvertRowScalar(dst, src, count),
+			ConvertRowSSE2(dst, src, count),
+			ConvertRowAVX2(dst, src, count));
+	}
+
+	void PixelKernels::ReverseCopyRow(PixelBGRA* dst, PixelBGRA const* src, int count)
+	{
+		static_assert(sizeof(PixelBGRA) == sizeof(uint32_t));
+		uint32_t* d = (uint32_t*)dst;
+		uint32_t const* s = (uint32_t const*)src;
+
+		CHAOS_PIXEL_KERNEL_DISPATCH(
+			ReverseCopyRowScalar(d, s, count),
+			ReverseCopyRowSSE2(d, s, count),
+			ReverseCopyRowAVX2(d, s, count));
+	}
+
+	void PixelKernels::ReverseRow(PixelBGRA* row, int count)
+	{
+		static_assert(sizeof(PixelBGRA) == sizeof(uint32_t));
+		uint32_t* r = (uint32_t*)row;
+
+		CHAOS_PIXEL_KERNEL_DISPATCH(
+			ReverseRowScalar(r, count),
+			ReverseRowSSE2(r, count),
+			ReverseRowAVX2(r, count));
+	}
+
+#undef CHAOS_PIXEL_KERNEL_DISPATCH
+
+}; // namespace chaos
@@ -18,6 +18,8 @@ namespace chaos
 			return 2;
 		if (status == CMD_PROGRAM_CHANGE)
 			return 1;
+		if (status == CMD_CHANNEL_AFTER_TOUCH)
+			return 1;
 		if (status == CMD_PITCH_WHEEL_CHANGE)
 			return 2;
 		return -1;
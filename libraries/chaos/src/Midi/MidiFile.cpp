@@ -12,22 +12,21 @@ namespace chaos
 		return true;
 	}
 
-	bool MidiSystemExclusiveEvent::InitializeEventFromChunk(BufferReader & reader)
+	MIDICommand MidiEvent::GetCommand() const
 	{
-
-		return true;
-	}
-
-	bool MidiMetaEvent::InitializeEventFromChunk(BufferReader & reader)
-	{
-
-		return true;
+		assert(IsCommandEvent());
+		unsigned char param1 = (data_size > 0) ? (unsigned char)data[0] : 0;
+		unsigned char param2 = (data_size > 1) ? (unsigned char)data[1] : 0;
+		return MIDICommand(signature, param1, param2);
 	}
 
-	bool MidiCommandEvent::InitializeEventFromChunk(BufferReader & reader)
+	size_t MidiTimeline::GetEventIndexAtTime(double time) const
 	{
-
-		return true;
+		auto it = std::lower_bound(events.begin(), events.end(), time, [](MidiTimedEvent const& e, double t)
+		{
+			return e.time < t;
+		});
+		return size_t(it - events.begin());
 	}
 
 	MidiChunk const MidiLoader::ReadChunk(BufferReader & reader)
@@ -61,9 +60,11 @@ namespace chaos
 		return MidiChunk();
 	}
 
-	bool MidiLoader::LoadBuffer(Buffer<char> const & buffer)
+	bool MidiLoader::LoadBuffer(Buffer<char> const & in_buffer)
 	{
 		Clean();
+		// keep a reference on the buffer because events point on it
+		buffer = in_buffer;
 		BufferReader reader(buffer);
 		if (!DoLoadBuffer(reader))
 		{
@@ -77,6 +78,8 @@ namespace chaos
 	{
 		header = MidiHeader();
 		tracks.clear();
+		events.clear();
+		buffer = Buffer<char>();
 	}
 
 	bool MidiLoader::ReadVLTime(BufferReader & reader, uint32_t & result)
@@ -85,7 +88,7 @@ namespace chaos
 
 		unsigned char tmp = 0;
 		uint32_t count = 0;
-		while (!reader.Read(tmp) && count++ < 4) // time is at much 4 bytes long
+		while (count++ < 4 && reader.Read(tmp)) // time is at much 4 bytes long
 		{
 			result |= ((uint32_t)(tmp & ~0x80));
 			// last byte reached
@@ -96,44 +99,71 @@ namespace chaos
 		return false;
 	}
 
-	bool MidiLoader::InitializeTrackFromChunk(MidiTrack * track, MidiChunk const & track_chunk)
+	bool MidiLoader::InitializeTrackFromChunk(MidiChunk const & track_chunk)
 	{
+		uint32_t tick = 0;
+		unsigned char running_status = 0;
+
 		BufferReader reader(track_chunk);
 		while (!reader.IsEOF())
 		{
 			// read the time of the event
-			uint32_t event_time = 0;
-			if (!ReadVLTime(reader, event_time))
+			uint32_t delta_time = 0;
+			if (!ReadVLTime(reader, delta_time))
 				return false;
+			tick += delta_time;
 
-			unsigned char signature = 0;
-			reader.Read(signature);
+			MidiEvent new_event;
+			new_event.tick = tick;
 
-			// misformed event
-			if ((signature & 0x80) == 0)
+			unsigned char signature = 0;
+			if (!reader.Read(signature))
 				return false;
 
-			std::unique_ptr<MidiEvent> new_event;
+			// running status : the byte is the first parameter of the previous command
+			size_t running_status_bytes = 0;
+			if ((signature & 0x80) == 0)
+			{
+				if (running_status == 0)
+					return false; // misformed event
+				signature = running_status;
+				running_status_bytes = 1;
+			}
+			new_event.signature = signature;
 
 			if (signature == 0xF0 || signature == 0xF7) // System exclusive event
 			{
-				new_event = std::move(std::unique_ptr<MidiEvent>(new MidiSystemExclusiveEvent(signature)));
+				running_status = 0;
+				if (!ReadVLTime(reader, new_event.data_size))
+					return false;
 			}
 			else if (signature == 0xFF) // meta event
 			{
-				new_event = std::move(std::unique_ptr<MidiEvent>(new MidiMetaEvent(signature)));
+				running_status = 0;
+				if (!reader.Read(new_event.meta_type))
+					return false;
+				if (!ReadVLTime(reader, new_event.data_size))
+					return false;
 			}
-			else // standard MIDI event
+			else if (signature < 0xF0) // standard MIDI event
 			{
-				new_event = std::move(std::unique_ptr<MidiEvent>(new MidiCommandEvent(signature)));
+				running_status = signature;
+				new_event.data_size = (uint32_t)MIDICommand::GetCommandParamCount(signature);
 			}
+			else
+				return false; // realtime messages are not expected in files
 
-			if (new_event == nullptr)
+			// the data are a view on the chunk
+			size_t remaining_size = new_event.data_size - running_status_bytes;
+			if (!reader.IsEnoughData(remaining_size))
 				return false;
+			new_event.data = reader.GetCurrentPosition() - running_status_bytes;
+			reader.Advance(remaining_size);
 
-			if (!new_event->InitializeEventFromChunk(reader))
-				return false;
-			track->events.push_back(std::move(new_event));
+			events.push_back(new_event);
+
+			if (new_event.IsMetaEvent() && new_event.meta_type == MidiEvent::META_END_OF_TRACK)
+				break;
 		}
 		return true;
 	}
@@ -147,33 +177,118 @@ namespace chaos
 
 		if (!GetHeaderFromChunk(header_chunk, header))
 			return false;
-		// read the tracks
-		size_t track_found = 0;
 
-		MidiChunk data_chunk = ReadChunk(reader);
-		while (data_chunk.data != nullptr)
+		// collect the track chunks
+		std::vector<MidiChunk> track_chunks;
+		size_t track_bytes = 0;
+
+		for (MidiChunk data_chunk = ReadChunk(reader); data_chunk.data != nullptr; data_chunk = ReadChunk(reader))
 		{
 			// don't know how to handle NON-TRACK chunk
 			if (!data_chunk.IsTrackChunk())
 				continue;
 			// do we already have read all expected track chunk
-			if (track_found == header.track_count)
-				continue;
+			if (track_chunks.size() == size_t(header.track_count))
+				break;
+			track_chunks.push_back(data_chunk);
+			track_bytes += data_chunk.bufsize;
+		}
+		if (track_chunks.size() != size_t(header.track_count)) // all expected tracks read
+			return false;
 
-			// create a track from the chunk
-			std::unique_ptr<MidiTrack> new_track(new MidiTrack());
-			if (new_track != nullptr)
+		// an event is at least 2 bytes long (delta time + 1 parameter with running status)
+		events.reserve(track_bytes / 2 + 1);
+		std::vector<size_t> first_events;
+		for (MidiChunk const & track_chunk : track_chunks)
+		{
+			first_events.push_back(events.size());
+			if (!InitializeTrackFromChunk(track_chunk))
+				return false;
+		}
+		first_events.push_back(events.size());
+
+		// the tracks are views on the arena (resolved once the arena is complete)
+		tracks.reserve(track_chunks.size());
+		for (size_t i = 0; i < track_chunks.size(); ++i)
+		{
+			MidiTrack new_track;
+			new_track.events = events.data() + first_events[i];
+			new_track.event_count = first_events[i + 1] - first_events[i];
+			tracks.push_back(new_track);
+		}
+
+		return true;
+	}
+	double MidiLoader::GetTickDuration(uint32_t tempo) const
+	{
+		// SMPTE : upper byte is the negative frame count per second, lower byte is the tick count per frame (tempo is ignored)
+		if (header.division < 0)
+		{
+			int frame_per_second = -(int)(int8_t)(header.division >> 8);
+			int tick_per_frame = (int)(header.division & 0xFF);
+			if (frame_per_second <= 0 || tick_per_frame <= 0)
+				return 0.0;
+			return 1.0 / (double(frame_per_second) * double(tick_per_frame));
+		}
+		// tick count per quarter note
+		if (header.division == 0)
+			return 0.0;
+		return (double(tempo) / 1000000.0) / double(header.division);
+	}
+
+	bool MidiLoader::BuildTimeline(MidiTimeline & result) const
+	{
+		result.events.clear();
+		// the tracks of such files are independant sequences
+		if (header.format == MidiHeader::FORMAT_MULTIPLE_SONG && tracks.size() > 1)
+			return false;
+
+		result.events.reserve(events.size());
+
+		// k-way merge of the tracks (already sorted) : ties are resolved by track index, then by order in track
+		using MergeEntry = std::pair<uint32_t, size_t>; // (tick, track index)
+		std::priority_queue<MergeEntry, std::vector<MergeEntry>, std::greater<MergeEntry>> heads;
+		std::vector<size_t> positions(tracks.size(), 0);
+
+		for (size_t i = 0; i < tracks.size(); ++i)
+			if (tracks[i].event_count > 0)
+				heads.push({ tracks[i].events[0].tick, i });
+
+		uint32_t tempo = 500000; // default is 120 beats per minute
+		double tick_duration = GetTickDuration(tempo);
+		double time = 0.0;
+		uint32_t tick = 0;
+
+		while (!heads.empty())
+		{
+			size_t track_index = heads.top().second;
+			heads.pop();
+
+			MidiTrack const & track = tracks[track_index];
+			MidiEvent const * event = &track.events[positions[track_index]];
+
+			// the tempo in effect is applied up to this event
+			time += double(event->tick - tick) * tick_duration;
+			tick = event->tick;
+
+			MidiTimedEvent timed_event;
+			timed_event.time = time;
+			timed_event.tick = tick;
+			timed_event.track_index = track_index;
+			timed_event.event = event;
+			result.events.push_back(timed_event);
+
+			if (event->IsMetaEvent() && event->meta_type == MidiEvent::META_SET_TEMPO && event->data_size == 3)
 			{
-				if (!InitializeTrackFromChunk(new_track.get(), data_chunk))
-					return false;
-				tracks.push_back(std::move(new_track));
+				unsigned char const * d = (unsigned char const *)event->data;
+				tempo = (uint32_t(d[0]) << 16) | (uint32_t(d[1]) << 8) | uint32_t(d[2]);
+				tick_duration = GetTickDuration(tempo);
 			}
 
-			// update counts
-			++track_found;
+			if (++positions[track_index] < track.event_count)
+				heads.push({ track.events[positions[track_index]].tick, track_index });
 		}
-
-		return (track_found == header.track_count); // all expected tracks read
+		return true;
 	}
 
 	bool MidiLoader::GetHeaderFromChunk(MidiChunk const & chunk, MidiHeader & result)
@@ -38,6 +38,12 @@ namespace chaos
 		layer->require_GPU_update = true;
 	}
 
+	void ParticleAllocationBase::NotifyParticlesChanged()
+	{
+		if (layer != nullptr)
+			layer->IncrementContentRevision();
+	}
+
 	bool ParticleAllocationBase::IsAttachedToLayer() const
 	{
 		return (layer != nullptr);
@@ -28,6 +28,7 @@ namespace chaos
 			{
 				allocation->OnRemovedFromLayer();
 				particles_allocations.erase(particles_allocations.begin() + index);
+				IncrementContentRevision();
 				return;
 			}
 		}
@@ -37,10 +38,18 @@ namespace chaos
 	{
 		// update the particles themselves
 		if (AreParticlesDynamic())
-			require_GPU_update |= TickAllocations(delta_time);
+			if (TickAllocations(delta_time))
+				require_GPU_update = true;
 		return true;
 	}
 
+	bool ParticleLayerBase::TickOrDestroyAllocation(float delta_time, ParticleAllocationBase* allocation)
+	{
+		if (allocation->GetParticleCount() == 0 && allocation->GetDestroyWhenEmpty()) // XXX: if the TRAIT is not particle_dynamic, this will never be called
+			return true;
+		return TickAllocation(delta_time, allocation); // tick this single allocation
+	}
+
 	bool ParticleLayerBase::TickAllocations(float delta_time)
 	{
 		bool result = false;
@@ -49,25 +58,48 @@ namespace chaos
 		// to be handled after the main loop
 		std::vector<ParticleAllocationBase*> to_destroy_allocations;
 
-		// main loop
 		size_t count = particles_allocations.size();
-		for (size_t i = 0; i < count; ++i)
+
+		JobSystem* job_system = Application::GetJobSystemInstance();
+		if (IsParallelTick() && job_system != nullptr && job_system->GetWorkerCount() > 0 && count > 1)
 		{
-			ParticleAllocationBase * allocation = particles_allocations[i].get();
-			if (allocation == nullptr)
-				continue;
-			// tick or destroy the allocation
-			bool destroy_allocation = false;
-			if (allocation->GetParticleCount() == 0 && allocation->GetDestroyWhenEmpty()) // XXX: if the TRAIT is not particle_dynamic, this will never be called
-				destroy_allocation = true;
-			else
-				destroy_allocation = TickAllocation(delta_time, allocation); // tick this single allocation
-
-			// register as an allocation to be destroyed
-			if (destroy_allocation)
-				to_destroy_allocations.push_back(allocation);
-			// particles have changed ... so must it be for vertices
-			result = true;
+			// allocations are independent from each other
+			std::vector<uint8_t> destroy_allocations(count, 0);
+
+			job_system->ParallelFor(count, 1, [this, delta_time, &destroy_allocations](size_t begin, size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+					if (ParticleAllocationBase* allocation = particles_allocations[i].get())
+						destroy_allocations[i] = TickOrDestroyAllocation(delta_time, allocation);
+			});
+
+			// collect the allocations to destroy in the same order than the serial loop
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (particles_allocations[i] == nullptr)
+					continue;
+				if (destroy_allocations[i])
+					to_destroy_allocations.push_back(particles_allocations[i].get());
+				result = true;
+			}
+		}
+		else
+		{
+			// main loop
+			for (size_t i = 0; i < count; ++i)
+			{
+				ParticleAllocationBase * allocation = particles_allocations[i].get();
+				if (allocation == nullptr)
+					continue;
+				// tick or destroy the allocation
+				bool destroy_allocation = TickOrDestroyAllocation(delta_time, allocation);
+
+				// register as an allocation to be destroyed
+				if (destroy_allocation)
+					to_destroy_allocations.push_back(allocation);
+				// particles have changed ... so must it be for vertices
+				result = true;
+			}
 		}
 
 		// handle allocation that wanted to react whenever they become empty
@@ -91,6 +123,7 @@ namespace chaos
 			if (allocation == nullptr)
 				return nullptr;
 			particles_allocations.push_back(allocation); // register the allocation
+			IncrementContentRevision();
 		}
 		// get the very first allocation
 		else
@@ -13,6 +13,78 @@ namespace chaos
 		{
 		}
 
+		template<typename T>
+		static void HashCombine(uint64_t & seed, T const & value)
+		{
+			seed ^= uint64_t(std::hash<T>()(value)) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+		}
+
+		bool GeneratorParams::IsSameLayout(GeneratorParams const & other) const
+		{
+			return
+				(line_height == other.line_height) &&
+				(line_spacing == other.line_spacing) &&
+				(character_spacing == other.character_spacing) &&
+				(kerning == other.kerning) &&
+				(bitmap_padding == other.bitmap_padding) &&
+				(max_text_width == other.max_text_width) &&
+				(word_wrap == other.word_wrap) &&
+				(default_color == other.default_color) &&
+				(font_info_name == other.font_info_name) &&
+				(tab_size == other.tab_size);
+		}
+
+		bool GeneratorParams::IsSameJustifiedLayout(GeneratorParams const & other) const
+		{
+			return
+				IsSameLayout(other) &&
+				(justify_space_factor == other.justify_space_factor) &&
+				(alignment == other.alignment);
+		}
+
+		bool GeneratorParams::operator == (GeneratorParams const & other) const
+		{
+			return
+				IsSameJustifiedLayout(other) &&
+				(position == other.position) &&
+				(hotpoint == other.hotpoint);
+		}
+
+		uint64_t GeneratorParams::GetLayoutHash() const
+		{
+			uint64_t result = 0;
+			HashCombine(result, line_height);
+			HashCombine(result, line_spacing);
+			HashCombine(result, character_spacing);
+			HashCombine(result, kerning);
+			HashCombine(result, bitmap_padding.x);
+			HashCombine(result, bitmap_padding.y);
+			HashCombine(result, max_text_width);
+			HashCombine(result, word_wrap);
+			for (int i = 0; i < 4; ++i)
+				HashCombine(result, default_color[i]);
+			HashCombine(result, font_info_name);
+			HashCombine(result, tab_size);
+			return result;
+		}
+
+		uint64_t GeneratorParams::GetJustifiedLayoutHash() const
+		{
+			uint64_t result = GetLayoutHash();
+			HashCombine(result, justify_space_factor);
+			HashCombine(result, alignment);
+			return result;
+		}
+
+		uint64_t GeneratorParams::GetHash() const
+		{
+			uint64_t result = GetJustifiedLayoutHash();
+			HashCombine(result, position.x);
+			HashCombine(result, position.y);
+			HashCombine(result, hotpoint);
+			return result;
+		}
+
 		bool DoSaveIntoJSON(nlohmann::json * json, GeneratorParams const & src)
 		{
 			if (!PrepareSaveObjectIntoJSON(json))
@@ -20,6 +92,7 @@ namespace chaos
 			JSONTools::SetAttribute(json, "line_height", src.line_height);
 			JSONTools::SetAttribute(json, "line_spacing", src.line_spacing);
 			JSONTools::SetAttribute(json, "character_spacing", src.character_spacing);
+			JSONTools::SetAttribute(json, "kerning", src.kerning);
 			JSONTools::SetAttribute(json, "bitmap_padding", src.bitmap_padding);
 			JSONTools::SetAttribute(json, "max_text_width", src.max_text_width);
 			JSONTools::SetAttribute(json, "word_wrap", src.word_wrap);
@@ -38,6 +111,7 @@ namespace chaos
 			JSONTools::GetAttribute(config, "line_height", dst.line_height);
 			JSONTools::GetAttribute(config, "line_spacing", dst.line_spacing);
 			JSONTools::GetAttribute(config, "character_spacing", dst.character_spacing);
+			JSONTools::GetAttribute(config, "kerning", dst.kerning);
 			JSONTools::GetAttribute(config, "bitmap_padding", dst.bitmap_padding);
 			JSONTools::GetAttribute(config, "max_text_width", dst.max_text_width);
 			JSONTools::GetAttribute(config, "word_wrap", dst.word_wrap);
@@ -218,6 +292,14 @@ namespace chaos
 				// scale the character back to the size of the scanline
 				float factor = MathTools::CastAndDiv<float>(params.line_height, token.font_info->ascender - token.font_info->descender);
 
+				// apply the kerning with the previous character of the line
+				if (params.kerning && result.token_lines.back().size() > 0)
+				{
+					Token const & previous_token = result.token_lines.back().back();
+					if (previous_token.IsCharacter() && previous_token.font_info == token.font_info)
+						character_position.x += factor * (float)token.font_info->GetKerning(previous_token.character, token.character);
+				}
+
 #if 0
 				glm::vec2 bottomleft_position;
 				bottomleft_position = character_position - glm::vec2(0.0f, descender) + // character_position.y is BELOW the scanline (at the descender level)
@@ -265,6 +347,36 @@ namespace chaos
 
 		}
 
+		GeneratorCheckpoint GeneratorData::GetCheckpoint(size_t text_offset) const
+		{
+			assert(style_stack.size() == 1);
+
+			GeneratorCheckpoint checkpoint;
+			checkpoint.text_offset = text_offset;
+			checkpoint.line_count = result.token_lines.size();
+			checkpoint.last_line_token_count = (checkpoint.line_count > 0) ? result.token_lines.back().size() : 0;
+			checkpoint.style = style_stack.back();
+			checkpoint.bitmap_position = bitmap_position;
+			checkpoint.character_position = character_position;
+			return checkpoint;
+		}
+
+		void GeneratorData::RestoreCheckpoint(GeneratorCheckpoint const & checkpoint, std::vector<TokenLine> const & token_lines)
+		{
+			assert(checkpoint.line_count <= token_lines.size());
+
+			result.token_lines.assign(token_lines.begin(), token_lines.begin() + checkpoint.line_count);
+			if (checkpoint.line_count > 0)
+			{
+				TokenLine & last_line = result.token_lines.back();
+				last_line.erase(last_line.begin() + checkpoint.last_line_token_count, last_line.end());
+			}
+			style_stack.clear();
+			style_stack.push_back(checkpoint.style);
+			bitmap_position = checkpoint.bitmap_position;
+			character_position = checkpoint.character_position;
+		}
+
 		void GeneratorData::EndCurrentLine()
 		{
 			// update position
@@ -392,6 +504,7 @@ namespace chaos
 			if (!IsNameValid(name))
 				return false;
 			colors.insert(std::make_pair(name, color));
+			ClearCache();
 			return true;
 		}
 
@@ -413,6 +526,7 @@ namespace chaos
 			if (!IsNameValid(name))
 				return false;
 			font_infos.insert(std::make_pair(name, font_info));
+			ClearCache();
 			return true;
 		}
 
@@ -436,9 +550,19 @@ namespace chaos
 			if (!IsNameValid(name))
 				return false;
 			bitmaps.insert(std::make_pair(name, info));
+			ClearCache();
 			return true;
 		}
 
+		void Generator::PushDefaultStyle(GeneratorData & generator_data) const
+		{
+			// initialize parse params stack with a default style that defines current color and fonts
+			Style style;
+			style.color = generator_data.params.default_color;
+			style.font_info = generator_data.GetFontInfoFromName(generator_data.params.font_info_name.c_str());
+			generator_data.style_stack.push_back(style);
+		}
+
 		bool Generator::Generate(char const * text, GeneratorResult & result, GeneratorParams const & params) const
 		{
 			assert(text != nullptr);
@@ -446,13 +570,8 @@ namespace chaos
 			// clear the result
 			result.Clear();
 
-			// initialize parse params stack with a default style that defines current color and fonts
 			GeneratorData generator_data(*this, result, params);
-
-			Style style;
-			style.color = params.default_color;
-			style.font_info = generator_data.GetFontInfoFromName(params.font_info_name.c_str());
-			generator_data.style_stack.push_back(style);
+			PushDefaultStyle(generator_data);
 
 			// start the generation
 			return DoGenerate(text, generator_data);
@@ -463,6 +582,11 @@ namespace chaos
 			// all steps to properly generate the result
 			if (!DoGenerateLines(text, generator_data))
 				return false;
+			return DoFinalizeLines(generator_data);
+		}
+
+		bool Generator::DoFinalizeLines(GeneratorData & generator_data) const
+		{
 			// justification
 			if (!JustifyLines(generator_data.params, generator_data))
 				return false;
@@ -473,12 +597,187 @@ namespace chaos
 			return true;
 		}
 
-		bool Generator::DoGenerateLines(char const * text, GeneratorData & generator_data) const
+		void Generator::SetCacheSize(size_t in_cache_size)
+		{
+			std::lock_guard<std::mutex> lock(cache_mutex);
+			cache_size = in_cache_size;
+			while (cache_entries.size() > cache_size)
+			{
+				cache_map.erase(cache_entries.back()->hash);
+				cache_entries.pop_back();
+			}
+		}
+
+		void Generator::ClearCache() const
+		{
+			std::lock_guard<std::mutex> lock(cache_mutex);
+			cache_entries.clear();
+			cache_map.clear();
+		}
+
+		shared_ptr<GeneratorCacheEntry> Generator::GenerateCached(char const * text, GeneratorParams const & params) const
+		{
+			assert(text != nullptr);
+
+			std::string_view text_view = text;
+
+			// the position and the hotpoint are applied by the user of the entry (see GeneratorCacheEntry::GetPlacementOffset)
+			uint64_t layout_hash = params.GetLayoutHash();
+
+			uint64_t hash = params.GetJustifiedLayoutHash();
+			HashCombine(hash, text_view);
+
+			std::lock_guard<std::mutex> lock(cache_mutex);
+
+			// the cached texts point to the content of the atlas
+			if (cache_atlas_version != atlas.GetVersion())
+			{
+				cache_entries.clear();
+				cache_map.clear();
+				cache_atlas_version = atlas.GetVersion();
+			}
+
+			// search the text in the cache
+			auto it = cache_map.find(hash);
+			if (it != cache_map.end())
+			{
+				GeneratorCacheEntry * entry = it->second->get();
+				if (entry->text == text_view && entry->params.IsSameJustifiedLayout(params))
+				{
+					cache_entries.splice(cache_entries.begin(), cache_entries, it->second); // becomes the most recently used
+					return entry;
+				}
+			}
+
+			// generate the text
+			shared_ptr<GeneratorCacheEntry> result = DoGenerateCacheEntry(text_view, params, hash, layout_hash);
+			if (result == nullptr || cache_size == 0)
+				return result;
+
+			// insert it in the cache (replace the entry in case of hash collision)
+			if (it != cache_map.end())
+			{
+				cache_entries.erase(it->second);
+				cache_map.erase(it);
+			}
+			cache_entries.push_front(result);
+			cache_map[hash] = cache_entries.begin();
+
+			// remove the least recently used entries
+			while (cache_entries.size() > cache_size)
+			{
+				cache_map.erase(cache_entries.back()->hash);
+				cache_entries.pop_back();
+			}
+			return result;
+		}
+
+		// XXX : this is a linear search over the whole cache. It is only done when the text is not in the cache and the cache is small (see cache_size)
+		//       The hash of the layout discards most entries before any parameter or character is compared
+
+		GeneratorCacheEntry const * Generator::FindBestPrefixEntry(std::string_view text, GeneratorParams const & params, uint64_t layout_hash, GeneratorCheckpoint const *& checkpoint) const
+		{
+			GeneratorCacheEntry const * result = nullptr;
+			checkpoint = nullptr;
+
+			for (shared_ptr<GeneratorCacheEntry> const & entry : cache_entries)
+			{
+				if (entry->layout_hash != layout_hash || !entry->params.IsSameLayout(params))
+					continue;
+				// the length of the common prefix
+				size_t prefix_length = size_t(std::mismatch(text.begin(), text.end(), entry->text.begin(), entry->text.end()).first - text.begin());
+				// the last checkpoint inside this prefix
+				auto it = std::upper_bound(entry->checkpoints.begin(), entry->checkpoints.end(), prefix_length, [](size_t offset, GeneratorCheckpoint const & c)
+				{
+					return offset < c.text_offset;
+				});
+				if (it == entry->checkpoints.begin())
+					continue;
+				--it;
+				if (it->text_offset == 0) // nothing to reuse
+					continue;
+				if (checkpoint == nullptr || it->text_offset > checkpoint->text_offset)
+				{
+					result = entry.get();
+					checkpoint = &*it;
+					if (checkpoint->text_offset >= text.size()) // the whole text is a prefix of the entry: no entry can do better
+						break;
+				}
+			}
+			return result;
+		}
+
+		shared_ptr<GeneratorCacheEntry> Generator::DoGenerateCacheEntry(std::string_view text, GeneratorParams const & params, uint64_t hash, uint64_t layout_hash) const
+		{
+			shared_ptr<GeneratorCacheEntry> result = new GeneratorCacheEntry;
+			if (result == nullptr)
+				return nullptr;
+			result->text = text;
+			result->params = params;
+			result->params.position = { 0.0f, 0.0f }; // the entry is shared by all placements
+			result->params.hotpoint = Hotpoint::BOTTOM_LEFT;
+			result->hash = hash;
+			result->layout_hash = layout_hash;
+
+			// generate the lines (before justification and hotpoint) with checkpoints
+			GeneratorResult raw_result;
+			GeneratorData generator_data(*this, raw_result, params);
+			generator_data.checkpoints = &result->checkpoints;
+
+			size_t start_offset = 0;
+
+			GeneratorCheckpoint const * checkpoint = nullptr;
+			if (GeneratorCacheEntry const * prefix_entry = FindBestPrefixEntry(text, params, layout_hash, checkpoint))
+			{
+				// the checkpoint we resume from is inserted again by DoGenerateLines(...)
+				for (GeneratorCheckpoint const & c : prefix_entry->checkpoints)
+				{
+					if (c.text_offset >= checkpoint->text_offset)
+						break;
+					result->checkpoints.push_back(c);
+				}
+				generator_data.RestoreCheckpoint(*checkpoint, prefix_entry->raw_token_lines);
+				start_offset = checkpoint->text_offset;
+			}
+			else
+			{
+				PushDefaultStyle(generator_data);
+			}
+
+			if (!DoGenerateLines(result->text.c_str(), generator_data, start_offset))
+				return nullptr;
+			result->raw_token_lines = raw_result.token_lines;
+
+			// justification and hotpoint
+			result->result.token_lines = std::move(raw_result.token_lines);
+
+			GeneratorData final_data(*this, result->result, result->params);
+			if (!DoFinalizeLines(final_data))
+				return nullptr;
+
+			return result;
+		}
+
+		glm::vec2 GeneratorCacheEntry::GetPlacementOffset(GeneratorParams const & placement_params) const
+		{
+			if (result.GetTokenCount() == 0) // no sprite, no bounding box
+				return { 0.0f, 0.0f };
+
+			glm::vec2 min_position = result.bounding_box.bottomleft;
+			glm::vec2 max_position = result.bounding_box.topright;
+			return placement_params.position - ConvertHotpoint(min_position, max_position - min_position, Hotpoint::BOTTOM_LEFT, placement_params.hotpoint);
+		}
+
+		bool Generator::DoGenerateLines(char const * text, GeneratorData & generator_data, size_t start_offset) const
 		{
 			// iterate over all characters
 			bool escape_character = false;
-			for (int i = 0; text[i] != 0; ++i)
+			for (int i = int(start_offset); text[i] != 0; ++i)
 			{
+				// keep the state of the generation before the character (only outside markups)
+				if (generator_data.checkpoints != nullptr && !escape_character && generator_data.style_stack.size() == 1)
+					generator_data.checkpoints->push_back(generator_data.GetCheckpoint(size_t(i)));
+
 				uint32_t charcode = text[i];
 
 				bool new_escape_character = (charcode == '\\');
@@ -147,6 +147,75 @@ namespace chaos
 			return true;
 		}
 
+		// the types of layer in binary format
+		enum class BinaryLayerType : uint8_t
+		{
+			UNKNOWN = 0,
+			IMAGE = 1,
+			OBJECT = 2,
+			GROUP = 3,
+			TILE = 4
+		};
+
+		bool BaseObject::DoLoadBinaryLayersImpl(BinaryReader& reader, std::vector<shared_ptr<LayerBase>>& result)
+		{
+			uint32_t count = 0;
+			if (!reader.ReadCount(count))
+				return false;
+
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				BinaryLayerType layer_type = BinaryLayerType::UNKNOWN;
+				reader.Read(layer_type);
+
+				shared_ptr<LayerBase> layer;
+				if (layer_type == BinaryLayerType::IMAGE)
+					layer = new ImageLayer(this);
+				else if (layer_type == BinaryLayerType::OBJECT)
+					layer = new ObjectLayer(this);
+				else if (layer_type == BinaryLayerType::GROUP)
+					layer = new GroupLayer(this);
+				else if (layer_type == BinaryLayerType::TILE)
+				{
+					Map const* map = GetMap();
+					if (map == nullptr)
+						return false;
+					layer = new TileLayer(this, map->tile_size);
+				}
+				if (layer == nullptr || !layer->DoLoadBinary(reader))
+					return false;
+				result.push_back(std::move(layer));
+			}
+			return true;
+		}
+
+		void BaseObject::DoSaveBinaryLayersImpl(BinaryWriter& writer, std::vector<shared_ptr<LayerBase>> const& layers) const
+		{
+			writer.Write(uint32_t(layers.size()));
+			for (shared_ptr<LayerBase> const& layer : layers)
+			{
+				LayerBase const* base_layer = layer.get();
+
+				BinaryLayerType layer_type = BinaryLayerType::UNKNOWN;
+				if (ImageLayer const* image_layer = auto_cast(base_layer))
+					layer_type = BinaryLayerType::IMAGE;
+				else if (ObjectLayer const* object_layer = auto_cast(base_layer))
+					layer_type = BinaryLayerType::OBJECT;
+				else if (GroupLayer const* group_layer = auto_cast(base_layer))
+					layer_type = BinaryLayerType::GROUP;
+				else if (TileLayer const* tile_layer = auto_cast(base_layer))
+					layer_type = BinaryLayerType::TILE;
+
+				writer.Write(layer_type);
+				if (layer_type == BinaryLayerType::UNKNOWN) // the binary data will be rejected on loading
+				{
+					assert(0);
+					return;
+				}
+				base_layer->DoSaveBinary(writer);
+			}
+		}
+
 	};  // namespace TiledMap
 
 }; // namespace chaos
@@ -0,0 +1,149 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	namespace TiledMap
+	{
+		// ==========================================
+		// BinaryWriter methods
+		// ==========================================
+
+		BinaryWriter::BinaryWriter(boost::filesystem::path const& in_reference_path)
+		{
+			if (!in_reference_path.empty())
+			{
+				boost::filesystem::path redirected_path = FileTools::GetRedirectedPath(in_reference_path); // the same file than the one used by PathTools::FindAbsolutePath(...)
+				if (!redirected_path.empty())
+					reference_directory = redirected_path.parent_path().lexically_normal().make_preferred();
+			}
+		}
+
+		void BinaryWriter::WriteData(void const* in_data, size_t size)
+		{
+			char const* bytes = (char const*)in_data;
+			data.insert(data.end(), bytes, bytes + size);
+		}
+
+		void BinaryWriter::Write(std::string const& value)
+		{
+			Write(uint32_t(value.length()));
+			WriteData(value.c_str(), value.length());
+		}
+
+		void BinaryWriter::Write(boost::filesystem::path const& value)
+		{
+			if (!value.empty() && !reference_directory.empty() && value.is_absolute())
+			{
+				boost::filesystem::path relative_path = value.lexically_relative(reference_directory);
+				if (!relative_path.empty()) // empty for paths on another root
+				{
+					Write(relative_path.string());
+					return;
+				}
+			}
+			Write(value.string());
+		}
+
+		bool BinaryWriter::SaveFile(boost::filesystem::path const& path) const
+		{
+			boost::filesystem::path tmp_path = path;
+			tmp_path += StringTools::Printf(".%llx.tmp", (unsigned long long)std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+			bool success = false;
+			{
+				std::ofstream stream(tmp_path.string().c_str(), std::ios::binary);
+				if (stream)
+				{
+					stream.write(data.data(), data.size());
+					success = !stream.fail();
+				}
+			}
+
+			boost::system::error_code error_code;
+			if (success)
+			{
+				boost::filesystem::rename(tmp_path, path, error_code);
+				success = !error_code;
+			}
+			if (!success)
+			{
+				boost::filesystem::remove(tmp_path, error_code);
+				Log::Error("BinaryWriter::SaveFile: fail to write [%s]", path.string().c_str());
+			}
+			return success;
+		}
+
+		// ==========================================
+		// BinaryReader methods
+		// ==========================================
+
+		BinaryReader::BinaryReader(Buffer<char> const& in_buffer, boost::filesystem::path const& in_reference_path) :
+			BufferReader(in_buffer),
+			reference_path(in_reference_path)
+		{
+		}
+
+		bool BinaryReader::SetFailed()
+		{
+			failed = true;
+			return false;
+		}
+
+		bool BinaryReader::ReadData(void* data, size_t size)
+		{
+			if (size == 0)
+				return !failed;
+			if (failed || !IsEnoughData(size))
+			{
+				memset(data, 0, size);
+				return SetFailed();
+			}
+			memcpy(data, GetCurrentPosition(), size);
+			Advance(size);
+			return true;
+		}
+
+		bool BinaryReader::ReadCount(uint32_t& count)
+		{
+			count = 0;
+			uint32_t value = 0;
+			if (!Read(value))
+				return false;
+			if (!IsEnoughData(value)) // each element requires one byte at least
+				return SetFailed();
+			count = value;
+			return true;
+		}
+
+		bool BinaryReader::Read(std::string& value)
+		{
+			value.clear();
+
+			uint32_t length = 0;
+			if (!ReadCount(length))
+				return false;
+			value.assign(GetCurrentPosition(), length);
+			Advance(length);
+			return true;
+		}
+
+		bool BinaryReader::Read(boost::filesystem::path& value)
+		{
+			value.clear();
+
+			std::string path_string;
+			if (!Read(path_string))
+				return false;
+			if (!path_string.empty())
+			{
+				value = path_string;
+				if (!value.is_absolute())
+					value = PathTools::FindAbsolutePath(reference_path, value); // the same resolution than for XML
+			}
+			return true;
+		}
+
+	};  // namespace TiledMap
+
+}; // namespace chaos
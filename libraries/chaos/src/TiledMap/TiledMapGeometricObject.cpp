@@ -50,6 +50,28 @@ namespace chaos
 			return true;
 		}
 
+		bool GeometricObject::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!TypedObject::DoLoadBinary(reader))
+				return false;
+			reader.Read(id);
+			reader.Read(name);
+			reader.Read(visible);
+			reader.Read(position);
+			reader.Read(rotation);
+			return reader.IsValid();
+		}
+
+		void GeometricObject::DoSaveBinary(BinaryWriter& writer) const
+		{
+			TypedObject::DoSaveBinary(writer);
+			writer.Write(id);
+			writer.Write(name);
+			writer.Write(visible);
+			writer.Write(position);
+			writer.Write(rotation);
+		}
+
 		box2 GeometricObject::GetBoundingBox(bool world_system) const
 		{
 			box2 result = DoGetBoundingBox();
@@ -86,6 +108,20 @@ namespace chaos
 			return true;
 		}
 
+		bool GeometricObjectSurface::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!GeometricObject::DoLoadBinary(reader))
+				return false;
+			reader.Read(size);
+			return reader.IsValid();
+		}
+
+		void GeometricObjectSurface::DoSaveBinary(BinaryWriter& writer) const
+		{
+			GeometricObject::DoSaveBinary(writer);
+			writer.Write(size);
+		}
+
 		box2 GeometricObjectSurface::DoGetBoundingBox() const
 		{
 			// TOP-LEFT
@@ -195,6 +231,21 @@ namespace chaos
 			return result;
 		}
 
+		static bool ReadPointArray(BinaryReader& reader, std::vector<glm::vec2>& points)
+		{
+			uint32_t count = 0;
+			if (!reader.ReadCount(count))
+				return false;
+			points.resize(count);
+			return reader.ReadData(points.data(), count * sizeof(glm::vec2));
+		}
+
+		static void WritePointArray(BinaryWriter& writer, std::vector<glm::vec2> const& points)
+		{
+			writer.Write(uint32_t(points.size()));
+			writer.WriteData(points.data(), points.size() * sizeof(glm::vec2));
+		}
+
 		// ==========================================
 		// GeometricObjectPolygon methods
 		// ==========================================
@@ -220,6 +271,23 @@ namespace chaos
 			return result;
 		}
 
+		bool GeometricObjectPolygon::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!GeometricObject::DoLoadBinary(reader))
+				return false;
+			if (!ReadPointArray(reader, points))
+				return false;
+			reader.Read(size);
+			return reader.IsValid();
+		}
+
+		void GeometricObjectPolygon::DoSaveBinary(BinaryWriter& writer) const
+		{
+			GeometricObject::DoSaveBinary(writer);
+			WritePointArray(writer, points);
+			writer.Write(size);
+		}
+
 		// ==========================================
 		// GeometricObjectPolyline methods
 		// ==========================================
@@ -245,6 +313,23 @@ namespace chaos
 			return result;
 		}
 
+		bool GeometricObjectPolyline::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!GeometricObject::DoLoadBinary(reader))
+				return false;
+			if (!ReadPointArray(reader, points))
+				return false;
+			reader.Read(size);
+			return reader.IsValid();
+		}
+
+		void GeometricObjectPolyline::DoSaveBinary(BinaryWriter& writer) const
+		{
+			GeometricObject::DoSaveBinary(writer);
+			WritePointArray(writer, points);
+			writer.Write(size);
+		}
+
 		// ==========================================
 		// GeometricObjectText methods
 		// ==========================================
@@ -272,6 +357,32 @@ namespace chaos
 			return true;
 		}
 
+		bool GeometricObjectText::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!GeometricObjectSurface::DoLoadBinary(reader))
+				return false;
+			reader.Read(halign);
+			reader.Read(valign);
+			reader.Read(pixelsize);
+			reader.Read(wrap);
+			reader.Read(fontfamily);
+			reader.Read(color);
+			reader.Read(text);
+			return reader.IsValid();
+		}
+
+		void GeometricObjectText::DoSaveBinary(BinaryWriter& writer) const
+		{
+			GeometricObjectSurface::DoSaveBinary(writer);
+			writer.Write(halign);
+			writer.Write(valign);
+			writer.Write(pixelsize);
+			writer.Write(wrap);
+			writer.Write(fontfamily);
+			writer.Write(color);
+			writer.Write(text);
+		}
+
 		// ==========================================
 		// GeometricObjectTile methods
 		// ==========================================
@@ -290,6 +401,22 @@ namespace chaos
 			return true;
 		}
 
+		bool GeometricObjectTile::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!GeometricObjectSurface::DoLoadBinary(reader))
+				return false;
+			reader.Read(gid);
+			reader.Read(particle_flags);
+			return reader.IsValid();
+		}
+
+		void GeometricObjectTile::DoSaveBinary(BinaryWriter& writer) const
+		{
+			GeometricObjectSurface::DoSaveBinary(writer);
+			writer.Write(gid);
+			writer.Write(particle_flags);
+		}
+
 		box2 GeometricObjectTile::DoGetBoundingBox() const
 		{
 			// search the alignment for this tile
@@ -34,6 +34,32 @@ namespace chaos
 			return true;
 		}
 
+		bool LayerBase::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!PropertyOwner::DoLoadBinary(reader))
+				return false;
+			reader.Read(id);
+			reader.Read(name);
+			reader.Read(visible);
+			reader.Read(locked);
+			reader.Read(opacity);
+			reader.Read(offset);
+			reader.Read(parallax_factor);
+			return reader.IsValid();
+		}
+
+		void LayerBase::DoSaveBinary(BinaryWriter& writer) const
+		{
+			PropertyOwner::DoSaveBinary(writer);
+			writer.Write(id);
+			writer.Write(name);
+			writer.Write(visible);
+			writer.Write(locked);
+			writer.Write(opacity);
+			writer.Write(offset);
+			writer.Write(parallax_factor);
+		}
+
 		Property const* LayerBase::FindProperty(char const* name, PropertyType type_id) const
 		{
 			// super method
@@ -72,6 +98,24 @@ namespace chaos
 			return true;
 		}
 
+		bool ImageLayer::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!LayerBase::DoLoadBinary(reader))
+				return false;
+			reader.Read(transparent_color);
+			reader.Read(size);
+			reader.Read(image_path);
+			return reader.IsValid();
+		}
+
+		void ImageLayer::DoSaveBinary(BinaryWriter& writer) const
+		{
+			LayerBase::DoSaveBinary(writer);
+			writer.Write(transparent_color);
+			writer.Write(size);
+			writer.Write(image_path);
+		}
+
 		// ==========================================
 		// LayerBase methods
 		// ==========================================
@@ -145,6 +189,96 @@ namespace chaos
 			return true;
 		}
 
+		// the types of geometric object in binary format
+		enum class BinaryGeometricObjectType : uint8_t
+		{
+			UNKNOWN = 0,
+			POINT = 1,
+			RECTANGLE = 2,
+			ELLIPSE = 3,
+			POLYGON = 4,
+			POLYLINE = 5,
+			TEXT = 6,
+			TILE = 7
+		};
+
+		bool ObjectLayer::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!LayerBase::DoLoadBinary(reader))
+				return false;
+			reader.Read(color);
+			reader.Read(draw_order);
+
+			uint32_t count = 0;
+			if (!reader.ReadCount(count))
+				return false;
+
+			geometric_objects.reserve(count);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				BinaryGeometricObjectType object_type = BinaryGeometricObjectType::UNKNOWN;
+				reader.Read(object_type);
+
+				shared_ptr<GeometricObject> object;
+				if (object_type == BinaryGeometricObjectType::POINT)
+					object = new GeometricObjectPoint(this);
+				else if (object_type == BinaryGeometricObjectType::RECTANGLE)
+					object = new GeometricObjectRectangle(this);
+				else if (object_type == BinaryGeometricObjectType::ELLIPSE)
+					object = new GeometricObjectEllipse(this);
+				else if (object_type == BinaryGeometricObjectType::POLYGON)
+					object = new GeometricObjectPolygon(this);
+				else if (object_type == BinaryGeometricObjectType::POLYLINE)
+					object = new GeometricObjectPolyline(this);
+				else if (object_type == BinaryGeometricObjectType::TEXT)
+					object = new GeometricObjectText(this);
+				else if (object_type == BinaryGeometricObjectType::TILE)
+					object = new GeometricObjectTile(this);
+
+				if (object == nullptr || !object->DoLoadBinary(reader))
+					return false;
+				geometric_objects.push_back(std::move(object));
+			}
+			return reader.IsValid();
+		}
+
+		void ObjectLayer::DoSaveBinary(BinaryWriter& writer) const
+		{
+			LayerBase::DoSaveBinary(writer);
+			writer.Write(color);
+			writer.Write(draw_order);
+
+			writer.Write(uint32_t(geometric_objects.size()));
+			for (shared_ptr<GeometricObject> const& object : geometric_objects)
+			{
+				GeometricObject const* geometric_object = object.get();
+
+				BinaryGeometricObjectType object_type = BinaryGeometricObjectType::UNKNOWN;
+				if (GeometricObjectPoint const* point = auto_cast(geometric_object))
+					object_type = BinaryGeometricObjectType::POINT;
+				else if (GeometricObjectRectangle const* rectangle = auto_cast(geometric_object))
+					object_type = BinaryGeometricObjectType::RECTANGLE;
+				else if (GeometricObjectEllipse const* ellipse = auto_cast(geometric_object))
+					object_type = BinaryGeometricObjectType::ELLIPSE;
+				else if (GeometricObjectPolygon const* polygon = auto_cast(geometric_object))
+					object_type = BinaryGeometricObjectType::POLYGON;
+				else if (GeometricObjectPolyline const* polyline = auto_cast(geometric_object))
+					object_type = BinaryGeometricObjectType::POLYLINE;
+				else if (GeometricObjectText const* text = auto_cast(geometric_object))
+					object_type = BinaryGeometricObjectType::TEXT;
+				else if (GeometricObjectTile const* tile = auto_cast(geometric_object))
+					object_type = BinaryGeometricObjectType::TILE;
+
+				writer.Write(object_type);
+				if (object_type == BinaryGeometricObjectType::UNKNOWN) // the binary data will be rejected on loading
+				{
+					assert(0);
+					return;
+				}
+				geometric_object->DoSaveBinary(writer);
+			}
+		}
+
 		// ==========================================
 		// TileLayerChunk methods
 		// ==========================================
@@ -211,6 +345,61 @@ namespace chaos
 			return true;
 		}
 
+		bool TileLayer::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!LayerBase::DoLoadBinary(reader))
+				return false;
+			reader.Read(size);
+
+			uint32_t chunk_count = 0;
+			if (!reader.ReadCount(chunk_count))
+				return false;
+
+			tile_chunks.reserve(chunk_count);
+			for (uint32_t i = 0; i < chunk_count; ++i)
+			{
+				TileLayerChunk chunk;
+				reader.Read(chunk.size);
+				reader.Read(chunk.offset);
+
+				uint32_t tile_count = 0;
+				if (!reader.ReadCount(tile_count))
+					return false;
+				chunk.tile_indices.resize(tile_count);
+				if (!reader.ReadData(chunk.tile_indices.data(), tile_count * sizeof(Tile)))
+					return false;
+				tile_chunks.push_back(std::move(chunk));
+			}
+			if (!reader.IsValid())
+				return false;
+			// the additionnal flags depend on the tilesets and on the processors configuration: they are not saved
+			ComputeTileFlags();
+			return true;
+		}
+
+		void TileLayer::DoSaveBinary(BinaryWriter& writer) const
+		{
+			LayerBase::DoSaveBinary(writer);
+			writer.Write(size);
+
+			int const flip_flags = ParticleFlags::TEXTURE_HORIZONTAL_FLIP | ParticleFlags::TEXTURE_VERTICAL_FLIP | ParticleFlags::TEXTURE_DIAGONAL_FLIP;
+
+			writer.Write(uint32_t(tile_chunks.size()));
+			for (TileLayerChunk const& chunk : tile_chunks)
+			{
+				writer.Write(chunk.size);
+				writer.Write(chunk.offset);
+
+				// keep only the flags that come from the GID (see DecodeTileGID(...))
+				std::vector<Tile> tiles = chunk.tile_indices;
+				for (Tile& tile : tiles)
+					tile.flags &= flip_flags;
+
+				writer.Write(uint32_t(tiles.size()));
+				writer.WriteData(tiles.data(), tiles.size() * sizeof(Tile));
+			}
+		}
+
 		void TileLayer::ComputeTileFlags()
 		{
 			// get all TileProcessor
@@ -238,29 +427,155 @@ namespace chaos
 			}
 		}
 
-		std::vector<Tile> TileLayer::DoLoadTileChunkFromBuffer(Buffer<char> const & buffer, glm::ivec2 const & chunk_size)
+		/** an utility class to convert a stream of bytes into tiles (little endian 32 bits values) */
+		class TileStreamWriter
 		{
-			size_t count = (size_t)(chunk_size.x * chunk_size.y);
+		public:
 
-			if (buffer.bufsize != count * sizeof(uint32_t))  // array width * height * sizeof(uint32)
-				return {};
+			/** constructor */
+			TileStreamWriter(std::vector<Tile>& in_tiles, size_t in_count) :
+				tiles(in_tiles),
+				count(in_count)
+			{
+				tiles.reserve(count);
+			}
 
-			std::vector<Tile> result;
-			result.reserve(count);
+			/** append some bytes (returns false if there are more bytes than expected) */
+			bool Write(unsigned char const* data, size_t size)
+			{
+				for (size_t i = 0; i < size; ++i)
+				{
+					// complete tiles are read directly
+					if (pending_count == 0)
+					{
+						while (i + 4 <= size)
+						{
+							if (tiles.size() == count)
+								return false;
+							PushTile(data + i);
+							i += 4;
+						}
+						if (i == size)
+							break;
+					}
+					pending[pending_count++] = data[i];
+					if (pending_count == 4)
+					{
+						if (tiles.size() == count)
+							return false;
+						PushTile(pending);
+						pending_count = 0;
+					}
+				}
+				return true;
+			}
 
-			// transform the char buffer into tiles
-			for (size_t i = 0; i < count; ++i)
+			/** returns whether all tiles have been read */
+			bool IsComplete() const
 			{
-				unsigned int a = (unsigned int)buffer[i * 4 + 0];
-				unsigned int b = (unsigned int)buffer[i * 4 + 1];
-				unsigned int c = (unsigned int)buffer[i * 4 + 2];
-				unsigned int d = (unsigned int)buffer[i * 4 + 3];
+				return (tiles.size() == count && pending_count == 0);
+			}
 
+		protected:
+
+			/** insert a tile */
+			void PushTile(unsigned char const* bytes)
+			{
 				// do not decode yet the ID and the flags
-				unsigned int pseudo_id = (a << 0) | (b << 8) | (c << 16) | (d << 24);
-				result.push_back({ *(int *)&pseudo_id, 0 });
+				uint32_t pseudo_id = (uint32_t(bytes[0]) << 0) | (uint32_t(bytes[1]) << 8) | (uint32_t(bytes[2]) << 16) | (uint32_t(bytes[3]) << 24);
+				tiles.push_back({ int(pseudo_id), 0 });
 			}
-			return result;
+
+		protected:
+
+			/** the destination */
+			std::vector<Tile>& tiles;
+			/** the expected number of tiles */
+			size_t count = 0;
+			/** the bytes of an incomplete tile */
+			unsigned char pending[4];
+			/** the number of pending bytes */
+			int pending_count = 0;
+		};
+
+		bool TileLayer::DoLoadTileChunkFromBase64(char const* text, char const* compression, size_t count, std::vector<Tile>& tiles)
+		{
+			static constexpr size_t CHUNK_SIZE = 1024 * 12;
+
+			TileStreamWriter writer(tiles, count);
+
+			// skip the heading non base64 characters (spaces and line returns)
+			while (*text != 0 && !MyBase64::IsBase64((unsigned char)*text))
+				++text;
+
+			// the base64 text is decoded by parts that are directly given to the decompressor
+			unsigned char base64_buffer[CHUNK_SIZE];
+			unsigned char output_buffer[CHUNK_SIZE];
+
+			// zlib or gzip
+			if (StringTools::Stricmp(compression, "zlib") == 0 || StringTools::Stricmp(compression, "gzip") == 0)
+			{
+				z_stream strm;
+				strm.zalloc = Z_NULL;
+				strm.zfree = Z_NULL;
+				strm.opaque = Z_NULL;
+				strm.avail_in = 0;
+				strm.next_in = Z_NULL;
+
+				if (inflateInit2(&strm, 15 + 32) != Z_OK) // 15 + 32 : automatic zlib/gzip header detection
+					return false;
+
+				bool stream_end = false;
+				while (!stream_end)
+				{
+					size_t size = MyBase64::DecodePart(text, base64_buffer, CHUNK_SIZE);
+					if (size == 0)
+						break;
+
+					strm.avail_in = (uInt)size;
+					strm.next_in = base64_buffer;
+					do
+					{
+						strm.avail_out = (uInt)CHUNK_SIZE;
+						strm.next_out = output_buffer;
+
+						int error = inflate(&strm, Z_NO_FLUSH);
+						if (error == Z_NEED_DICT || error == Z_DATA_ERROR || error == Z_MEM_ERROR || error == Z_STREAM_ERROR)
+						{
+							Log::Error("TileLayer::DoLoadTileChunkFromBase64: inflate failure [%s]", (strm.msg != nullptr) ? strm.msg : "");
+							inflateEnd(&strm);
+							return false;
+						}
+						if (!writer.Write(output_buffer, CHUNK_SIZE - strm.avail_out))
+						{
+							inflateEnd(&strm);
+							return false;
+						}
+						if (error == Z_STREAM_END)
+						{
+							stream_end = true;
+							break;
+						}
+					}
+					while (strm.avail_out == 0 || strm.avail_in > 0);
+				}
+				inflateEnd(&strm);
+			}
+			// no compression
+			else if (compression == nullptr || compression[0] == 0)
+			{
+				while (size_t size = MyBase64::DecodePart(text, output_buffer, CHUNK_SIZE))
+					if (!writer.Write(output_buffer, size))
+						return false;
+			}
+			else
+			{
+				Log::Error("TileLayer::DoLoadTileChunkFromBase64: unknown compression [%s]", compression);
+				return false;
+			}
+
+			// array width * height * sizeof(uint32)
+			return writer.IsComplete();
 		}
 
 		bool TileLayer::DoLoadTileChunk(tinyxml2::XMLElement const* element, char const* encoding, char const* compression)
@@ -285,37 +600,8 @@ namespace chaos
 				if (txt == nullptr)
 					return true;
 
-				if (StringTools::Stricmp(compression, "gzip") == 0)
-				{
-					assert(0);
-
-					// TODO
-
-				}
-				else if (StringTools::Stricmp(compression, "zstd") == 0)
-				{
-					assert(0);
-
-					// TODO
-
-				}
-				else if (StringTools::Stricmp(compression, "zlib") == 0)
-				{
-					std::string content = StringTools::TrimBase64(txt);
-
-					Buffer<char> base64 = MyBase64().Decode(content.c_str());
-					Buffer<char> decoded = MyZLib().Decode(base64);
-
-					tiles = DoLoadTileChunkFromBuffer(decoded, chunk_size);
-				}
-				else // no encoding
-				{
-					std::string content = StringTools::TrimBase64(txt);
-
-					Buffer<char> base64 = MyBase64().Decode(content.c_str());
-
-					tiles = DoLoadTileChunkFromBuffer(base64, chunk_size);
-				}
+				if (!DoLoadTileChunkFromBase64(txt, compression, (size_t)(chunk_size.x * chunk_size.y), tiles))
+					tiles.clear();
 			}
 			else if (StringTools::Stricmp(encoding, "csv") == 0)
 			{
@@ -442,6 +728,21 @@ namespace chaos
 			return true;
 		}
 
+		bool GroupLayer::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!LayerBase::DoLoadBinary(reader))
+				return false;
+			if (!DoLoadBinaryLayersImpl(reader, layers))
+				return false;
+			return true;
+		}
+
+		void GroupLayer::DoSaveBinary(BinaryWriter& writer) const
+		{
+			LayerBase::DoSaveBinary(writer);
+			DoSaveBinaryLayersImpl(writer, layers);
+		}
+
 	};  // namespace TiledMap
 
 }; // namespace chaos
@@ -58,6 +58,27 @@ return_type * Manager::funcname(FilePathParam const & path, bool store_object)\
 return_type * Manager::funcname(FilePathParam const & path, Buffer<char> buffer, bool store_object)\
 {\
 	return_type * result = nullptr;\
+	uint64_t key = 0;\
+	boost::filesystem::path cache_path;\
+	if (!cache_directory.empty())\
+	{\
+		key = GetCacheKey(#return_type, buffer);\
+		cache_path = GetCachePath(key);\
+		result = new return_type(this, path.GetResolvedPath());\
+		if (result != nullptr)\
+		{\
+			if (result->DoLoadBinaryFile(cache_path, key))\
+			{\
+				OnCacheEntryLoaded(cache_path);\
+				if (store_object)\
+					member_name.push_back(result);\
+				return result;\
+			}\
+			RemoveTileSetsOwnedBy(result);\
+			delete(result);\
+			result = nullptr;\
+		}\
+	}\
 	tinyxml2::XMLDocument * doc = new tinyxml2::XMLDocument();\
 	if (doc != nullptr)\
 	{\
@@ -66,6 +87,9 @@ return_type * Manager::funcname(FilePathParam const & path, Buffer<char> buffer,
 			result = funcname(path, doc, store_object);\
 		delete(doc);\
 	}\
+	if (result != nullptr && !cache_path.empty())\
+		if (result->DoSaveBinaryFile(cache_path, key))\
+			OnCacheEntrySaved(cache_path);\
 	return result;\
 }\
 return_type * Manager::funcname(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object)\
@@ -81,6 +105,7 @@ return_type * Manager::funcname(FilePathParam const & path, tinyxml2::XMLDocumen
 		}\
 		else\
 		{\
+			RemoveTileSetsOwnedBy(result);\
 			delete(result);\
 			result = nullptr;\
 		}\
@@ -94,6 +119,160 @@ return_type * Manager::funcname(FilePathParam const & path, tinyxml2::XMLDocumen
 
 #undef CHAOS_IMPL_MANAGER_DOLOAD
 
+		// XXX : the binary form of a XML file is searched in the cache with a key computed from the XML content,
+		//       so that any modification of the file makes the binary form stale (the XML file is then loaded and the binary form written again).
+		//       The cache can be filled offline by loading all the files with the same cache directory.
+		//       Stale entries are never read again : they are removed when too old or when the cache exceeds its max size.
+
+		void Manager::SetCacheDirectory(FilePathParam const & path)
+		{
+			cache_directory = path.GetResolvedPath();
+			if (!cache_directory.empty())
+			{
+				boost::system::error_code error_code;
+				boost::filesystem::create_directories(cache_directory, error_code);
+				if (error_code)
+				{
+					Log::Error("Manager::SetCacheDirectory => failed to create directory [%s]", cache_directory.string().c_str());
+					cache_directory.clear();
+					return;
+				}
+				TrimCache();
+			}
+		}
+
+		void Manager::SetCacheMaxSize(uintmax_t in_max_size)
+		{
+			cache_max_size = in_max_size;
+			if (!cache_directory.empty())
+				TrimCache();
+		}
+
+		void Manager::SetCacheMaxAge(std::time_t in_max_age)
+		{
+			cache_max_age = std::max(in_max_age, std::time_t(0));
+			if (!cache_directory.empty())
+				TrimCache();
+		}
+
+		void Manager::OnCacheEntryLoaded(boost::filesystem::path const & cache_path)
+		{
+			// the age of an entry is the time since it was last used
+			boost::system::error_code error_code;
+			boost::filesystem::last_write_time(cache_path, std::time(nullptr), error_code);
+		}
+
+		void Manager::OnCacheEntrySaved(boost::filesystem::path const & cache_path)
+		{
+			// keep the cache into its budget
+			boost::system::error_code error_code;
+			uintmax_t size = boost::filesystem::file_size(cache_path, error_code);
+			if (!error_code)
+				cache_size += size;
+			if (cache_size > cache_max_size)
+				TrimCache();
+		}
+
+		void Manager::TrimCache()
+		{
+			class CacheEntry
+			{
+			public:
+
+				boost::filesystem::path path;
+				uintmax_t size = 0;
+				std::time_t time = 0;
+			};
+
+			std::time_t now = std::time(nullptr);
+
+			// collect the entries (temporary files are remains of interrupted writes, the entries that have not been used for too long are removed immediately)
+			std::vector<CacheEntry> entries;
+			cache_size = 0;
+
+			boost::system::error_code error_code;
+			for (boost::filesystem::directory_iterator it(cache_directory, error_code), end; !error_code && it != end; it.increment(error_code))
+			{
+				boost::filesystem::path const & entry_path = it->path();
+				if (entry_path.extension() == ".tmp")
+				{
+					boost::filesystem::remove(entry_path, error_code);
+					error_code.clear();
+					continue;
+				}
+				if (entry_path.extension() != ".tmb")
+					continue;
+
+				CacheEntry entry;
+				entry.path = entry_path;
+				entry.size = boost::filesystem::file_size(entry_path, error_code);
+				entry.time = boost::filesystem::last_write_time(entry_path, error_code);
+				if (error_code)
+				{
+					error_code.clear();
+					continue;
+				}
+				if (cache_max_age > 0 && now - entry.time > cache_max_age)
+				{
+					if (boost::filesystem::remove(entry_path, error_code))
+						continue;
+					error_code.clear();
+				}
+				cache_size += entry.size;
+				entries.push_back(std::move(entry));
+			}
+			if (cache_size <= cache_max_size)
+				return;
+
+			// remove the least recently used entries
+			std::sort(entries.begin(), entries.end(), [](CacheEntry const & src1, CacheEntry const & src2)
+			{
+				return (src1.time < src2.time);
+			});
+			for (CacheEntry const & entry : entries)
+			{
+				if (cache_size <= cache_max_size)
+					break;
+				if (boost::filesystem::remove(entry.path, error_code))
+					cache_size -= entry.size;
+				error_code.clear();
+			}
+		}
+
+		uint64_t Manager::GetCacheKey(char const * type_name, Buffer<char> const & buffer)
+		{
+			// FNV-1a
+			auto update_hash = [](uint64_t hash, void const * data, size_t size)
+			{
+				unsigned char const * bytes = (unsigned char const *)data;
+				for (size_t i = 0; i < size; ++i)
+				{
+					hash ^= uint64_t(bytes[i]);
+					hash *= 1099511628211ULL;
+				}
+				return hash;
+			};
+
+			uint64_t result = 14695981039346656037ULL;
+			result = update_hash(result, &BINARY_VERSION, sizeof(BINARY_VERSION));
+			result = update_hash(result, type_name, strlen(type_name));
+			result = update_hash(result, buffer.data, buffer.bufsize);
+			return result;
+		}
+
+		boost::filesystem::path Manager::GetCachePath(uint64_t key) const
+		{
+			return cache_directory / StringTools::Printf("%016llx.tmb", (unsigned long long)key);
+		}
+
+		void Manager::RemoveTileSetsOwnedBy(BaseObject const * owner)
+		{
+			std::erase_if(tile_sets, [owner](shared_ptr<TileSet> const & tileset)
+			{
+				return (tileset->owner == owner);
+			});
+		}
+
 		Property const * Manager::FindObjectProperty(char const * type, char const * name, PropertyType type_id) const
 		{
 			if (StringTools::IsEmpty(type))
@@ -44,6 +44,58 @@ namespace chaos
 			return true;
 		}
 
+		bool ManagerObject::DoLoadBinaryFile(boost::filesystem::path const & binary_path, uint64_t key)
+		{
+			Buffer<char> buffer = FileTools::LoadFile(binary_path, LoadFileFlag::NO_ERROR_TRACE);
+			if (buffer == nullptr)
+				return false;
+
+			BinaryReader reader(buffer, path);
+
+			char magic[sizeof(BINARY_MAGIC)];
+			uint32_t version = 0;
+			uint64_t file_key = 0;
+			std::string markup_name;
+			reader.ReadData(magic, sizeof(magic));
+			reader.Read(version);
+			reader.Read(file_key);
+			reader.Read(markup_name);
+			if (!reader.IsValid() || memcmp(magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0 || version != BINARY_VERSION || file_key != key)
+				return false;
+			if (StringTools::Stricmp(markup_name, GetXMLMarkupName()) != 0)
+				return false;
+
+			if (!DoLoadBinary(reader))
+				return false;
+			return reader.IsValid() && reader.IsEOF();
+		}
+
+		bool ManagerObject::DoSaveBinaryFile(boost::filesystem::path const & binary_path, uint64_t key) const
+		{
+			BinaryWriter writer(path);
+			writer.WriteData(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+			writer.Write(BINARY_VERSION);
+			writer.Write(key);
+			writer.Write(std::string(GetXMLMarkupName()));
+			DoSaveBinary(writer);
+			return writer.SaveFile(binary_path);
+		}
+
+		bool ManagerObject::DoLoadBinary(BinaryReader & reader)
+		{
+			if (!PropertyOwner::DoLoadBinary(reader))
+				return false;
+			if (!DoLoadBinaryMembers(reader))
+				return false;
+			return true;
+		}
+
+		void ManagerObject::DoSaveBinary(BinaryWriter & writer) const
+		{
+			PropertyOwner::DoSaveBinary(writer);
+			DoSaveBinaryMembers(writer);
+		}
+
 	};  // namespace TiledMap
 
 }; // namespace chaos
@@ -131,6 +131,129 @@ namespace chaos
 			return true;
 		}
 
+		bool Map::DoLoadBinaryMembers(BinaryReader& reader)
+		{
+			reader.Read(orientation);
+			reader.Read(stagger_axis);
+			reader.Read(stagger_index);
+			reader.Read(render_order);
+			reader.Read(compressionlevel);
+			reader.Read(version);
+			reader.Read(size);
+			reader.Read(tile_size);
+			reader.Read(infinite);
+			reader.Read(hex_side_length);
+			reader.Read(background_color);
+			return reader.IsValid();
+		}
+
+		void Map::DoSaveBinaryMembers(BinaryWriter& writer) const
+		{
+			writer.Write(orientation);
+			writer.Write(stagger_axis);
+			writer.Write(stagger_index);
+			writer.Write(render_order);
+			writer.Write(compressionlevel);
+			writer.Write(version);
+			writer.Write(size);
+			writer.Write(tile_size);
+			writer.Write(infinite);
+			writer.Write(hex_side_length);
+			writer.Write(background_color);
+		}
+
+		bool Map::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!ManagerObject::DoLoadBinary(reader))
+				return false;
+			if (!DoLoadBinaryTileSet(reader))
+				return false;
+			if (!DoLoadBinaryLayersImpl(reader, layers))
+				return false;
+			return true;
+		}
+
+		void Map::DoSaveBinary(BinaryWriter& writer) const
+		{
+			ManagerObject::DoSaveBinary(writer);
+			DoSaveBinaryTileSet(writer);
+			DoSaveBinaryLayersImpl(writer, layers);
+		}
+
+		bool Map::DoLoadBinaryTileSet(BinaryReader& reader)
+		{
+			// get the manager
+			Manager * manager = GetOwner<Manager>();
+			if (manager == nullptr)
+				return false;
+
+			uint32_t count = 0;
+			if (!reader.ReadCount(count))
+				return false;
+
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				int first_gid = 0;
+				bool embedded = false;
+				reader.Read(first_gid);
+				reader.Read(embedded);
+				if (!reader.IsValid())
+					return false;
+
+				TileSet * tileset = nullptr;
+
+				// external tileset (it has its own binary file)
+				if (!embedded)
+				{
+					boost::filesystem::path tileset_path;
+					if (!reader.Read(tileset_path))
+						return false;
+
+					tileset = manager->LoadTileSet(tileset_path);
+					if (tileset == nullptr)
+						return false;
+				}
+				// embedded titleset
+				else
+				{
+					tileset = new TileSet(this, boost::filesystem::path());
+					if (tileset == nullptr)
+						return false;
+
+					if (!tileset->DoLoadBinary(reader))
+					{
+						delete(tileset);
+						return false;
+					}
+					manager->tile_sets.push_back(tileset);
+				}
+
+				// the range of ids is computed again because the external tileset may have changed
+				TileSetData data;
+				data.first_gid   = first_gid;
+				data.min_tile_id = first_gid + tileset->min_tile_id;
+				data.max_tile_id = first_gid + tileset->max_tile_id;
+				data.tileset = tileset;
+				tilesets.push_back(data);
+			}
+			return true;
+		}
+
+		void Map::DoSaveBinaryTileSet(BinaryWriter& writer) const
+		{
+			writer.Write(uint32_t(tilesets.size()));
+			for (TileSetData const& data : tilesets)
+			{
+				bool embedded = (data.tileset->owner == this);
+				writer.Write(data.first_gid);
+				writer.Write(embedded);
+				if (embedded)
+					data.tileset->DoSaveBinary(writer);
+				else
+					writer.Write(data.tileset->GetPath());
+			}
+		}
+
 		size_t Map::GetLayerCount() const
 		{
 			return layers.size();
@@ -18,6 +18,22 @@ namespace chaos
 			return true;
 		}
 
+		bool ObjectTypeDefinition::DoLoadBinary(BinaryReader & reader)
+		{
+			if (!PropertyOwner::DoLoadBinary(reader))
+				return false;
+			reader.Read(name);
+			reader.Read(color);
+			return reader.IsValid();
+		}
+
+		void ObjectTypeDefinition::DoSaveBinary(BinaryWriter & writer) const
+		{
+			PropertyOwner::DoSaveBinary(writer);
+			writer.Write(name);
+			writer.Write(color);
+		}
+
 		// ==========================================
 		// ObjectTypeSet methods
 		// ==========================================
@@ -43,6 +59,21 @@ namespace chaos
 			return true;
 		}
 
+		bool ObjectTypeSet::DoLoadBinary(BinaryReader & reader)
+		{
+			if (!ManagerObject::DoLoadBinary(reader))
+				return false;
+			if (!DoLoadBinaryObjectListHelper(reader, object_types, this))
+				return false;
+			return true;
+		}
+
+		void ObjectTypeSet::DoSaveBinary(BinaryWriter & writer) const
+		{
+			ManagerObject::DoSaveBinary(writer);
+			DoSaveBinaryObjectListHelper(writer, object_types);
+		}
+
 		ObjectTypeDefinition * ObjectTypeSet::FindObjectType(char const * name)
 		{
 			size_t count = object_types.size();
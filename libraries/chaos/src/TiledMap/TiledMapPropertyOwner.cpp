@@ -212,6 +212,84 @@ namespace chaos
 			return true;
 		}
 
+		bool PropertyOwner::DoLoadBinary(BinaryReader& reader)
+		{
+			uint32_t count = 0;
+			if (!reader.ReadCount(count))
+				return false;
+
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				PropertyType property_type = PropertyType::ANY;
+				std::string property_name;
+				reader.Read(property_type);
+				reader.Read(property_name);
+
+				if (property_type == PropertyType::INT)
+				{
+					int value = 0;
+					if (reader.Read(value))
+						CreatePropertyInt(property_name.c_str(), value);
+				}
+				else if (property_type == PropertyType::FLOAT)
+				{
+					float value = 0.0f;
+					if (reader.Read(value))
+						CreatePropertyFloat(property_name.c_str(), value);
+				}
+				else if (property_type == PropertyType::BOOL)
+				{
+					bool value = false;
+					if (reader.Read(value))
+						CreatePropertyBool(property_name.c_str(), value);
+				}
+				else if (property_type == PropertyType::STRING)
+				{
+					std::string value;
+					if (reader.Read(value))
+						CreatePropertyString(property_name.c_str(), value.c_str());
+				}
+				else if (property_type == PropertyType::COLOR)
+				{
+					glm::vec4 value = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+					if (reader.Read(value))
+						CreatePropertyColor(property_name.c_str(), value);
+				}
+				else if (property_type == PropertyType::OBJECT)
+				{
+					int value = 0;
+					if (reader.Read(value))
+						CreatePropertyObject(property_name.c_str(), value);
+				}
+				else
+					return false;
+			}
+			return reader.IsValid();
+		}
+
+		void PropertyOwner::DoSaveBinary(BinaryWriter& writer) const
+		{
+			writer.Write(uint32_t(properties.size()));
+			for (shared_ptr<Property> const& property : properties)
+			{
+				writer.Write(property->GetPropertyType());
+				writer.Write(property->name);
+
+				if (int const* value = property->GetPropertyInt())
+					writer.Write(*value);
+				else if (float const* value = property->GetPropertyFloat())
+					writer.Write(*value);
+				else if (bool const* value = property->GetPropertyBool())
+					writer.Write(*value);
+				else if (std::string const* value = property->GetPropertyString())
+					writer.Write(*value);
+				else if (glm::vec4 const* value = property->GetPropertyColor())
+					writer.Write(*value);
+				else if (int const* value = property->GetPropertyObject())
+					writer.Write(*value);
+			}
+		}
+
 #define CHAOS_CREATE_PROPERTY(suffix, result_type, arg_type)\
 		result_type * PropertyOwner::CreateProperty##suffix(char const * name, arg_type value)\
 		{\
@@ -279,6 +357,20 @@ namespace chaos
 			return true;
 		}
 
+		bool TypedObject::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!PropertyOwner::DoLoadBinary(reader))
+				return false;
+			reader.Read(type);
+			return reader.IsValid();
+		}
+
+		void TypedObject::DoSaveBinary(BinaryWriter& writer) const
+		{
+			PropertyOwner::DoSaveBinary(writer);
+			writer.Write(type);
+		}
+
 	};  // namespace TiledMap
 
 }; // namespace chaos
@@ -25,6 +25,23 @@ namespace chaos
 			return true;
 		}
 
+		bool WangEdgeColor::DoLoadBinary(BinaryReader& reader)
+		{
+			reader.Read(name);
+			reader.Read(tile_id);
+			reader.Read(probability);
+			reader.Read(color);
+			return reader.IsValid();
+		}
+
+		void WangEdgeColor::DoSaveBinary(BinaryWriter& writer) const
+		{
+			writer.Write(name);
+			writer.Write(tile_id);
+			writer.Write(probability);
+			writer.Write(color);
+		}
+
 		bool WangTile::DoLoad(tinyxml2::XMLElement const* element)
 		{
 			XMLTools::ReadAttribute(element, "tileid", tile_id);
@@ -32,6 +49,19 @@ namespace chaos
 			return true;
 		}
 
+		bool WangTile::DoLoadBinary(BinaryReader& reader)
+		{
+			reader.Read(tile_id);
+			reader.Read(wang_id);
+			return reader.IsValid();
+		}
+
+		void WangTile::DoSaveBinary(BinaryWriter& writer) const
+		{
+			writer.Write(tile_id);
+			writer.Write(wang_id);
+		}
+
 		int WangTile::GetCornerValue(Corner corner) const
 		{
 			return int((wang_id >> (int(corner) * 8 + 4)) & 0xF); // each byte encode a CORNER + EDGE (so, x 8)
@@ -108,6 +138,31 @@ namespace chaos
 			return true;
 		}
 
+		bool Wangset::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!PropertyOwner::DoLoadBinary(reader))
+				return false;
+			reader.Read(tile_id);
+			reader.Read(name);
+			if (!DoLoadBinaryObjectListHelper(reader, wang_edge_colors))
+				return false;
+			if (!DoLoadBinaryObjectListHelper(reader, wang_corner_colors))
+				return false;
+			if (!DoLoadBinaryObjectListHelper(reader, wang_tiles)) // already sorted
+				return false;
+			return true;
+		}
+
+		void Wangset::DoSaveBinary(BinaryWriter& writer) const
+		{
+			PropertyOwner::DoSaveBinary(writer);
+			writer.Write(tile_id);
+			writer.Write(name);
+			DoSaveBinaryObjectListHelper(writer, wang_edge_colors);
+			DoSaveBinaryObjectListHelper(writer, wang_corner_colors);
+			DoSaveBinaryObjectListHelper(writer, wang_tiles);
+		}
+
 		WangTile Wangset::GetWangTile(int tile_id) const
 		{
 			// suppose list sorted
@@ -131,6 +186,22 @@ namespace chaos
 			return true;
 		}
 
+		bool GroundData::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!PropertyOwner::DoLoadBinary(reader))
+				return false;
+			reader.Read(tile_id);
+			reader.Read(name);
+			return reader.IsValid();
+		}
+
+		void GroundData::DoSaveBinary(BinaryWriter& writer) const
+		{
+			PropertyOwner::DoSaveBinary(writer);
+			writer.Write(tile_id);
+			writer.Write(name);
+		}
+
 		// ==========================================
 		// TileData methods
 		// ==========================================
@@ -169,6 +240,35 @@ namespace chaos
 			return true;
 		}
 
+		bool TileData::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!TypedObject::DoLoadBinary(reader))
+				return false;
+			reader.Read(id);
+			reader.Read(probability);
+			for (int& terrain_index : terrain_indices)
+				reader.Read(terrain_index);
+			reader.Read(image_path);
+			reader.Read(image_size);
+			reader.Read(atlas_key);
+			if (!DoLoadBinaryObjectListHelper(reader, object_layers, this))
+				return false;
+			return true;
+		}
+
+		void TileData::DoSaveBinary(BinaryWriter& writer) const
+		{
+			TypedObject::DoSaveBinary(writer);
+			writer.Write(id);
+			writer.Write(probability);
+			for (int terrain_index : terrain_indices)
+				writer.Write(terrain_index);
+			writer.Write(image_path);
+			writer.Write(image_size);
+			writer.Write(atlas_key);
+			DoSaveBinaryObjectListHelper(writer, object_layers);
+		}
+
 		// "0,,," => top left
 		// ",0,," => top right
 		// ",,0," => bottom left
@@ -355,6 +455,66 @@ namespace chaos
 			return true;
 		}
 
+		bool TileSet::DoLoadBinaryMembers(BinaryReader& reader)
+		{
+			reader.Read(name);
+			reader.Read(tile_size);
+			reader.Read(tile_count);
+			reader.Read(columns);
+			reader.Read(image_margin);
+			reader.Read(image_spacing);
+			reader.Read(object_alignment);
+			reader.Read(background_color);
+			reader.Read(orientation);
+			reader.Read(size);
+			reader.Read(image_path);
+			reader.Read(transparent_color);
+			reader.Read(image_size);
+			return reader.IsValid();
+		}
+
+		void TileSet::DoSaveBinaryMembers(BinaryWriter& writer) const
+		{
+			writer.Write(name);
+			writer.Write(tile_size);
+			writer.Write(tile_count);
+			writer.Write(columns);
+			writer.Write(image_margin);
+			writer.Write(image_spacing);
+			writer.Write(object_alignment);
+			writer.Write(background_color);
+			writer.Write(orientation);
+			writer.Write(size);
+			writer.Write(image_path);
+			writer.Write(transparent_color);
+			writer.Write(image_size);
+		}
+
+		bool TileSet::DoLoadBinary(BinaryReader& reader)
+		{
+			if (!ManagerObject::DoLoadBinary(reader))
+				return false;
+			if (!DoLoadBinaryObjectListHelper(reader, tiles, this)) // already sorted
+				return false;
+			if (!DoLoadBinaryObjectListHelper(reader, grounds, this))
+				return false;
+			if (!DoLoadBinaryObjectListHelper(reader, wangsets, this))
+				return false;
+			reader.Read(min_tile_id);
+			reader.Read(max_tile_id);
+			return reader.IsValid();
+		}
+
+		void TileSet::DoSaveBinary(BinaryWriter& writer) const
+		{
+			ManagerObject::DoSaveBinary(writer);
+			DoSaveBinaryObjectListHelper(writer, tiles);
+			DoSaveBinaryObjectListHelper(writer, grounds);
+			DoSaveBinaryObjectListHelper(writer, wangsets);
+			writer.Write(min_tile_id);
+			writer.Write(max_tile_id);
+		}
+
 	};  // namespace TiledMap
 
 }; // namespace chaos
@@ -42,6 +42,7 @@ namespace chaos
 		{
 			shared_ptr<Window> prevent_destruction = window;
 			windows.erase(it);
+			window_index.Invalidate();
 			if (window->GetWindowDestructionGuard() == 0) // can destroy immediatly the window or must wait until no current operation ?
 				OnWindowDestroyed(window);
 		}
@@ -56,24 +57,40 @@ namespace chaos
 			glfwPollEvents();
 
 			double t2 = glfwGetTime();
-			float delta_time = (float)(t2 - t1);
-			float real_delta_time = delta_time;
+			double precise_delta_time = t2 - t1; // the fixed time step accumulates doubles
+			float real_delta_time = (float)precise_delta_time;
 
 			if (forced_zero_tick_duration) // a single frame with a zero delta_time (used whenever a long operation is beeing done during one frame and we don't want to have big dt)
 			{
-				delta_time = 0.0f;
+				precise_delta_time = 0.0;
 				forced_zero_tick_duration = false;
 			}
 			else
 			{
 				if (forced_tick_duration > 0.0f)
-					delta_time = forced_tick_duration;
+					precise_delta_time = forced_tick_duration;
 				else if (max_tick_duration > 0.0f)
-					delta_time = std::min(delta_time, max_tick_duration);
+					precise_delta_time = std::min(precise_delta_time, (double)max_tick_duration);
 			}
+			float delta_time = (float)precise_delta_time;
+
 			// internal tick
-			bool tick_result = WithGLFWContext(shared_context, [this, delta_time]()
+			bool tick_result = WithGLFWContext(shared_context, [this, delta_time, precise_delta_time]()
 			{
+				// upload some pixels of the textures that are loaded asynchronously
+				if (gpu_resource_manager != nullptr)
+					if (GPUTextureUploadQueue* texture_upload_queue = gpu_resource_manager->GetTextureUploadQueue())
+						texture_upload_queue->ProcessUploads();
+
+				// fixed time step : the simulation is ticked 0..N times with a constant duration
+				if (fixed_time_step.IsEnabled())
+				{
+					int step_count = fixed_time_step.AdvanceTime(precise_delta_time);
+					for (int i = 0; i < step_count; ++i)
+						if (!Tick(float(fixed_time_step.GetStepDuration())))
+							return false;
+					return true;
+				}
 				return Tick(delta_time);
 			});
 			if (!tick_result) // quit the loop if the current tick method requires so
@@ -98,6 +115,8 @@ namespace chaos
 					window->DrawWindow();
 				});
 			});
+			// do not exceed the target frame rate
+			frame_pacer.WaitNextFrame();
 			// update time
 			t1 = t2;
 		}
@@ -126,6 +145,7 @@ namespace chaos
 			if (result == nullptr)
 				return nullptr;
 			windows.push_back(result.get());
+			window_index.Invalidate();
 			// set the name
 			result->SetObjectNaming(request);
 			// set the configuration
@@ -549,6 +569,13 @@ namespace chaos
 	{
 		assert(glfwGetCurrentContext() == shared_context);
 
+		// keep the linked programs between executions
+		if (gpu_program_cache)
+		{
+			GPUProgramGenerator::SetBinaryCacheMaxSize(gpu_program_cache_max_size);
+			GPUProgramGenerator::SetBinaryCacheDirectory(GetUserLocalTempPath() / "gpu_programs");
+		}
+
 		// create and start the GPU manager
 		gpu_resource_manager = new GPUResourceManager;
 		if (gpu_resource_manager == nullptr)
@@ -568,6 +595,18 @@ namespace chaos
 
 		JSONTools::GetAttribute(config, "max_tick_duration", max_tick_duration);
 		JSONTools::GetAttribute(config, "forced_tick_duration", forced_tick_duration);
+		JSONTools::GetAttribute(config, "gpu_program_cache", gpu_program_cache);
+		JSONTools::GetAttribute(config, "gpu_program_cache_max_size", gpu_program_cache_max_size);
+
+		double fixed_tick_duration = 0.0;
+		if (JSONTools::GetAttribute(config, "fixed_tick_duration", fixed_tick_duration))
+			fixed_time_step.SetStepDuration(fixed_tick_duration);
+		int max_fixed_tick_count = 0;
+		if (JSONTools::GetAttribute(config, "max_fixed_tick_count", max_fixed_tick_count))
+			fixed_time_step.SetMaxStepCount(max_fixed_tick_count);
+		float target_frame_rate = 0.0f;
+		if (JSONTools::GetAttribute(config, "target_frame_rate", target_frame_rate))
+			frame_pacer.SetTargetFrameRate(target_frame_rate);
 
 		return true;
 	}
@@ -787,12 +826,12 @@ namespace chaos
 
 	AutoCastable<Window> WindowApplication::FindWindow(ObjectRequest request)
 	{
-		return request.FindObject(windows);
+		return request.FindObject(windows, window_index);
 	}
 
 	AutoConstCastable<Window> WindowApplication::FindWindow(ObjectRequest request) const
 	{
-		return request.FindObject(windows);
+		return request.FindObject(windows, window_index);
 	}
 
 	bool WindowApplication::DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const